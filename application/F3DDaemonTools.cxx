@@ -0,0 +1,282 @@
+#include "F3DDaemonTools.h"
+
+#include <log.h>
+
+#include <iostream>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+#ifndef _WIN32
+//----------------------------------------------------------------------------
+bool FillAddress(const std::string& endpoint, sockaddr_un& address)
+{
+  address = {};
+  address.sun_family = AF_UNIX;
+  if (endpoint.empty() || endpoint.size() >= sizeof(address.sun_path))
+  {
+    f3d::log::error("Invalid daemon socket path: \"", endpoint, "\"");
+    return false;
+  }
+  std::memcpy(address.sun_path, endpoint.c_str(), endpoint.size() + 1);
+  return true;
+}
+
+//----------------------------------------------------------------------------
+// Jobs can read and write any file the daemon can, so the socket must not be
+// replaceable by other users: its directory is either private or sticky, like /tmp
+bool CheckParentDirectory(const std::string& endpoint)
+{
+  const std::string::size_type slash = endpoint.find_last_of('/');
+  const std::string directory =
+    slash == std::string::npos ? "." : (slash == 0 ? "/" : endpoint.substr(0, slash));
+
+  struct stat info;
+  if (stat(directory.c_str(), &info) != 0)
+  {
+    f3d::log::error("Cannot check daemon socket directory \"", directory, "\": ",
+      std::strerror(errno));
+    return false;
+  }
+
+  if ((info.st_mode & (S_IWGRP | S_IWOTH)) != 0 && (info.st_mode & S_ISVTX) == 0)
+  {
+    f3d::log::error("Cannot create daemon socket in \"", directory,
+      "\": the directory is writable by other users");
+    return false;
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+// Remove the socket file left behind by a previous daemon which did not stop properly.
+// Any other file, or a socket a daemon is still listening on, is kept and reported.
+bool RemoveStaleSocket(const std::string& endpoint, const sockaddr_un& address)
+{
+  struct stat info;
+  if (lstat(endpoint.c_str(), &info) != 0)
+  {
+    if (errno == ENOENT)
+    {
+      return true;
+    }
+    f3d::log::error("Cannot check daemon socket \"", endpoint, "\": ", std::strerror(errno));
+    return false;
+  }
+
+  if (!S_ISSOCK(info.st_mode))
+  {
+    f3d::log::error("Cannot create daemon socket \"", endpoint, "\": a file already exists");
+    return false;
+  }
+
+  int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0)
+  {
+    f3d::log::error("Cannot create daemon socket: ", std::strerror(errno));
+    return false;
+  }
+  const bool connected =
+    connect(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0;
+  const int connectError = errno;
+  close(fd);
+
+  if (connected)
+  {
+    f3d::log::error("A daemon is already listening on \"", endpoint, "\"");
+    return false;
+  }
+  if (connectError != ECONNREFUSED)
+  {
+    f3d::log::error(
+      "Cannot check daemon socket \"", endpoint, "\": ", std::strerror(connectError));
+    return false;
+  }
+
+  if (unlink(endpoint.c_str()) != 0)
+  {
+    f3d::log::error("Cannot remove stale daemon socket \"", endpoint, "\": ",
+      std::strerror(errno));
+    return false;
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool WriteAll(int fd, const std::string& data)
+{
+  size_t written = 0;
+  while (written < data.size())
+  {
+    ssize_t count = write(fd, data.data() + written, data.size() - written);
+    if (count <= 0)
+    {
+      return false;
+    }
+    written += static_cast<size_t>(count);
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+// Read lines from a file descriptor until it is closed or the callback returns false
+template<typename F>
+void ReadLines(int fd, F&& onLine)
+{
+  std::string pending;
+  char buffer[4096];
+  ssize_t count = 0;
+  while ((count = read(fd, buffer, sizeof(buffer))) > 0)
+  {
+    pending.append(buffer, static_cast<size_t>(count));
+    size_t end = 0;
+    while ((end = pending.find('\n')) != std::string::npos)
+    {
+      const std::string line = pending.substr(0, end);
+      pending.erase(0, end + 1);
+      if (!line.empty() && !onLine(line))
+      {
+        return;
+      }
+    }
+  }
+}
+#endif
+}
+
+//----------------------------------------------------------------------------
+bool F3DDaemonTools::Serve(const std::string& endpoint, const JobHandler& handler)
+{
+  bool stop = false;
+
+  if (endpoint == "-")
+  {
+    f3d::log::info("Daemon ready, reading jobs from the standard input");
+    std::string line;
+    while (!stop && std::getline(std::cin, line))
+    {
+      if (!line.empty())
+      {
+        std::cout << handler(line, stop) << std::endl;
+      }
+    }
+    return true;
+  }
+
+#ifdef _WIN32
+  f3d::log::error("Daemon sockets are not supported on Windows, use \"-\" for the standard input");
+  return false;
+#else
+  sockaddr_un address;
+  if (!::FillAddress(endpoint, address))
+  {
+    return false;
+  }
+
+  // A previous daemon may have left its socket file behind
+  if (!::CheckParentDirectory(endpoint) || !::RemoveStaleSocket(endpoint, address))
+  {
+    return false;
+  }
+
+  int server = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (server < 0)
+  {
+    f3d::log::error("Cannot create daemon socket: ", std::strerror(errno));
+    return false;
+  }
+
+  // Only the current user can connect, whatever the umask
+  const mode_t previousMask = umask(077);
+  const bool bound = bind(server, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0;
+  umask(previousMask);
+  if (!bound || chmod(endpoint.c_str(), 0600) != 0 || listen(server, 16) != 0)
+  {
+    f3d::log::error("Cannot listen on daemon socket \"", endpoint, "\": ", std::strerror(errno));
+    close(server);
+    return false;
+  }
+
+  // A client closing its connection early must not terminate the daemon
+  std::signal(SIGPIPE, SIG_IGN);
+
+  f3d::log::info("Daemon ready, listening on \"", endpoint, "\"");
+  while (!stop)
+  {
+    int client = accept(server, nullptr, nullptr);
+    if (client < 0)
+    {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+      f3d::log::error("Cannot accept daemon connection: ", std::strerror(errno));
+      break;
+    }
+
+    ::ReadLines(client,
+      [&](const std::string& line)
+      { return ::WriteAll(client, handler(line, stop) + "\n") && !stop; });
+    close(client);
+  }
+
+  close(server);
+  unlink(endpoint.c_str());
+  return true;
+#endif
+}
+
+//----------------------------------------------------------------------------
+bool F3DDaemonTools::Submit([[maybe_unused]] const std::string& endpoint,
+  [[maybe_unused]] const std::string& job, [[maybe_unused]] std::string& reply)
+{
+#ifdef _WIN32
+  f3d::log::error("Daemon sockets are not supported on Windows");
+  return false;
+#else
+  sockaddr_un address;
+  if (!::FillAddress(endpoint, address))
+  {
+    return false;
+  }
+
+  int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0 || connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0)
+  {
+    f3d::log::error("Cannot connect to daemon \"", endpoint, "\": ", std::strerror(errno));
+    if (fd >= 0)
+    {
+      close(fd);
+    }
+    return false;
+  }
+
+  bool replied = false;
+  if (::WriteAll(fd, job + "\n"))
+  {
+    ::ReadLines(fd,
+      [&](const std::string& line)
+      {
+        reply = line;
+        replied = true;
+        return false;
+      });
+  }
+  close(fd);
+
+  if (!replied)
+  {
+    f3d::log::error("The daemon \"", endpoint, "\" did not reply");
+  }
+  return replied;
+#endif
+}
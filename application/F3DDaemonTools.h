@@ -0,0 +1,39 @@
+/**
+ * @class   F3DDaemonTools
+ * @brief   A namespace to exchange JSON lines render jobs between a daemon and its clients
+ *
+ * The daemon reads one job per line, either from the standard input or from the connections
+ * to a local Unix socket, and writes one reply line per job.
+ */
+
+#ifndef F3DDaemonTools_h
+#define F3DDaemonTools_h
+
+#include <functional>
+#include <string>
+
+namespace F3DDaemonTools
+{
+/**
+ * Process a job line and return the reply line.
+ * Set stop to true to stop serving after this job.
+ */
+using JobHandler = std::function<std::string(const std::string& job, bool& stop)>;
+
+/**
+ * Serve jobs on the given endpoint until a handler sets stop to true, or until the standard
+ * input is closed. The endpoint is `-` for the standard input and output, or the path of a Unix
+ * socket to create. A socket file left behind by a daemon which is not running anymore is
+ * replaced, but an existing file which is not a socket or a socket a daemon is listening on is
+ * kept. Returns false if the endpoint cannot be created (error already logged).
+ */
+bool Serve(const std::string& endpoint, const JobHandler& handler);
+
+/**
+ * Send a job line to the daemon listening on the given Unix socket path and wait for its reply.
+ * Returns false if the daemon cannot be reached (error already logged).
+ */
+bool Submit(const std::string& endpoint, const std::string& job, std::string& reply);
+}
+
+#endif
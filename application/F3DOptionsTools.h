@@ -34,6 +34,8 @@ static inline const OptionsDict DefaultAppOptions = {
   { "config", "" },
   { "no-config", "false" },
   { "no-render", "false" },
+  { "daemon", "" },
+  { "daemon-client", "" },
   { "load-statefile", "" },
   { "save-statefile", "" },
   { "statefile-filename", "" },
@@ -102,6 +104,7 @@ static inline const std::map<std::string_view, std::string_view> LibOptionsNames
   { "coloring-scalar-bar", "ui.scalar_bar" },
   { "colormap", "model.scivis.colormap" },
   { "colormap-discretization", "model.scivis.discretization" },
+  { "culling", "render.culling" },
   { "display-depth", "render.effect.display_depth" },
   { "dpi-aware", "ui.dpi_aware" },
   { "edges", "render.show_edges" },
@@ -145,7 +148,9 @@ static inline const std::map<std::string_view, std::string_view> LibOptionsNames
   { "roughness", "model.material.roughness" },
   { "scalar-coloring", "model.scivis.enable" },
   { "scene-hierarchy", "ui.scene_hierarchy" },
+  { "target-frame-time", "interactor.target_frame_time" },
   { "texture-base-color", "model.color.texture" },
+  { "texture-cache", "render.texture_cache" },
   { "texture-emissive", "model.emissive.texture" },
   { "texture-matcap", "model.matcap.texture" },
   { "texture-material", "model.material.texture" },
@@ -3,6 +3,7 @@
 #include "F3DColorMapTools.h"
 #include "F3DConfig.h"
 #include "F3DConfigFileTools.h"
+#include "F3DDaemonTools.h"
 #include "F3DException.h"
 #include "F3DIcon.h"
 #include "F3DNSDelegate.h"
@@ -107,6 +108,7 @@ public:
     bool BindingsList;
     bool NoBackground;
     bool NoRender;
+    std::string Daemon;
     std::string RenderingBackend;
     std::optional<double> MaxSize;
     std::optional<double> AnimationTime;
@@ -939,7 +941,8 @@ public:
     // Update Verbose level as soon as possible, redirecting logs to stderr whenever data is
     // written to stdout so it stays usable when piped
     F3DInternals::SetVerboseLevel(this->AppOptions.VerboseLevel,
-      this->AppOptions.Output == F3D_PIPED || this->AppOptions.SaveStatefile == F3D_PIPED);
+      this->AppOptions.Output == F3D_PIPED || this->AppOptions.SaveStatefile == F3D_PIPED ||
+        this->AppOptions.Daemon == F3D_PIPED);
 
     // Load any new plugins
     F3DPluginsTools::LoadPlugins(this->AppOptions.Plugins, this->AppOptions.PluginsPath);
@@ -998,6 +1001,7 @@ public:
     this->ParseOption(appOptions, "list-bindings", this->AppOptions.BindingsList);
     this->ParseOption(appOptions, "no-background", this->AppOptions.NoBackground);
     this->ParseOption(appOptions, "no-render", this->AppOptions.NoRender);
+    this->ParseOption(appOptions, "daemon", this->AppOptions.Daemon);
     this->ParseOption(appOptions, "rendering-backend", this->AppOptions.RenderingBackend);
     this->ParseOption(appOptions, "max-size", this->AppOptions.MaxSize);
     this->ParseOption(appOptions, "animation-time", this->AppOptions.AnimationTime);
@@ -1220,6 +1224,72 @@ public:
     return parents;
   }
 
+  /**
+   * Send the input files and the CLI options as a render job to a daemon, see
+   * F3DStarter::RunDaemon. Paths are made absolute since the daemon may run in another directory.
+   */
+  static int SubmitDaemonJob(const std::string& endpoint,
+    const F3DOptionsTools::OptionsDict& cliOptions, const std::vector<std::string>& inputFiles)
+  {
+    nlohmann::json job;
+    job["files"] = nlohmann::json::array();
+    for (const std::string& file : inputFiles)
+    {
+      job["files"].push_back(f3d::utils::collapsePath(file).string());
+    }
+
+    // Options only relevant to the local process are not forwarded
+    static const std::set<std::string> localOptions = { "config", "daemon", "daemon-client",
+      "no-config", "verbose" };
+
+    nlohmann::json options = nlohmann::json::object();
+    for (const auto& [name, value] : cliOptions)
+    {
+      if (name == "output")
+      {
+        if (value == F3D_PIPED)
+        {
+          f3d::log::error("The output cannot be piped when submitting a job to a daemon");
+          return EXIT_FAILURE;
+        }
+        job["output"] = f3d::utils::collapsePath(value).string();
+      }
+      else if (!localOptions.contains(name))
+      {
+        options[name] = value;
+      }
+    }
+    job["options"] = options;
+
+    if (!job.contains("output"))
+    {
+      f3d::log::error("An output is required when submitting a job to a daemon");
+      return EXIT_FAILURE;
+    }
+
+    std::string reply;
+    if (!F3DDaemonTools::Submit(endpoint, job.dump(), reply))
+    {
+      return EXIT_FAILURE;
+    }
+
+    try
+    {
+      auto root = nlohmann::json::parse(reply);
+      if (root.value("status", "") == "ok")
+      {
+        f3d::log::debug("Daemon job rendered to ", root.value("output", ""));
+        return EXIT_SUCCESS;
+      }
+      f3d::log::error("Daemon job failed: ", root.value("message", "unknown error"));
+    }
+    catch (const nlohmann::json::exception& ex)
+    {
+      f3d::log::error("Invalid daemon reply: ", ex.what());
+    }
+    return EXIT_FAILURE;
+  }
+
   static void SigCallback(int)
   {
     if (GlobalInteractor)
@@ -1338,6 +1408,17 @@ int F3DStarter::Start(int argc, char** argv)
     statefileToStdout = localSaveStatefile == F3D_PIPED;
   }
 
+  // Replies to the jobs are written to stdout when the daemon reads them from stdin
+  bool daemonToStdout = false;
+  iter = cliOptionsDict.find("daemon");
+  if (iter != cliOptionsDict.end())
+  {
+    std::string localDaemon;
+    // XXX: Discarding bool return because this cannot return false with a string
+    F3DOptionsTools::Parse(iter->second, localDaemon);
+    daemonToStdout = localDaemon == F3D_PIPED;
+  }
+
   this->Internals->AppOptions.VerboseLevel = "info";
   iter = cliOptionsDict.find("verbose");
   if (iter != cliOptionsDict.end())
@@ -1348,8 +1429,15 @@ int F3DStarter::Start(int argc, char** argv)
 
   // Set verbosity level early from command line, redirecting logs to stderr whenever data is
   // written to stdout so it stays usable when piped
-  F3DInternals::SetVerboseLevel(
-    this->Internals->AppOptions.VerboseLevel, renderToStdout || statefileToStdout);
+  F3DInternals::SetVerboseLevel(this->Internals->AppOptions.VerboseLevel,
+    renderToStdout || statefileToStdout || daemonToStdout);
+
+  // In client mode, the job is sent to the daemon without configuring anything locally
+  iter = cliOptionsDict.find("daemon-client");
+  if (iter != cliOptionsDict.end())
+  {
+    return F3DInternals::SubmitDaemonJob(iter->second, cliOptionsDict, inputFiles);
+  }
 
   f3d::log::debug("========== Initializing Options ==========");
 
@@ -1436,7 +1524,8 @@ int F3DStarter::Start(int argc, char** argv)
   else
   {
     bool offscreen = !this->Internals->AppOptions.Reference.empty() ||
-      !this->Internals->AppOptions.Output.empty() || this->Internals->AppOptions.BindingsList;
+      !this->Internals->AppOptions.Output.empty() || this->Internals->AppOptions.BindingsList ||
+      !this->Internals->AppOptions.Daemon.empty();
 
     try
     {
@@ -1495,6 +1584,15 @@ int F3DStarter::Start(int argc, char** argv)
   this->Internals->Engine->setOptions(this->Internals->LibOptions);
   f3d::log::debug("Engine configured");
 
+  if (!this->Internals->AppOptions.Daemon.empty())
+  {
+    if (!inputFiles.empty())
+    {
+      f3d::log::warn("Input files are ignored in daemon mode, provide them in the jobs");
+    }
+    return this->RunDaemon();
+  }
+
   // Restore explicit statefile file groups first, so command-line input files append after them
   int statefileCurrentGroup = 0;
   if (statefileFileGroups.has_value())
@@ -2194,6 +2292,103 @@ void F3DStarter::LoadFileGroupInternal(
   options.ui.filename_info = filenameInfo;
 }
 
+//----------------------------------------------------------------------------
+int F3DStarter::RunDaemon()
+{
+  if (this->Internals->AppOptions.NoRender)
+  {
+    f3d::log::error("The daemon mode cannot be used with --no-render");
+    return EXIT_FAILURE;
+  }
+
+  // Options provided when starting the daemon apply to every job, below the job options
+  const std::string endpoint = this->Internals->AppOptions.Daemon;
+  const F3DOptionsTools::OptionsEntries daemonOptionsEntries = this->Internals->CLIOptionsEntries;
+
+  bool served = F3DDaemonTools::Serve(endpoint,
+    [&](const std::string& job, bool& stop)
+    {
+      std::string reply = this->ProcessDaemonJob(job, stop);
+      this->Internals->CLIOptionsEntries = daemonOptionsEntries;
+      return reply;
+    });
+
+  return served ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+//----------------------------------------------------------------------------
+std::string F3DStarter::ProcessDaemonJob(const std::string& line, bool& stop)
+{
+  nlohmann::json reply;
+  reply["status"] = "error";
+
+  try
+  {
+    const nlohmann::json job = nlohmann::json::parse(line);
+    if (job.value("command", "") == "quit")
+    {
+      stop = true;
+      reply["status"] = "ok";
+      return reply.dump();
+    }
+
+    F3DOptionsTools::OptionsDict jobOptions;
+    for (const auto& [name, value] : job.value("options", nlohmann::json::object()).items())
+    {
+      jobOptions[name] = value.is_string() ? value.get<std::string>() : value.dump();
+    }
+
+    const std::string output = job.at("output").get<std::string>();
+    if (output.empty() || output == F3D_PIPED)
+    {
+      reply["message"] = "A job requires an output file";
+      return reply.dump();
+    }
+    jobOptions["output"] = output;
+
+    // Reset the state of the previous job, only the engine and its window are kept between jobs
+    this->Internals->CLIOptionsEntries.emplace_back(jobOptions, "", "", "daemon job options");
+    this->Internals->DynamicOptionsEntries.clear();
+    this->Internals->RuntimeStatefileOptionsEntries.clear();
+    this->Internals->FilesGroups.clear();
+    this->Internals->CurrentFilesGroupIndex = -1;
+
+    for (const std::string& file : job.at("files").get<std::vector<std::string>>())
+    {
+      this->AddFile(f3d::utils::collapsePath(file), true);
+    }
+    this->LoadFileGroup(0, false, true);
+    this->Internals->ApplyPositionAndResolution();
+
+    if (this->Internals->LoadedFiles.empty())
+    {
+      reply["message"] = "No files loaded, no rendering performed";
+      return reply.dump();
+    }
+
+    const f3d::utils::string_template outputTemplate = this->Internals->prepareFilenameTemplate(
+      f3d::utils::collapsePath(this->Internals->AppOptions.Output));
+    if (!this->Internals->renderAndSave(
+          this->Internals->Engine->getWindow(), outputTemplate, false))
+    {
+      reply["message"] = "Could not write output";
+      return reply.dump();
+    }
+
+    reply["status"] = "ok";
+    reply["output"] = this->Internals->finalizeFilenameTemplate(outputTemplate).string();
+  }
+  catch (const nlohmann::json::exception& ex)
+  {
+    reply["message"] = std::string("Invalid job: ") + ex.what();
+  }
+  catch (const std::exception& ex)
+  {
+    reply["message"] = ex.what();
+  }
+  return reply.dump();
+}
+
 //----------------------------------------------------------------------------
 void F3DStarter::Render()
 {
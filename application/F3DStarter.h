@@ -128,6 +128,20 @@ private:
   void LoadFileGroupInternal(
     const std::vector<std::filesystem::path>& paths, bool clear, const std::string& groupIdx);
 
+  /**
+   * Serve render jobs on the daemon endpoint until a quit command is received, reusing the same
+   * engine, window and compiled shaders between jobs.
+   * Each job is a JSON line: `{"files": [...], "output": "...", "options": {...}}`, options using
+   * the CLI option names. A job `{"command": "quit"}` stops the daemon.
+   */
+  int RunDaemon();
+
+  /**
+   * Load the files of a daemon job, render them into the job output and return the JSON reply:
+   * `{"status": "ok", "output": "..."}` or `{"status": "error", "message": "..."}`.
+   */
+  std::string ProcessDaemonJob(const std::string& line, bool& stop);
+
   /**
    * Internal event loop that is triggered repeatedly to handle specific events:
    * - Render
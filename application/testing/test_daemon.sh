@@ -0,0 +1,71 @@
+#!/bin/bash
+
+# Test the daemon feature by starting a daemon on a socket, submitting a job
+# and checking the rendered output, then checking the socket path is only
+# replaced when no daemon is listening on it and is private to the user
+
+set -euo pipefail
+f3d_cmd=$1
+data_dir=$2
+tmp_dir=$3
+
+socket=$tmp_dir/TestDaemon.sock
+output=$tmp_dir/TestDaemon.png
+log=$tmp_dir/TestDaemon.log
+
+rm -f $socket $output
+
+$f3d_cmd --daemon=$socket --verbose > $log 2>&1 &
+pid=$!
+
+function cleanup()
+{
+  kill -SIGTERM $pid 2> /dev/null || true
+  rm -f $socket
+}
+trap "cleanup" EXIT
+
+sleep 3
+
+# The job is rendered by the daemon, the client exits once it replied
+$f3d_cmd --daemon-client=$socket $data_dir/cow.vtp --output=$output --resolution=300,300
+test -s $output
+
+# Only the current user can connect to the socket
+[[ $(ls -l $socket) == srw-------* ]]
+
+# A second daemon cannot take the socket of a running daemon
+if $f3d_cmd --daemon=$socket > /dev/null 2>&1; then
+  exit 1
+fi
+test -S $socket
+
+# The socket left behind by a killed daemon is replaced
+kill -SIGKILL $pid
+wait $pid 2> /dev/null || true
+test -S $socket
+$f3d_cmd --daemon=$socket > $log 2>&1 &
+pid=$!
+sleep 3
+rm -f $output
+$f3d_cmd --daemon-client=$socket $data_dir/cow.vtp --output=$output --resolution=300,300
+test -s $output
+kill -SIGTERM $pid
+wait $pid 2> /dev/null || true
+
+# An existing file which is not a socket is never removed
+rm -f $socket
+touch $socket
+if $f3d_cmd --daemon=$socket > /dev/null 2>&1; then
+  exit 1
+fi
+test -f $socket
+
+# A directory other users can write to without the sticky bit is refused
+shared_dir=$tmp_dir/TestDaemonShared
+mkdir -p $shared_dir
+chmod 777 $shared_dir
+if $f3d_cmd --daemon=$shared_dir/TestDaemon.sock > /dev/null 2>&1; then
+  exit 1
+fi
+test ! -e $shared_dir/TestDaemon.sock
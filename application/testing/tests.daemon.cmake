@@ -0,0 +1,6 @@
+## Custom test for daemon CLI option
+# Daemon sockets are only supported on Unix
+if(UNIX)
+  add_test (NAME f3d::TestDaemon COMMAND ${CMAKE_CURRENT_SOURCE_DIR}/test_daemon.sh $<TARGET_FILE:f3d> ${F3D_SOURCE_DIR}/testing/data ${CMAKE_BINARY_DIR}/Testing/Temporary)
+  set_tests_properties(f3d::TestDaemon PROPERTIES RUN_SERIAL TRUE TIMEOUT 90)
+endif()
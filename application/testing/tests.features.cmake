@@ -187,6 +187,7 @@ endif()
 ## Metadata
 f3d_test(NAME TestMetaData DATA pdiag.vtu ARGS -m UI)
 f3d_test(NAME TestMetaDataImporter DATA BoxAnimated.gltf ARGS -m UI)
+f3d_test(NAME TestVerboseInstancing DATA InstancedTriangle.gltf ARGS --verbose REGEXP "Number of actors: 1" NO_BASELINE)
 f3d_test(NAME TestMultiblockMetaData DATA mb.vtm ARGS -m UI)
 
 ## Scene Hierarchy
@@ -299,6 +300,9 @@ f3d_test(NAME TestInvalidAntiAliasingMode DATA suzanne.ply ARGS --anti-aliasing=
 
 ## Blending
 f3d_test(NAME TestBlendingImplicit DATA suzanne.ply ARGS -p --verbose REGEXP "'blending' = 'ddp'" NO_BASELINE)
+f3d_test(NAME TestBlendingWeighted DATA suzanne.ply ARGS --blending=weighted --opacity=0.5 --verbose REGEXP "'blending' = 'weighted'" NO_BASELINE)
+f3d_test(NAME TestBlendingWeightedVolume DATA HeadMRVolume.mhd ARGS -v --blending=weighted REGEXP "Weighted blending does not support volumes, using dual depth peeling instead" NO_BASELINE)
+f3d_test(NAME TestCulling DATA suzanne.ply ARGS --culling --verbose=debug REGEXP "'culling' = '1' from CLI options" NO_BASELINE)
 f3d_test(NAME TestInvalidBlendingMode DATA suzanne.ply ARGS --blending=foo REGEXP "foo is an invalid blending mode" NO_BASELINE)
 
 ## InteractionStyle
@@ -422,6 +426,16 @@ if(F3D_MODULE_EXR)
   f3d_test(NAME TestVersionEXR ARGS --version REGEXP "Module OpenEXR: ON")
 endif()
 
+if(F3D_MODULE_KTX)
+  f3d_test(NAME TestVersionKTX ARGS --version REGEXP "Module KTX: ON")
+  f3d_test(NAME TestGLTFBasisu DATA BasisuTexture.gltf ARGS --verbose REGEXP "Number of points: 4" REGEXP_FAIL "not supported" NO_BASELINE)
+endif()
+
+if(F3D_MODULE_MESHOPT)
+  f3d_test(NAME TestVersionMeshopt ARGS --version REGEXP "Module Meshopt: ON")
+  f3d_test(NAME TestGLTFMeshoptInvalidView DATA MeshoptTriangleInvalid.gltf REGEXP "Invalid meshopt compressed buffer view 0: count and byteStride" NO_BASELINE)
+endif()
+
 if(F3D_MODULE_WEBP)
   f3d_test(NAME TestVersionWebP ARGS --version REGEXP "Module WebP: ON")
   # Needs https://gitlab.kitware.com/vtk/vtk/-/merge_requests/11922
@@ -7,6 +7,9 @@ f3d_test(NAME TestExodusExo DATA box.exo PLUGIN hdf ARGS NO_RENDER NO_BASELINE R
 f3d_test(NAME TestExodusG DATA box.g PLUGIN hdf ARGS NO_RENDER NO_BASELINE REGEXP "Number of points: 24")
 f3d_test(NAME TestExodusE DATA single_timestep.e PLUGIN hdf ARGS NO_RENDER NO_BASELINE REGEXP "Number of points: 1331")
 f3d_test(NAME TestExodusConfig DATA disk_out_ref.ex2 CONFIG ${F3D_SOURCE_DIR}/testing/configs/exodus.json ARGS -s --camera-position=-11,-2,-49 LABELS "plugin;hdf")
+f3d_test(NAME TestExodusDefinesArrays DATA disk_out_ref.ex2 PLUGIN hdf ARGS -DExodusII.arrays=Temp,V -s --coloring-array=Pres --verbose REGEXP "Coloring using point array named Pres," NO_BASELINE)
+f3d_test(NAME TestExodusDefinesArraysTemp DATA disk_out_ref.ex2 PLUGIN hdf ARGS "-DExodusII.arrays= Temp , V " -s --coloring-array=Temp --verbose REGEXP "Coloring using point array named Temp," NO_BASELINE)
+f3d_test(NAME TestExodusDefinesArraysV DATA disk_out_ref.ex2 PLUGIN hdf ARGS "-DExodusII.arrays= Temp , V " -s --coloring-array=V --verbose REGEXP "Coloring using point array named V, Magnitude" NO_BASELINE)
 f3d_test(NAME TestNetCDF DATA temperature_grid.nc PLUGIN hdf ARGS -s)
 f3d_test(NAME TestVTKHDF DATA blob.vtkhdf PLUGIN hdf ARGS -s)
 f3d_test(NAME TestAMRDataSet DATA amr.vtkhdf PLUGIN hdf ARGS -s)
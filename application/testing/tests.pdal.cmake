@@ -14,6 +14,8 @@ f3d_test(NAME TestCSD DATA sample.csd PLUGIN pdal ARGS --scalar-coloring --camer
 f3d_test(NAME TestQI DATA 10-word.qi PLUGIN pdal ARGS --scalar-coloring --camera-direction=-1,-1,-1)
 f3d_test(NAME TestSLPK DATA SMALL_AUTZEN_LAS_All.slpk PLUGIN pdal ARGS --camera-direction=-1,-1,-1)
 
+f3d_test(NAME TestLAZPointBudget DATA simple.laz PLUGIN pdal ARGS --verbose -DLAS.point_budget=500 REGEXP "Number of points: 355" NO_BASELINE)
+
 f3d_test(NAME TestInvalidPDAL DATA f3d.vtp PLUGIN pdal ARGS --force-reader=LAS  REGEXP "failed to load scene" NO_BASELINE)
 
 if(NOT F3D_MACOS_BUNDLE)
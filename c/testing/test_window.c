@@ -38,6 +38,20 @@ int test_window()
     f3d_image_delete(img);
   }
 
+  f3d_camera_state_t views[2];
+  f3d_camera_get_state(camera, &views[0]);
+  f3d_camera_get_state(camera, &views[1]);
+  views[1].position[0] += 1.0;
+  f3d_image_t* view_imgs[2] = { NULL, NULL };
+  if (!f3d_window_render_views(window, views, 2, 0, view_imgs) || !view_imgs[0] || !view_imgs[1])
+  {
+    puts("[ERROR] Failed to render views");
+    f3d_engine_delete(engine);
+    return 1;
+  }
+  f3d_image_delete(view_imgs[0]);
+  f3d_image_delete(view_imgs[1]);
+
   f3d_window_set_size(window, 800, 600);
   int width = f3d_window_get_width(window);
   (void)width;
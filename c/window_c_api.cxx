@@ -2,6 +2,8 @@
 #include "image.h"
 #include "window.h"
 
+#include <vector>
+
 //----------------------------------------------------------------------------
 f3d_window_type_t f3d_window_get_type(f3d_window_t* window)
 {
@@ -67,6 +69,35 @@ f3d_image_t* f3d_window_render_to_image(f3d_window_t* window, int no_background)
   return reinterpret_cast<f3d_image_t*>(heap_img);
 }
 
+//----------------------------------------------------------------------------
+int f3d_window_render_views(f3d_window_t* window, const f3d_camera_state_t* views, size_t count,
+  int no_background, f3d_image_t** images)
+{
+  if (!window || (count > 0 && (!views || !images)))
+  {
+    return 0;
+  }
+
+  std::vector<f3d::camera_state_t> cpp_views(count);
+  for (size_t i = 0; i < count; i++)
+  {
+    const f3d_camera_state_t& view = views[i];
+    cpp_views[i].position = { view.position[0], view.position[1], view.position[2] };
+    cpp_views[i].focalPoint = { view.focal_point[0], view.focal_point[1], view.focal_point[2] };
+    cpp_views[i].viewUp = { view.view_up[0], view.view_up[1], view.view_up[2] };
+    cpp_views[i].viewAngle = view.view_angle;
+  }
+
+  f3d::window* cpp_window = reinterpret_cast<f3d::window*>(window);
+  std::vector<f3d::image> imgs = cpp_window->renderViews(cpp_views, no_background != 0);
+
+  for (size_t i = 0; i < count; i++)
+  {
+    images[i] = reinterpret_cast<f3d_image_t*>(new f3d::image(std::move(imgs[i])));
+  }
+  return 1;
+}
+
 //----------------------------------------------------------------------------
 void f3d_window_set_size(f3d_window_t* window, int width, int height)
 {
@@ -79,6 +79,22 @@ extern "C"
    */
   F3D_EXPORT f3d_image_t* f3d_window_render_to_image(f3d_window_t* window, int no_background);
 
+  /**
+   * @brief Render the window once for each provided camera state and save the results in images.
+   *
+   * Dynamic options are updated once for all the views and the camera state is restored after
+   * rendering. The caller must free each returned image with f3d_image_delete().
+   *
+   * @param window Window handle.
+   * @param views Array of camera states to render.
+   * @param count Number of camera states in views.
+   * @param no_background If non-zero, renders with a transparent background.
+   * @param images Output array of count image handles, in the same order as views.
+   * @return 1 on success, 0 on failure.
+   */
+  F3D_EXPORT int f3d_window_render_views(f3d_window_t* window, const f3d_camera_state_t* views,
+    size_t count, int no_background, f3d_image_t** images);
+
   /**
    * @brief Set the size of the window.
    *
@@ -40,6 +40,7 @@ f3d_plugin_declare_reader(
   [STANDARD_CAN_READ]
   [EXCLUDE_FROM_THUMBNAILER]
   [CUSTOM_CODE           <file>]
+  [MAGIC                 <string>...]
   EXTENSIONS             <string>...
   MIMETYPES              <string>...)
 ~~~
@@ -57,13 +58,15 @@ The `NAME` argument is required. The arguments are as follows:
   * `CAN_READ`: Style of CAN_READ to use, STATIC, MEMBER or CUSTOM. A CAN_READ is required with SUPPORTS_STREAM
   * `EXCLUDE_FROM_THUMBNAILER`: If specified, the reader will not be used for generating thumbnails.
   * `CUSTOM_CODE`: A custom code file containing the implementation of ``applyCustomReader`` function.
+  * `MAGIC`: The list of magic bytes, as hexadecimal strings, one of which the files read by the
+    reader start with. Used to select the reader before loading the plugin library.
   * `EXTENSIONS`: (Required) The list of file extensions supported by the reader.
   * `MIMETYPES`: (Required) The list of mimetypes supported by the reader.
 
 #]==]
 
 macro(f3d_plugin_declare_reader)
-  cmake_parse_arguments(F3D_READER "EXCLUDE_FROM_THUMBNAILER;SUPPORTS_STREAM" "NAME;VTK_IMPORTER;VTK_READER;FORMAT_DESCRIPTION;SCORE;CAN_READ;CUSTOM_CODE" "EXTENSIONS;MIMETYPES;OPTIONS" ${ARGN})
+  cmake_parse_arguments(F3D_READER "EXCLUDE_FROM_THUMBNAILER;SUPPORTS_STREAM" "NAME;VTK_IMPORTER;VTK_READER;FORMAT_DESCRIPTION;SCORE;CAN_READ;CUSTOM_CODE" "EXTENSIONS;MIMETYPES;OPTIONS;MAGIC" ${ARGN})
 
   if(F3D_READER_CUSTOM_CODE)
     set(F3D_READER_HAS_CUSTOM_CODE 1)
@@ -143,6 +146,28 @@ macro(f3d_plugin_declare_reader)
       SET "${F3D_READER_JSON}" "exclude_thumbnailer" "false")
   endif()
 
+  if(F3D_READER_SCORE)
+    string(JSON F3D_READER_JSON
+      SET "${F3D_READER_JSON}" "score" "${F3D_READER_SCORE}")
+  else()
+    string(JSON F3D_READER_JSON
+      SET "${F3D_READER_JSON}" "score" "50")
+  endif()
+
+  set(F3D_READER_MAGIC_JSON ${F3D_READER_MAGIC})
+  list(TRANSFORM F3D_READER_MAGIC_JSON PREPEND "\"")
+  list(TRANSFORM F3D_READER_MAGIC_JSON APPEND "\"")
+  list(JOIN F3D_READER_MAGIC_JSON ", " F3D_READER_MAGIC_JSON)
+  string(JSON F3D_READER_JSON
+    SET "${F3D_READER_JSON}" "magic" "[${F3D_READER_MAGIC_JSON}]")
+
+  set(F3D_READER_OPTIONS_JSON ${F3D_READER_OPTIONS})
+  list(TRANSFORM F3D_READER_OPTIONS_JSON PREPEND "\"${F3D_READER_NAME}.")
+  list(TRANSFORM F3D_READER_OPTIONS_JSON APPEND "\"")
+  list(JOIN F3D_READER_OPTIONS_JSON ", " F3D_READER_OPTIONS_JSON)
+  string(JSON F3D_READER_JSON
+    SET "${F3D_READER_JSON}" "options" "[${F3D_READER_OPTIONS_JSON}]")
+
   list(TRANSFORM F3D_READER_OPTIONS PREPEND "{ \"${F3D_READER_NAME}.")
   list(TRANSFORM F3D_READER_OPTIONS APPEND "\", \"\" }")
   list(JOIN F3D_READER_OPTIONS ", " F3D_READER_OPTIONS)
@@ -432,8 +457,13 @@ macro(f3d_plugin_build)
       {
         "description" : "Reader description",
         "extensions" : [ "myext" ],
+        "full_scene" : false,
+        "magic" : [ "4d5945" ],
         "mimetypes" : [ "application/vnd.myext" ],
-        "name" : "myReader"
+        "name" : "myReader",
+        "options" : [ "myReader.option" ],
+        "score" : 50,
+        "supports_stream" : false
       }
     ],
     "type" : "MODULE",
@@ -461,6 +491,19 @@ macro(f3d_plugin_build)
       DESTINATION "share/f3d/plugins"
       COMPONENT plugin)
 
+  # The same JSON is written next to the plugin library as a manifest, so libf3d can register
+  # the readers and only open the library when one of them is used
+  if(NOT F3D_PLUGIN_IS_STATIC)
+    set(_plugin_target f3d-plugin-${F3D_PLUGIN_NAME})
+    set(F3D_PLUGIN_MANIFEST_FILE "$<TARGET_FILE_DIR:${_plugin_target}>/$<TARGET_FILE_PREFIX:${_plugin_target}>$<TARGET_FILE_BASE_NAME:${_plugin_target}>.json")
+
+    file(GENERATE OUTPUT "${F3D_PLUGIN_MANIFEST_FILE}" CONTENT "${F3D_PLUGIN_JSON}")
+
+    install(FILES "${F3D_PLUGIN_MANIFEST_FILE}"
+      DESTINATION ${_f3d_plugins_install_dir}
+      COMPONENT plugin)
+  endif()
+
   if(F3D_MACOS_BUNDLE)
     set_property(GLOBAL APPEND_STRING PROPERTY  F3D_MACOS_BUNDLE_XML ${F3D_MACOS_BUNDLE_XML_PLUGIN})
   endif()
@@ -193,6 +193,15 @@ public:
     return true;
   }
 
+  /**
+   * Set the name of the array used for coloring, empty if none.
+   * Readers reading only some arrays must always read this one.
+   */
+  void setColoringArrayName(const std::string& name)
+  {
+    this->ColoringArrayName = name;
+  }
+
   /**
    * Return the list of all reader option names
    */
@@ -209,6 +218,7 @@ public:
 
 protected:
   std::map<std::string, std::string> ReaderOptions;
+  std::string ColoringArrayName;
 };
 }
 
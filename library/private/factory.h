@@ -16,7 +16,9 @@
 #include "plugin.h"
 #include "reader.h"
 
+#include <functional>
 #include <map>
+#include <memory>
 #include <optional>
 #include <vector>
 
@@ -37,6 +39,13 @@ public:
    */
   void load(plugin*);
 
+  /**
+   * Register a plugin created from its manifest, see manifest_reader.
+   * The initializer is called to load the actual plugin the first time one of its readers is
+   * selected by getReader.
+   */
+  void loadLazy(std::unique_ptr<plugin> manifestPlugin, std::function<plugin*()> initializer);
+
   /**
    * Register all static plugins to the factory
    */
@@ -81,8 +90,23 @@ protected:
 
   bool registerOnce(plugin* p);
 
+  /**
+   * Pick the best valid reader, loading the plugins registered from a manifest when needed
+   */
+  reader* selectReader(
+    std::optional<std::string> forceReader, const std::function<bool(const reader*)>& isValid);
+
+  /**
+   * Load the actual plugin of a plugin registered from a manifest and replace it in the list of
+   * registered plugins. Returns nullptr if the plugin cannot be loaded, it is then unregistered.
+   */
+  plugin* resolve(plugin* manifestPlugin);
+
   std::vector<plugin*> Plugins;
 
+  std::vector<std::unique_ptr<plugin>> ManifestPlugins;
+  std::map<const plugin*, std::function<plugin*()>> LazyInitializers;
+
   std::map<std::string, plugin_initializer_t> StaticPluginInitializers;
 };
 }
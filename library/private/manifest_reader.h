@@ -0,0 +1,103 @@
+/**
+ * @class   manifest_reader
+ * @brief   A reader placeholder created from a plugin manifest
+ *
+ * Plugins built as modules are shipped with a JSON manifest next to their library, generated by
+ * f3d_plugin_declare_reader() and f3d_plugin_build(). A manifest_reader exposes the information
+ * of the manifest (name, extensions, mimetypes, magic bytes, score, reader options) without
+ * loading the plugin library. It cannot create any VTK reader: the factory replaces it by the
+ * actual reader, loading the plugin library, when it is selected to read a file.
+ */
+
+#ifndef f3d_manifest_reader_h
+#define f3d_manifest_reader_h
+
+#include "plugin.h"
+#include "reader.h"
+
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace f3d
+{
+class manifest_reader : public reader
+{
+public:
+  /**
+   * Create a plugin containing manifest_reader readers from the given manifest file.
+   * Returns nullptr if the manifest cannot be read or is invalid.
+   */
+  static std::unique_ptr<plugin> createPlugin(const std::filesystem::path& manifestPath);
+
+  const std::string getName() const override
+  {
+    return this->Name;
+  }
+
+  const std::string getShortDescription() const override
+  {
+    return this->Description;
+  }
+
+  const std::vector<std::string> getExtensions() const override
+  {
+    return this->Extensions;
+  }
+
+  const std::vector<std::string> getMimeTypes() const override
+  {
+    return this->MimeTypes;
+  }
+
+  int getScore() const override
+  {
+    return this->Score;
+  }
+
+  bool hasGeometryReader() override
+  {
+    return !this->FullScene;
+  }
+
+  bool hasSceneReader() override
+  {
+    return this->FullScene;
+  }
+
+  bool supportsStream() const override
+  {
+    return this->SupportsStream;
+  }
+
+  using reader::canRead;
+
+  /**
+   * Check the magic bytes declared in the manifest, if any.
+   * Returns true when no magic bytes are declared, the actual reader will check the content.
+   */
+  bool canRead(vtkResourceStream* stream) const override;
+
+  /**
+   * Get the reader options set before the actual reader was loaded
+   */
+  const std::map<std::string, std::string>& getReaderOptions() const
+  {
+    return this->ReaderOptions;
+  }
+
+private:
+  std::string Name;
+  std::string Description;
+  std::vector<std::string> Extensions;
+  std::vector<std::string> MimeTypes;
+  std::vector<std::string> Magics;
+  int Score = 50;
+  bool FullScene = false;
+  bool SupportsStream = false;
+};
+}
+
+#endif
@@ -52,6 +52,8 @@ public:
   unsigned int availableAnimations() const override;
   std::string getAnimationName(int index = -1) override;
   std::vector<std::string> getAnimationNames() override;
+  scene& setCollectLoadStatistics(bool collect) override;
+  std::vector<load_statistics_t> getLoadStatistics() const override;
   ///@}
 
   /**
@@ -51,6 +51,8 @@ public:
   camera& getCamera() override;
   bool render() override;
   image renderToImage(bool noBackground = false) override;
+  std::vector<image> renderViews(
+    const std::vector<camera_state_t>& views, bool noBackground = false) override;
   int getWidth() const override;
   int getHeight() const override;
   window& setSize(int width, int height) override;
@@ -59,6 +61,8 @@ public:
   window& setWindowName(std::string_view windowName) override;
   point3_t getWorldFromDisplay(const point3_t& displayPoint) const override;
   point3_t getDisplayFromWorld(const point3_t& worldPoint) const override;
+  window& setCollectFrameStatistics(bool collect) override;
+  std::vector<frame_statistics_t> getFrameStatistics() const override;
   ///@}
 
   /**
@@ -340,6 +340,11 @@ public:
    * Then try to load a plugin by its name looking into the provided plugin search paths (used as
    * is). Then try to load a plugin by its name relying on internal system (eg: LD_LIBRARY_PATH).
    *
+   * When a manifest (`.json` file with the same name) is found next to the plugin library, the
+   * readers are registered from the manifest and the library is only opened when one of them is
+   * selected to read a file. Errors when opening the library are then reported as warnings at
+   * that time.
+   *
    * The plugin "native" is always available and includes native VTK readers.
    * If built and available in your build, F3D is providing 6 additional plugins:
    * "alembic", "assimp", "draco", "hdf", "occt", "usd", "vdb".
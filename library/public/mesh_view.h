@@ -7,7 +7,9 @@
 /// @cond
 #include <array>
 #include <cstdint>
+#include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 /// @endcond
 
@@ -100,6 +102,11 @@ public:
    * If `timeDependent` is true, it means that the data in the array can change over time.
    * Set it to false if the data in the array is constant over time, it can help improving
    * performance.
+   * `dirtyRanges` optionally lists the ranges of tuples, as [begin, end) pairs, modified since the
+   * previous memory view. It is only taken into account for time dependent points, normals and
+   * texture coordinates whose `data` pointer, type, stride and point count did not change, in which
+   * case only these ranges are uploaded to the GPU. When empty, the whole array is considered
+   * modified. Will throw a load_failure_exception if a range is out of bounds.
    */
   struct data_array_t
   {
@@ -109,6 +116,7 @@ public:
     size_t components = 1;
     size_t stride = 1;
     bool timeDependent = true;
+    std::vector<std::pair<size_t, size_t>> dirtyRanges;
   };
 
   /**
@@ -163,6 +171,17 @@ public:
    */
   [[nodiscard]] virtual memory_view_t getMemoryView(double time) const = 0;
 
+  /**
+   * Get a counter which changes each time a new version of the mesh is available independently
+   * of the time, for example when it is written by another process. It is checked before each
+   * render and the mesh is updated when it changed.
+   * Returns no value by default, meaning the mesh only changes with the time.
+   */
+  [[nodiscard]] virtual std::optional<uint64_t> getFrameCounter() const
+  {
+    return std::nullopt;
+  }
+
   //! @cond
   mesh_view() = default;
   virtual ~mesh_view() = default;
@@ -213,6 +213,31 @@ public:
    */
   [[nodiscard]] virtual std::vector<std::string> getAnimationNames() = 0;
 
+  /**
+   * Statistics of a load, times are in milliseconds.
+   * readerTime is the time spent in the readers, postProcessTime the time spent preparing the
+   * loaded scene for rendering and coloringInfoTime the time spent gathering the arrays available
+   * for coloring, which is otherwise deferred to the first render.
+   */
+  struct load_statistics_t
+  {
+    double readerTime = 0.0;
+    double postProcessTime = 0.0;
+    double coloringInfoTime = 0.0;
+  };
+
+  /**
+   * Enable or disable the collection of statistics for each successful call to add.
+   * Enabling it clears the previously collected statistics.
+   * Collecting statistics gathers the coloring information when loading, which slows down loads.
+   */
+  virtual scene& setCollectLoadStatistics(bool collect) = 0;
+
+  /**
+   * Get the statistics of the loads done since their collection was enabled.
+   */
+  [[nodiscard]] virtual std::vector<load_statistics_t> getLoadStatistics() const = 0;
+
 protected:
   //! @cond
   scene() = default;
@@ -0,0 +1,167 @@
+#ifndef f3d_shared_mesh_view_h
+#define f3d_shared_mesh_view_h
+
+#include "exception.h"
+#include "export.h"
+#include "mesh_view.h"
+
+/// @cond
+#include <array>
+#include <cstdint>
+#include <string>
+/// @endcond
+
+namespace f3d
+{
+/**
+ * @class   shared_mesh_view
+ * @brief   mesh_view backed by a shared memory segment written by another process
+ *
+ * The shared_mesh_view maps a named shared memory segment read-only and exposes its arrays as a
+ * zero-copy mesh_view, so a separate process (a solver for example) can stream its meshes to
+ * f3d without serialization. The segment starts with a header_t, directly followed by
+ * `arrayCount` array_t descriptors, the array data being anywhere in the segment after them.
+ *
+ * The header `sequence` counter is used as a sequence lock: the producer makes it odd before
+ * updating the header or the descriptors and even again once done. Each call to getMemoryView
+ * waits for an even and stable counter. getFrameCounter returns the last even value of the
+ * counter, so a new frame is picked up by the next render once the producer released the header.
+ * Since arrays are not copied, the producer must write a new frame in a region not referenced by
+ * the current descriptors (double buffering) before pointing the descriptors to it.
+ *
+ * On Linux and macOS, the segment is opened with `shm_open`, on Windows it is a named file
+ * mapping opened with `OpenFileMapping`.
+ */
+class F3D_EXPORT shared_mesh_view : public mesh_view
+{
+public:
+  /**
+   * Expected value of header_t::magic ("F3DM" when read as little endian characters)
+   */
+  static constexpr uint32_t MAGIC = 0x4d443346;
+
+  /**
+   * Version of the layout described by header_t and array_t
+   */
+  static constexpr uint32_t LAYOUT_VERSION = 1;
+
+  /**
+   * Role of an array in the mesh, see mesh_view::memory_view_t
+   */
+  enum class array_role : uint8_t
+  {
+    POINTS,
+    NORMALS,
+    TEXTURE_COORDINATES,
+    VERTICES_OFFSETS,
+    VERTICES_INDICES,
+    LINES_OFFSETS,
+    LINES_INDICES,
+    POLYGONS_OFFSETS,
+    POLYGONS_INDICES,
+    POINT_SCALARS,
+    CELL_SCALARS
+  };
+
+  /**
+   * Header at the start of the segment.
+   * `size` is the number of bytes of the segment used by the producer.
+   * `pointCount` is the number of points of the mesh.
+   * `timeRange` is returned by getTimeRange, `name` by getName (null terminated).
+   */
+  struct header_t
+  {
+    uint32_t magic = MAGIC;
+    uint32_t version = LAYOUT_VERSION;
+    uint64_t sequence = 0;
+    uint64_t size = 0;
+    double timeRange[2] = { 0.0, 0.0 };
+    uint64_t pointCount = 0;
+    uint32_t arrayCount = 0;
+    uint32_t reserved = 0;
+    char name[64] = {};
+  };
+
+  /**
+   * Descriptor of an array.
+   * `offset` is in bytes from the start of the segment and must be aligned on the type size.
+   * `count` is the number of tuples for points and cell scalars arrays, the number of values for
+   * cell offsets and indices arrays.
+   * `stride` is in elements, 0 means tightly packed tuples.
+   * `type` is a mesh_view::data_type, `role` an array_role, `name` is null terminated.
+   */
+  struct array_t
+  {
+    char name[64] = {};
+    uint64_t offset = 0;
+    uint64_t count = 0;
+    uint32_t components = 1;
+    uint32_t stride = 0;
+    uint8_t role = 0;
+    uint8_t type = 0;
+    uint8_t timeDependent = 1;
+    uint8_t reserved[5] = {};
+  };
+
+  /**
+   * An exception that can be thrown when the shared memory segment cannot be opened or when its
+   * content is invalid.
+   */
+  struct shared_memory_exception : public exception
+  {
+    explicit shared_memory_exception(const std::string& what = "")
+      : exception(what) {};
+  };
+
+  /**
+   * Open and map read-only the shared memory segment with the given name.
+   * Throws a shared_memory_exception if the segment cannot be opened or mapped, or if its header
+   * is invalid.
+   */
+  explicit shared_mesh_view(const std::string& segmentName);
+  ~shared_mesh_view() override;
+
+  shared_mesh_view(const shared_mesh_view& other) = delete;
+  shared_mesh_view& operator=(const shared_mesh_view& other) = delete;
+
+  /**
+   * Get the time range stored in the header
+   */
+  [[nodiscard]] std::array<double, 2> getTimeRange() const override;
+
+  /**
+   * Get the name stored in the header
+   */
+  [[nodiscard]] std::string getName() const override;
+
+  /**
+   * Get a view of the last complete frame written in the segment, waiting for the producer to
+   * finish updating the header if needed.
+   * Throws a shared_memory_exception if the descriptors are invalid or if the producer did not
+   * release the header after a second.
+   */
+  [[nodiscard]] memory_view_t getMemoryView(double time) const override;
+
+  /**
+   * Get the last even value of the header sequence counter, which changes each time the producer
+   * publishes a new frame
+   */
+  [[nodiscard]] std::optional<uint64_t> getFrameCounter() const override;
+
+  /**
+   * Get the current value of the header sequence counter
+   */
+  [[nodiscard]] uint64_t getSequence() const;
+
+  /**
+   * Returns true if the sequence counter advanced since the last call to getMemoryView
+   */
+  [[nodiscard]] bool hasNewFrame() const;
+
+private:
+  class internals;
+  internals* Internals;
+};
+}
+
+#endif
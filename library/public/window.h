@@ -7,6 +7,8 @@
 
 /// @cond
 #include <string>
+#include <utility>
+#include <vector>
 /// @endcond
 
 namespace f3d
@@ -77,6 +79,16 @@ public:
    */
   [[nodiscard]] virtual image renderToImage(bool noBackground = false) = 0;
 
+  /**
+   * Render the window once for each provided camera state and return the resulting images,
+   * in the same order, like renderToImage would.
+   * Dynamic options are updated once for all the views and each view is rendered only once,
+   * which is faster than calling camera::setState and renderToImage for each view.
+   * The camera state is restored after rendering.
+   */
+  [[nodiscard]] virtual std::vector<image> renderViews(
+    const std::vector<camera_state_t>& views, bool noBackground = false) = 0;
+
   /**
    * Set the size of the window.
    */
@@ -119,6 +131,41 @@ public:
    */
   [[nodiscard]] virtual point3_t getDisplayFromWorld(const point3_t& worldPoint) const = 0;
 
+  /**
+   * Statistics of a rendered frame, times are in milliseconds.
+   * gpuTime is negative and passTimes is empty when GPU timer queries are not supported.
+   * passTimes contains the GPU time of each render pass of the frame, in rendering order.
+   * gpuMemory is the device memory in use in MiB, negative when the driver does not provide it.
+   * frustumCulledActors and occlusionCulledActors are the number of actors skipped by the
+   * render.culling option, outside of the camera frustum or hidden by other actors.
+   * interactiveEffectsDisabled is true when the expensive effects were skipped to reach the
+   * interactor.target_frame_time option while interacting, and interactiveProxyActors is the
+   * number of actors replaced by decimated proxies for the same reason.
+   */
+  struct frame_statistics_t
+  {
+    double cpuTime = 0.0;
+    double gpuTime = -1.0;
+    std::vector<std::pair<std::string, double>> passTimes;
+    double gpuMemory = -1.0;
+    int frustumCulledActors = 0;
+    int occlusionCulledActors = 0;
+    bool interactiveEffectsDisabled = false;
+    int interactiveProxyActors = 0;
+  };
+
+  /**
+   * Enable or disable the collection of statistics for each rendered frame, including the
+   * frames rendered by the interactor. Enabling it clears the previously collected statistics.
+   * Collecting statistics waits for the GPU after each render pass, which slows down rendering.
+   */
+  virtual window& setCollectFrameStatistics(bool collect) = 0;
+
+  /**
+   * Get the statistics of the frames rendered since their collection was enabled.
+   */
+  [[nodiscard]] virtual std::vector<frame_statistics_t> getFrameStatistics() const = 0;
+
 protected:
   //! @cond
   window() = default;
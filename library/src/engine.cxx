@@ -5,6 +5,7 @@
 #include "init.h"
 #include "interactor_impl.h"
 #include "log.h"
+#include "manifest_reader.h"
 #include "scene_impl.h"
 #include "statefile.h"
 #include "utils.h"
@@ -75,6 +76,75 @@ void ResolveFiles(nlohmann::ordered_json& root, const fs::path& baseDir)
     }
   }
 }
+
+//----------------------------------------------------------------------------
+// Register a plugin from the manifest generated next to its library, without opening the library.
+// It is opened by the factory when one of the plugin readers is selected to read a file.
+// Returns false if there is no usable manifest, the plugin must then be loaded directly.
+bool LoadPluginManifest(const std::string& pathOrName, const std::vector<fs::path>& searchPaths)
+{
+  std::vector<fs::path> candidates;
+  fs::path fullPath = f3d::utils::collapsePath(pathOrName);
+  if (fs::exists(fullPath))
+  {
+    candidates.emplace_back(fullPath);
+  }
+  else
+  {
+    std::string libName = vtksys::DynamicLoader::LibPrefix();
+    libName += "f3d-plugin-";
+    libName += pathOrName;
+    libName += vtksys::DynamicLoader::LibExtension();
+    for (const fs::path& searchPath : searchPaths)
+    {
+      candidates.emplace_back(searchPath / libName);
+    }
+  }
+
+  for (const fs::path& libraryPath : candidates)
+  {
+    fs::path manifestPath = libraryPath;
+    manifestPath.replace_extension(".json");
+    if (!fs::exists(libraryPath) || !fs::exists(manifestPath))
+    {
+      continue;
+    }
+
+    std::unique_ptr<f3d::plugin> plug = f3d::manifest_reader::createPlugin(manifestPath);
+    if (!plug)
+    {
+      return false;
+    }
+
+    plug->setOrigin(libraryPath.string());
+    f3d::log::debug("Registered plugin ", plug->getName(), " from manifest: \"",
+      manifestPath.string(), "\"");
+
+    f3d::factory::instance()->loadLazy(std::move(plug),
+      [libraryPath = libraryPath.string()]()
+      {
+        f3d::log::debug("Loading plugin library: \"", libraryPath, "\"");
+        vtksys::DynamicLoader::LibraryHandle handle =
+          vtksys::DynamicLoader::OpenLibrary(libraryPath);
+        if (!handle)
+        {
+          throw f3d::engine::plugin_exception("Cannot open the library \"" + libraryPath +
+            "\": " + vtksys::DynamicLoader::LastError());
+        }
+
+        auto init_plugin = reinterpret_cast<f3d::factory::plugin_initializer_t>(
+          vtksys::DynamicLoader::GetSymbolAddress(handle, "init_plugin"));
+        if (init_plugin == nullptr)
+        {
+          throw f3d::engine::plugin_exception("Cannot find init_plugin symbol in library \"" +
+            libraryPath + "\": " + vtksys::DynamicLoader::LastError());
+        }
+        return init_plugin();
+      });
+    return true;
+  }
+  return false;
+}
 }
 
 namespace f3d
@@ -529,6 +599,11 @@ void engine::loadPlugin(const std::string& pathOrName, const std::vector<fs::pat
     vtksys::DynamicLoader::LibraryHandle handle = nullptr;
     try
     {
+      if (::LoadPluginManifest(pathOrName, searchPaths))
+      {
+        return;
+      }
+
       fs::path fullPath = utils::collapsePath(pathOrName);
       if (fs::exists(fullPath))
       {
@@ -695,6 +770,18 @@ engine::libInformation engine::getLibInfo()
   libInfo.Modules["OpenEXR"] = false;
 #endif
 
+#if F3D_MODULE_KTX
+  libInfo.Modules["KTX"] = true;
+#else
+  libInfo.Modules["KTX"] = false;
+#endif
+
+#if F3D_MODULE_MESHOPT
+  libInfo.Modules["Meshopt"] = true;
+#else
+  libInfo.Modules["Meshopt"] = false;
+#endif
+
 #if F3D_MODULE_WEBP
   libInfo.Modules["WebP"] = true;
 #else
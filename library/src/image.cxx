@@ -22,6 +22,10 @@
 #include <vtkVersion.h>
 #include <vtksys/SystemTools.hxx>
 
+#if F3D_MODULE_KTX
+#include "vtkF3DKTXReader.h"
+#endif
+
 #include <algorithm>
 #include <cassert>
 #include <regex>
@@ -191,6 +195,14 @@ image::image(const fs::path& filePath)
     if (reader)
     {
       reader->SetFileName(filePath.string().c_str());
+#if F3D_MODULE_KTX
+      // images need the decoded pixels, unlike textures
+      vtkF3DKTXReader* ktxReader = vtkF3DKTXReader::SafeDownCast(reader);
+      if (ktxReader != nullptr)
+      {
+        ktxReader->DeferTranscodingOff();
+      }
+#endif
       reader->Update();
       this->Internals->Image = reader->GetOutput();
 
@@ -8,6 +8,10 @@
 #include "vtkF3DEXRReader.h"
 #endif
 
+#if F3D_MODULE_KTX
+#include "vtkF3DKTXReader.h"
+#endif
+
 #if F3D_MODULE_WEBP
 #include "vtkF3DWebPReader.h"
 #endif
@@ -47,6 +51,9 @@ init::init()
   vtkObjectFactory::RegisterFactory(factory);
   vtkObjectFactory::SetAllEnableFlags(0, "vtkPolyDataMapper", "vtkOpenGLPolyDataMapper");
   vtkObjectFactory::SetAllEnableFlags(0, "vtkPointGaussianMapper", "vtkOpenGLPointGaussianMapper");
+#if F3D_MODULE_KTX
+  vtkObjectFactory::SetAllEnableFlags(0, "vtkTexture", "vtkOpenGLTexture");
+#endif
 
 #ifdef __EMSCRIPTEN__
   vtkObjectFactory::SetAllEnableFlags(0, "vtkRenderWindow", "vtkOpenGLRenderWindow");
@@ -59,6 +66,11 @@ init::init()
   vtkImageReader2Factory::RegisterReader(exrReader);
 #endif
 
+#if F3D_MODULE_KTX
+  vtkNew<vtkF3DKTXReader> ktxReader;
+  vtkImageReader2Factory::RegisterReader(ktxReader);
+#endif
+
 #if F3D_MODULE_WEBP
   vtkNew<vtkF3DWebPReader> webpReader;
   vtkImageReader2Factory::RegisterReader(webpReader);
@@ -625,6 +625,18 @@ public:
     // At the moment, only TAA requires a full render each frame
     bool forceRender = this->Options.render.effect.antialiasing.mode == "taa";
 
+    // Restore full quality rendering once the interaction is over
+    if (this->Style->RefineRendering())
+    {
+      this->RenderRequested = true;
+    }
+
+    // Display the props uncovered by the last frame once its occlusion queries are completed
+    if (ren->HasDisoccludedProps(false))
+    {
+      this->RenderRequested = true;
+    }
+
     if (this->RenderRequested || forceRender)
     {
       this->Window.render();
@@ -2026,6 +2038,11 @@ bool interactor_impl::playInteraction(const fs::path& file, double loopTime)
     this->Internals->Recorder->SetFileName(file.string().c_str());
     this->Internals->Recorder->Play();
 
+    if (this->Internals->Style->RefineRendering(true))
+    {
+      this->Internals->Window.render();
+    }
+
     if (loop)
     {
       this->Internals->StopEventLoop();
@@ -0,0 +1,103 @@
+#include "manifest_reader.h"
+
+#include "log.h"
+
+#include <vtkResourceStream.h>
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+
+namespace f3d
+{
+namespace
+{
+//----------------------------------------------------------------------------
+std::string ParseMagic(const std::string& hex)
+{
+  if (hex.empty() || hex.size() % 2 != 0)
+  {
+    throw std::invalid_argument("invalid magic bytes \"" + hex + "\"");
+  }
+
+  std::string bytes;
+  for (size_t i = 0; i < hex.size(); i += 2)
+  {
+    size_t parsed = 0;
+    bytes.push_back(static_cast<char>(std::stoi(hex.substr(i, 2), &parsed, 16)));
+    if (parsed != 2)
+    {
+      throw std::invalid_argument("invalid magic bytes \"" + hex + "\"");
+    }
+  }
+  return bytes;
+}
+}
+
+//----------------------------------------------------------------------------
+std::unique_ptr<plugin> manifest_reader::createPlugin(const std::filesystem::path& manifestPath)
+{
+  try
+  {
+    auto root = nlohmann::json::parse(std::ifstream(manifestPath));
+
+    std::vector<std::shared_ptr<reader>> readers;
+    for (const auto& entry : root.at("readers"))
+    {
+      auto read = std::make_shared<manifest_reader>();
+      read->Name = entry.at("name").get<std::string>();
+      read->Description = entry.value("description", "");
+      read->Extensions = entry.at("extensions").get<std::vector<std::string>>();
+      read->MimeTypes = entry.value("mimetypes", std::vector<std::string>());
+      read->Score = entry.value("score", 50);
+      read->FullScene = entry.value("full_scene", false);
+      read->SupportsStream = entry.value("supports_stream", false);
+
+      for (const std::string& magic : entry.value("magic", std::vector<std::string>()))
+      {
+        read->Magics.emplace_back(ParseMagic(magic));
+      }
+
+      for (const std::string& option : entry.value("options", std::vector<std::string>()))
+      {
+        read->ReaderOptions[option] = "";
+      }
+
+      readers.emplace_back(std::move(read));
+    }
+
+    return std::make_unique<plugin>(root.at("name").get<std::string>(),
+      root.value("description", ""), root.value("version", ""), readers);
+  }
+  catch (const std::exception& ex)
+  {
+    log::debug("Cannot use plugin manifest ", manifestPath, ": ", ex.what());
+    return nullptr;
+  }
+}
+
+//----------------------------------------------------------------------------
+bool manifest_reader::canRead(vtkResourceStream* stream) const
+{
+  if (this->Magics.empty())
+  {
+    return true;
+  }
+
+  size_t length = 0;
+  for (const std::string& magic : this->Magics)
+  {
+    length = std::max(length, magic.size());
+  }
+
+  std::string header(length, '\0');
+  stream->Seek(0, vtkResourceStream::SeekDirection::Begin);
+  header.resize(stream->Read(header.data(), length));
+  stream->Seek(0, vtkResourceStream::SeekDirection::Begin);
+
+  return std::ranges::any_of(
+    this->Magics, [&](const std::string& magic) { return header.starts_with(magic); });
+}
+}
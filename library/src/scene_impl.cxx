@@ -36,6 +36,7 @@
 #include <vtkStridedArray.h>
 #endif
 
+#include <chrono>
 #include <numeric>
 #include <vector>
 
@@ -137,6 +138,9 @@ public:
         &callbackData, this->MetaImporter, this->Interactor, color);
     }
 
+    using clock = std::chrono::steady_clock;
+    const auto loadStart = clock::now();
+
     // Update the meta importer, the will only update importers that have not been updated before
     if (!this->MetaImporter->Update())
     {
@@ -152,6 +156,14 @@ public:
     this->MetaImporter->RemoveObservers(vtkCommand::ProgressEvent);
     progressWidget->Off();
 
+    // Coloring information is gathered by the first render, unless its cost is measured
+    const auto coloringStart = clock::now();
+    if (this->CollectLoadStatistics)
+    {
+      this->MetaImporter->GetColoringInfoHandler();
+    }
+    const auto coloringEnd = clock::now();
+
     // Initialize the animation using temporal information from the importer
     this->AnimationManager.UpdateDynamicOptions();
     this->AnimationManager.Initialize();
@@ -166,6 +178,18 @@ public:
     // Set the camera index domain
     this->Options.domains.scene.camera.index.max = this->MetaImporter->GetNumberOfCameras();
 
+    // Record the time spent in each loading stage, in milliseconds
+    if (this->CollectLoadStatistics)
+    {
+      auto toMs = [](clock::duration duration)
+      { return std::chrono::duration<double, std::milli>(duration).count(); };
+      scene::load_statistics_t& stats = this->LoadStatistics.emplace_back();
+      stats.readerTime = this->MetaImporter->GetImportersUpdateDuration() * 1000.0;
+      stats.coloringInfoTime = toMs(coloringEnd - coloringStart);
+      stats.postProcessTime =
+        toMs(clock::now() - loadStart) - stats.readerTime - stats.coloringInfoTime;
+    }
+
     scene_impl::internals::DisplayAllInfo(this->MetaImporter, this->Window);
   }
 
@@ -208,6 +232,9 @@ public:
 
   vtkNew<vtkF3DMetaImporter> MetaImporter;
   std::vector<fs::path> AddedFiles;
+
+  bool CollectLoadStatistics = false;
+  std::vector<scene::load_statistics_t> LoadStatistics;
 };
 
 //----------------------------------------------------------------------------
@@ -258,7 +285,7 @@ scene& scene_impl::add(const std::vector<fs::path>& filePaths)
     }
     std::optional<std::string> forceReader = this->Internals->Options.scene.force_reader;
     // Recover the importer for the provided file path
-    const f3d::reader* reader = f3d::factory::instance()->getReader(filePath.string(), forceReader);
+    f3d::reader* reader = f3d::factory::instance()->getReader(filePath.string(), forceReader);
     if (reader)
     {
       if (forceReader)
@@ -281,6 +308,7 @@ scene& scene_impl::add(const std::vector<fs::path>& filePaths)
         "reader");
     }
 
+    reader->setColoringArrayName(this->Internals->Options.model.scivis.array_name.value_or(""));
     vtkSmartPointer<vtkImporter> importer = reader->createSceneReader(filePath.string());
     if (!importer)
     {
@@ -335,7 +363,7 @@ scene& scene_impl::add(const std::byte* buffer, std::size_t size)
   }
 #endif
 
-  const f3d::reader* reader = f3d::factory::instance()->getReader(buffer, size, forceReader);
+  f3d::reader* reader = f3d::factory::instance()->getReader(buffer, size, forceReader);
   if (reader)
   {
     if (forceReader)
@@ -360,6 +388,7 @@ scene& scene_impl::add(const std::byte* buffer, std::size_t size)
   vtkNew<vtkMemoryResourceStream> stream;
   stream->SetBuffer(buffer, size);
 
+  reader->setColoringArrayName(this->Internals->Options.model.scivis.array_name.value_or(""));
   vtkSmartPointer<vtkImporter> importer = reader->createSceneReader(stream);
   if (!importer)
   {
@@ -471,6 +500,15 @@ scene& scene_impl::add([[maybe_unused]] std::shared_ptr<mesh_view> mesh)
   auto timeRange = mesh->getTimeRange();
   vtkSource->SetTimeRange(timeRange[0], timeRange[1]);
 
+  // New versions of the mesh are picked up by the next render
+  if (mesh->getFrameCounter().has_value())
+  {
+    vtkSource->SetFrameCounterFunction([=]() { return mesh->getFrameCounter().value_or(0); });
+  }
+
+  // Views of the previous update, used to check if arrays can be updated in place
+  auto previousView = std::make_shared<mesh_view::memory_view_t>();
+
   vtkSource->SetUpdateFunction(
     [=](double time, vtkPolyData* polydata)
     {
@@ -480,6 +518,31 @@ scene& scene_impl::add([[maybe_unused]] std::shared_ptr<mesh_view> mesh)
 
       f3d::log::debug(firstTime ? "Initializing" : "Updating", " mesh_view at time ", time);
 
+      // An array is updated in place if it provides modified ranges and still points to the same
+      // memory, in which case only the modified ranges are uploaded to the GPU
+      auto updateInPlace = [&](const mesh_view::data_array_t& current,
+                             const mesh_view::data_array_t& previous, vtkDataArray* existing)
+      {
+        if (firstTime || !existing || current.dirtyRanges.empty() ||
+          memoryView.pointCount != previousView->pointCount || current.data != previous.data ||
+          current.type != previous.type || current.stride != previous.stride ||
+          current.components != previous.components)
+        {
+          return false;
+        }
+
+        for (const auto& [begin, end] : current.dirtyRanges)
+        {
+          if (begin > end || end > memoryView.pointCount)
+          {
+            throw scene::load_failure_exception("Mesh view dirty range is out of bounds");
+          }
+        }
+
+        vtkF3DMemoryMesh::MarkModifiedRanges(existing, current.dirtyRanges);
+        return true;
+      };
+
       // handle points
       if (memoryView.pointCount == 0)
       {
@@ -502,7 +565,9 @@ scene& scene_impl::add([[maybe_unused]] std::shared_ptr<mesh_view> mesh)
         throw scene::load_failure_exception("Mesh view points must have 3 components");
       }
 
-      if (firstTime || memoryView.points.timeDependent)
+      if ((firstTime || memoryView.points.timeDependent) &&
+        !updateInPlace(memoryView.points, previousView->points,
+          firstTime ? nullptr : polydata->GetPoints()->GetData()))
       {
         vtkNew<vtkPoints> points;
 
@@ -538,19 +603,23 @@ scene& scene_impl::add([[maybe_unused]] std::shared_ptr<mesh_view> mesh)
           throw scene::load_failure_exception("Mesh view normals must have 3 components");
         }
 
-        f3d::mesh_view::dataTypeDispatch(memoryView.normals.type,
-          [&]<typename DataT>()
-          {
-            vtkNew<vtkStridedArray<DataT>> normals;
-            normals->SetName(
-              memoryView.normals.name.empty() ? "Normals" : memoryView.normals.name.c_str());
-            normals->SetNumberOfComponents(3);
-            normals->SetNumberOfTuples(memoryView.pointCount);
-            normals->ConstructBackend(reinterpret_cast<const DataT*>(memoryView.normals.data),
-              memoryView.normals.stride, 3);
-
-            polydata->GetPointData()->SetNormals(normals);
-          });
+        if (!updateInPlace(
+              memoryView.normals, previousView->normals, polydata->GetPointData()->GetNormals()))
+        {
+          f3d::mesh_view::dataTypeDispatch(memoryView.normals.type,
+            [&]<typename DataT>()
+            {
+              vtkNew<vtkStridedArray<DataT>> normals;
+              normals->SetName(
+                memoryView.normals.name.empty() ? "Normals" : memoryView.normals.name.c_str());
+              normals->SetNumberOfComponents(3);
+              normals->SetNumberOfTuples(memoryView.pointCount);
+              normals->ConstructBackend(reinterpret_cast<const DataT*>(memoryView.normals.data),
+                memoryView.normals.stride, 3);
+
+              polydata->GetPointData()->SetNormals(normals);
+            });
+        }
       }
 
       // handle texture coordinates if provided
@@ -570,21 +639,25 @@ scene& scene_impl::add([[maybe_unused]] std::shared_ptr<mesh_view> mesh)
             "Mesh view texture coordinates must have 2 components");
         }
 
-        f3d::mesh_view::dataTypeDispatch(memoryView.textureCoordinates.type,
-          [&]<typename DataT>()
-          {
-            vtkNew<vtkStridedArray<DataT>> tcoords;
-            tcoords->SetName(memoryView.textureCoordinates.name.empty()
-                ? "TCoords"
-                : memoryView.textureCoordinates.name.c_str());
-            tcoords->SetNumberOfComponents(2);
-            tcoords->SetNumberOfTuples(memoryView.pointCount);
-            tcoords->ConstructBackend(
-              reinterpret_cast<const DataT*>(memoryView.textureCoordinates.data),
-              memoryView.textureCoordinates.stride, 2);
-
-            polydata->GetPointData()->SetTCoords(tcoords);
-          });
+        if (!updateInPlace(memoryView.textureCoordinates, previousView->textureCoordinates,
+              polydata->GetPointData()->GetTCoords()))
+        {
+          f3d::mesh_view::dataTypeDispatch(memoryView.textureCoordinates.type,
+            [&]<typename DataT>()
+            {
+              vtkNew<vtkStridedArray<DataT>> tcoords;
+              tcoords->SetName(memoryView.textureCoordinates.name.empty()
+                  ? "TCoords"
+                  : memoryView.textureCoordinates.name.c_str());
+              tcoords->SetNumberOfComponents(2);
+              tcoords->SetNumberOfTuples(memoryView.pointCount);
+              tcoords->ConstructBackend(
+                reinterpret_cast<const DataT*>(memoryView.textureCoordinates.data),
+                memoryView.textureCoordinates.stride, 2);
+
+              polydata->GetPointData()->SetTCoords(tcoords);
+            });
+        }
       }
 
       // handle scalars if provided
@@ -724,6 +797,8 @@ scene& scene_impl::add([[maybe_unused]] std::shared_ptr<mesh_view> mesh)
       {
         polydata->SetPolys(handleCells(memoryView.polygons));
       }
+
+      *previousView = memoryView;
     });
 
   try
@@ -881,6 +956,20 @@ scene& scene_impl::loadAnimationTime(double timeValue)
   return *this;
 }
 
+//----------------------------------------------------------------------------
+scene& scene_impl::setCollectLoadStatistics(bool collect)
+{
+  this->Internals->CollectLoadStatistics = collect;
+  this->Internals->LoadStatistics.clear();
+  return *this;
+}
+
+//----------------------------------------------------------------------------
+std::vector<scene::load_statistics_t> scene_impl::getLoadStatistics() const
+{
+  return this->Internals->LoadStatistics;
+}
+
 //----------------------------------------------------------------------------
 std::pair<double, double> scene_impl::animationTimeRange()
 {
@@ -0,0 +1,342 @@
+#include "shared_mesh_view.h"
+
+#include "log.h"
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static_assert(sizeof(f3d::shared_mesh_view::header_t) == 120, "Unexpected header_t size");
+static_assert(sizeof(f3d::shared_mesh_view::array_t) == 96, "Unexpected array_t size");
+
+namespace f3d
+{
+class shared_mesh_view::internals
+{
+public:
+  const std::byte* Data = nullptr;
+  size_t Size = 0;
+  mutable uint64_t LastSequence = 0;
+#ifdef _WIN32
+  HANDLE Mapping = nullptr;
+#endif
+
+  void Unmap()
+  {
+#ifdef _WIN32
+    UnmapViewOfFile(this->Data);
+    CloseHandle(this->Mapping);
+#else
+    munmap(const_cast<std::byte*>(this->Data), this->Size);
+#endif
+    this->Data = nullptr;
+  }
+
+  const header_t* Header() const
+  {
+    return reinterpret_cast<const header_t*>(this->Data);
+  }
+
+  uint64_t ReadSequence() const
+  {
+    // the mapping is read-only, use a volatile read and a fence instead of an atomic load
+    const auto* counter = reinterpret_cast<const volatile uint64_t*>(&this->Header()->sequence);
+    const uint64_t sequence = *counter;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return sequence;
+  }
+
+  // Copy the header and the descriptors of a complete frame
+  uint64_t ReadDescriptors(header_t& header, std::vector<array_t>& arrays) const
+  {
+    using namespace std::chrono_literals;
+    const auto deadline = std::chrono::steady_clock::now() + 1s;
+
+    while (true)
+    {
+      const uint64_t before = this->ReadSequence();
+      if (before % 2 == 0)
+      {
+        std::memcpy(&header, this->Data, sizeof(header_t));
+        const size_t maxArrays = (this->Size - sizeof(header_t)) / sizeof(array_t);
+        if (header.arrayCount > maxArrays)
+        {
+          throw shared_memory_exception("Shared mesh array count exceeds the segment size");
+        }
+        arrays.resize(header.arrayCount);
+        std::memcpy(
+          arrays.data(), this->Data + sizeof(header_t), header.arrayCount * sizeof(array_t));
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (this->ReadSequence() == before)
+        {
+          return before;
+        }
+      }
+
+      if (std::chrono::steady_clock::now() > deadline)
+      {
+        throw shared_memory_exception("Timeout while waiting for the shared mesh producer");
+      }
+      std::this_thread::yield();
+    }
+  }
+
+  // Convert a descriptor into a data array view pointing into the mapping
+  mesh_view::data_array_t ToDataArray(const array_t& array, size_t tupleCount) const
+  {
+    if (array.type > static_cast<uint8_t>(mesh_view::data_type::F64))
+    {
+      throw shared_memory_exception("Shared mesh array has an invalid data type");
+    }
+
+    mesh_view::data_array_t dataArray;
+    dataArray.name = std::string(array.name, strnlen(array.name, sizeof(array.name)));
+    dataArray.type = static_cast<mesh_view::data_type>(array.type);
+    dataArray.components = array.components;
+    dataArray.stride = array.stride == 0 ? array.components : array.stride;
+    dataArray.timeDependent = array.timeDependent != 0;
+
+    const size_t typeSize = mesh_view::dataTypeDispatch(
+      dataArray.type, []<typename DataT>() { return sizeof(DataT); });
+
+    if (array.components == 0 || dataArray.stride < array.components)
+    {
+      throw shared_memory_exception("Shared mesh array has an invalid stride");
+    }
+
+    if (array.offset % typeSize != 0)
+    {
+      throw shared_memory_exception("Shared mesh array offset is not aligned");
+    }
+
+    // check the last tuple is inside the segment, without overflowing
+    const size_t available = this->Size > array.offset ? this->Size - array.offset : 0;
+    const size_t maxElements = available / typeSize;
+    if (tupleCount > 0 &&
+      (array.components > maxElements ||
+        tupleCount - 1 > (maxElements - array.components) / dataArray.stride))
+    {
+      throw shared_memory_exception(
+        "Shared mesh array \"" + dataArray.name + "\" exceeds the segment size");
+    }
+
+    dataArray.data = this->Data + array.offset;
+    return dataArray;
+  }
+};
+
+//----------------------------------------------------------------------------
+shared_mesh_view::shared_mesh_view(const std::string& segmentName)
+  : Internals(new shared_mesh_view::internals())
+{
+  // release the internals if the segment cannot be mapped
+  std::unique_ptr<internals> guard(this->Internals);
+
+#ifdef _WIN32
+  this->Internals->Mapping = OpenFileMappingA(FILE_MAP_READ, FALSE, segmentName.c_str());
+  if (!this->Internals->Mapping)
+  {
+    throw shared_memory_exception("Cannot open shared memory segment " + segmentName);
+  }
+
+  void* data = MapViewOfFile(this->Internals->Mapping, FILE_MAP_READ, 0, 0, 0);
+  MEMORY_BASIC_INFORMATION info;
+  if (!data || VirtualQuery(data, &info, sizeof(info)) == 0)
+  {
+    if (data)
+    {
+      UnmapViewOfFile(data);
+    }
+    CloseHandle(this->Internals->Mapping);
+    throw shared_memory_exception("Cannot map shared memory segment " + segmentName);
+  }
+  this->Internals->Data = static_cast<const std::byte*>(data);
+  this->Internals->Size = info.RegionSize;
+#else
+  int fd = shm_open(segmentName.c_str(), O_RDONLY, 0);
+  if (fd < 0)
+  {
+    throw shared_memory_exception(
+      "Cannot open shared memory segment " + segmentName + ": " + std::strerror(errno));
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(header_t)))
+  {
+    close(fd);
+    throw shared_memory_exception("Shared memory segment " + segmentName + " is too small");
+  }
+
+  void* data = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED)
+  {
+    throw shared_memory_exception(
+      "Cannot map shared memory segment " + segmentName + ": " + std::strerror(errno));
+  }
+  this->Internals->Data = static_cast<const std::byte*>(data);
+  this->Internals->Size = static_cast<size_t>(st.st_size);
+#endif
+
+  const header_t* header = this->Internals->Header();
+  if (this->Internals->Size < sizeof(header_t) || header->magic != MAGIC ||
+    header->version != LAYOUT_VERSION)
+  {
+    this->Internals->Unmap();
+    throw shared_memory_exception(
+      "Shared memory segment " + segmentName + " does not contain a shared mesh");
+  }
+
+  guard.release();
+
+  log::debug("Mapped shared mesh segment ", segmentName, " (", this->Internals->Size, " bytes)");
+}
+
+//----------------------------------------------------------------------------
+shared_mesh_view::~shared_mesh_view()
+{
+  this->Internals->Unmap();
+  delete this->Internals;
+}
+
+//----------------------------------------------------------------------------
+std::array<double, 2> shared_mesh_view::getTimeRange() const
+{
+  header_t header;
+  std::vector<array_t> arrays;
+  this->Internals->ReadDescriptors(header, arrays);
+  return { header.timeRange[0], header.timeRange[1] };
+}
+
+//----------------------------------------------------------------------------
+std::string shared_mesh_view::getName() const
+{
+  header_t header;
+  std::vector<array_t> arrays;
+  this->Internals->ReadDescriptors(header, arrays);
+  return std::string(header.name, strnlen(header.name, sizeof(header.name)));
+}
+
+//----------------------------------------------------------------------------
+mesh_view::memory_view_t shared_mesh_view::getMemoryView(double) const
+{
+  header_t header;
+  std::vector<array_t> arrays;
+  this->Internals->LastSequence = this->Internals->ReadDescriptors(header, arrays);
+
+  if (header.size > this->Internals->Size)
+  {
+    throw shared_memory_exception("Shared mesh size exceeds the mapped segment size");
+  }
+
+  // cell scalars have one tuple per cell, computed from the cell offsets
+  size_t cellCount = 0;
+  for (const array_t& array : arrays)
+  {
+    const auto role = static_cast<array_role>(array.role);
+    if ((role == array_role::VERTICES_OFFSETS || role == array_role::LINES_OFFSETS ||
+          role == array_role::POLYGONS_OFFSETS) &&
+      array.count > 0)
+    {
+      cellCount += array.count - 1;
+    }
+  }
+
+  memory_view_t view;
+  view.pointCount = header.pointCount;
+
+  auto setCells = [&](cell_array_t& cells, const array_t& array, bool offsets)
+  {
+    if (offsets)
+    {
+      cells.offsetCount = array.count;
+      cells.offsets = this->Internals->ToDataArray(array, array.count);
+    }
+    else
+    {
+      cells.indexCount = array.count;
+      cells.indices = this->Internals->ToDataArray(array, array.count);
+    }
+  };
+
+  for (const array_t& array : arrays)
+  {
+    switch (static_cast<array_role>(array.role))
+    {
+      case array_role::POINTS:
+        view.points = this->Internals->ToDataArray(array, header.pointCount);
+        break;
+      case array_role::NORMALS:
+        view.normals = this->Internals->ToDataArray(array, header.pointCount);
+        break;
+      case array_role::TEXTURE_COORDINATES:
+        view.textureCoordinates = this->Internals->ToDataArray(array, header.pointCount);
+        break;
+      case array_role::VERTICES_OFFSETS:
+        setCells(view.vertices, array, true);
+        break;
+      case array_role::VERTICES_INDICES:
+        setCells(view.vertices, array, false);
+        break;
+      case array_role::LINES_OFFSETS:
+        setCells(view.lines, array, true);
+        break;
+      case array_role::LINES_INDICES:
+        setCells(view.lines, array, false);
+        break;
+      case array_role::POLYGONS_OFFSETS:
+        setCells(view.polygons, array, true);
+        break;
+      case array_role::POLYGONS_INDICES:
+        setCells(view.polygons, array, false);
+        break;
+      case array_role::POINT_SCALARS:
+        view.pointScalars.emplace_back(this->Internals->ToDataArray(array, header.pointCount));
+        break;
+      case array_role::CELL_SCALARS:
+        view.cellScalars.emplace_back(this->Internals->ToDataArray(array, cellCount));
+        break;
+      default:
+        throw shared_memory_exception("Shared mesh array has an invalid role");
+    }
+  }
+
+  return view;
+}
+
+//----------------------------------------------------------------------------
+std::optional<uint64_t> shared_mesh_view::getFrameCounter() const
+{
+  // an odd counter means the producer is writing the frame after the previous even value
+  return this->Internals->ReadSequence() & ~uint64_t(1);
+}
+
+//----------------------------------------------------------------------------
+uint64_t shared_mesh_view::getSequence() const
+{
+  return this->Internals->ReadSequence();
+}
+
+//----------------------------------------------------------------------------
+bool shared_mesh_view::hasNewFrame() const
+{
+  return this->Internals->ReadSequence() != this->Internals->LastSequence;
+}
+}
@@ -375,6 +375,28 @@ point3_t window_impl::getDisplayFromWorld(const point3_t& worldPoint) const
   return out;
 }
 
+//----------------------------------------------------------------------------
+window& window_impl::setCollectFrameStatistics(bool collect)
+{
+  this->Internals->Renderer->SetCollectFrameStatistics(collect);
+  return *this;
+}
+
+//----------------------------------------------------------------------------
+std::vector<window::frame_statistics_t> window_impl::getFrameStatistics() const
+{
+  std::vector<frame_statistics_t> statistics;
+  for (const vtkF3DRenderer::FrameStatistics& frame :
+    this->Internals->Renderer->GetFrameStatistics())
+  {
+    statistics.emplace_back(
+      frame_statistics_t{ frame.CPUTime, frame.GPUTime, frame.PassTimes, frame.GPUMemory,
+        frame.FrustumCulledProps, frame.OcclusionCulledProps, frame.InteractiveEffectsDisabled,
+        frame.InteractiveProxyProps });
+  }
+  return statistics;
+}
+
 //----------------------------------------------------------------------------
 window_impl::~window_impl()
 {
@@ -494,6 +516,7 @@ void window_impl::UpdateDynamicOptions()
     renderer->ShowAxis(opt.ui.axis);
     renderer->SetInvertZoom(opt.interactor.invert_zoom);
     renderer->SetInteractionStyle(opt.interactor.style);
+    renderer->SetInteractiveTargetFrameTime(opt.interactor.target_frame_time);
 
 #if F3D_MODULE_UI
     std::string bindsStr = opt.ui.drop_zone.custom_binds;
@@ -590,6 +613,10 @@ void window_impl::UpdateDynamicOptions()
   {
     blendMode = vtkF3DRenderer::BlendingMode::STOCHASTIC;
   }
+  else if (opt.render.effect.blending.mode == "weighted")
+  {
+    blendMode = vtkF3DRenderer::BlendingMode::WEIGHTED;
+  }
   else if (opt.render.effect.blending.mode == "none")
   {
     blendMode = vtkF3DRenderer::BlendingMode::NONE;
@@ -597,7 +624,7 @@ void window_impl::UpdateDynamicOptions()
   else
   {
     log::warn(opt.render.effect.blending.mode,
-      R"( is an invalid blending mode. Valid modes are: "none", "ddp", "sort", "sort_cpu", "stochastic")");
+      R"( is an invalid blending mode. Valid modes are: "none", "ddp", "sort", "sort_cpu", "stochastic", "weighted")");
   }
 
   renderer->SetUseSSAOPass(opt.render.effect.ambient_occlusion);
@@ -607,6 +634,8 @@ void window_impl::UpdateDynamicOptions()
   renderer->SetBlendingMode(blendMode);
   renderer->SetBackfaceType(opt.render.backface_type);
   renderer->SetFinalShader(opt.render.effect.final_shader);
+  renderer->SetUseCulling(opt.render.culling);
+  renderer->SetUseTextureCache(opt.render.texture_cache);
 
   renderer->SetBackground(opt.render.background.color.data());
   renderer->SetUseBlurBackground(opt.render.background.blur.enable);
@@ -743,6 +772,16 @@ bool window_impl::render()
     this->Internals->Camera->resetToBounds();
   }
   this->Internals->RenWin->Render();
+
+  // A prop uncovered since the last occlusion queries is culled from this frame,
+  // still frames wait for the new queries and are rendered again to display it
+  vtkRenderWindowInteractor* iren = this->Internals->RenWin->GetInteractor();
+  const bool still =
+    !iren || this->Internals->RenWin->GetDesiredUpdateRate() <= iren->GetStillUpdateRate();
+  if (still && this->Internals->Renderer->HasDisoccludedProps(true))
+  {
+    this->Internals->RenWin->Render();
+  }
   return true;
 }
 
@@ -775,6 +814,55 @@ image window_impl::renderToImage(bool noBackground)
   return output;
 }
 
+//----------------------------------------------------------------------------
+std::vector<image> window_impl::renderViews(
+  const std::vector<camera_state_t>& views, bool noBackground)
+{
+  std::vector<image> images;
+  if (views.empty())
+  {
+    return images;
+  }
+  images.reserve(views.size());
+
+  // Actors, coloring and lighting do not depend on the camera, update them once for all views
+  this->UpdateDynamicOptions();
+
+  camera& cam = this->getCamera();
+  const camera_state_t initialState = cam.getState();
+
+  // The filter renders the window itself before each readback, so each view is rendered once
+  vtkNew<vtkWindowToImageFilter> rtW2if;
+  rtW2if->SetInput(this->Internals->RenWin);
+
+  if (noBackground)
+  {
+    // see renderToImage
+    this->Internals->Renderer->SetBackground(0, 0, 0);
+    rtW2if->SetInputBufferTypeToRGBA();
+  }
+
+  vtkNew<vtkImageExport> exporter;
+  exporter->SetInputConnection(rtW2if->GetOutputPort());
+  exporter->ImageLowerLeftOn();
+
+  for (const camera_state_t& view : views)
+  {
+    cam.setState(view);
+    rtW2if->Modified();
+
+    const int* dims = exporter->GetDataDimensions();
+    int cmp = exporter->GetDataNumberOfScalarComponents();
+
+    image output(dims[0], dims[1], cmp);
+    exporter->Export(output.getContent());
+    images.emplace_back(std::move(output));
+  }
+
+  cam.setState(initialState);
+  return images;
+}
+
 //----------------------------------------------------------------------------
 void window_impl::SetImporter(vtkF3DMetaImporter* importer)
 {
@@ -0,0 +1,41 @@
+#include "PseudoUnitTest.h"
+#include "TestSDKHelpers.h"
+
+#include <engine.h>
+#include <image.h>
+#include <options.h>
+#include <scene.h>
+#include <window.h>
+
+int TestSDKBlendingWeightedVolume([[maybe_unused]] int argc, char* argv[])
+{
+  PseudoUnitTest test;
+
+  f3d::engine eng = TestSDKHelpers::CreateOffscreenEngine(std::string(argv[4]));
+  f3d::options& opt = eng.getOptions();
+  f3d::window& win = eng.getWindow().setSize(300, 300);
+  eng.getScene().add(std::string(argv[1]) + "data/HeadMRVolume.mhd");
+
+  // the translucent grid overlaps the volume
+  opt.render.grid.enable = true;
+
+  opt.render.effect.blending.mode = "ddp";
+  opt.model.volume.enable = true;
+  const f3d::image ddp = win.renderToImage();
+  opt.model.volume.enable = false;
+  const f3d::image ddpNoVolume = win.renderToImage();
+  test("volume rendered with dual depth peeling", ddp.compare(ddpNoVolume) > 1e-6);
+
+  // the first weighted frame is rendered without volume, so the passes are built without it
+  opt.render.effect.blending.mode = "weighted";
+  const f3d::image weightedNoVolume = win.renderToImage();
+
+  // volumes are not supported by the weighted blending, which falls back to dual depth peeling
+  opt.model.volume.enable = true;
+  const f3d::image weighted = win.renderToImage();
+  test("volume rendered after toggling it with weighted blending",
+    weighted.compare(weightedNoVolume) > 1e-6);
+  test("volume rendered with dual depth peeling fallback", ddp.compare(weighted) < 1e-6);
+
+  return test.result();
+}
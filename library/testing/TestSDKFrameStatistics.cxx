@@ -0,0 +1,61 @@
+#include "PseudoUnitTest.h"
+#include "TestSDKHelpers.h"
+
+#include <camera.h>
+#include <engine.h>
+#include <log.h>
+#include <options.h>
+#include <scene.h>
+#include <window.h>
+
+#include <algorithm>
+
+int TestSDKFrameStatistics([[maybe_unused]] int argc, char* argv[])
+{
+  PseudoUnitTest test;
+
+  f3d::log::setVerboseLevel(f3d::log::VerboseLevel::DEBUG);
+  f3d::engine eng = TestSDKHelpers::CreateOffscreenEngine(std::string(argv[4]));
+  f3d::window& win = eng.getWindow();
+  eng.getScene().add(std::string(argv[1]) + "/data/cow.vtp");
+
+  win.render();
+  test("no statistics by default", win.getFrameStatistics().empty());
+
+  win.setCollectFrameStatistics(true);
+  win.render();
+  win.render();
+  win.render();
+
+  const auto statistics = win.getFrameStatistics();
+  test("statistics of each frame", statistics.size(), static_cast<size_t>(3));
+  test("positive cpu time", std::ranges::all_of(statistics,
+    [](const f3d::window::frame_statistics_t& frame) { return frame.cpuTime > 0; }));
+
+  const f3d::window::frame_statistics_t& last = statistics.back();
+  if (last.gpuTime >= 0)
+  {
+    test("main pass timing", std::ranges::any_of(last.passTimes,
+      [](const auto& pass) { return pass.first == "main" && pass.second >= 0; }));
+  }
+
+  win.setCollectFrameStatistics(false);
+  win.render();
+  test("statistics are not collected when disabled", win.getFrameStatistics().empty());
+
+  // the cow is culled when looking away from it
+  eng.getOptions().render.culling = true;
+  win.setCollectFrameStatistics(true);
+  win.render();
+  test("visible actor not culled", win.getFrameStatistics().back().frustumCulledActors, 0);
+
+  f3d::camera& cam = win.getCamera();
+  const f3d::point3_t pos = cam.getPosition();
+  const f3d::point3_t foc = cam.getFocalPoint();
+  cam.setFocalPoint({ 2 * pos[0] - foc[0], 2 * pos[1] - foc[1], 2 * pos[2] - foc[2] });
+  win.render();
+  test("actor outside of the frustum culled",
+    win.getFrameStatistics().back().frustumCulledActors > 0);
+
+  return test.result();
+}
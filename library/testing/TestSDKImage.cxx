@@ -24,6 +24,9 @@ int TestSDKImage([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
 #if F3D_MODULE_EXR
   test("supported formats EXR", std::ranges::find(formats, ".exr") != formats.end());
 #endif
+#if F3D_MODULE_KTX
+  test("supported formats KTX2", std::ranges::find(formats, ".ktx2") != formats.end());
+#endif
 #if F3D_MODULE_WEBP
   test("supported formats WebP", std::ranges::find(formats, ".webp") != formats.end());
 #endif
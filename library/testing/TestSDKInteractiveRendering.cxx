@@ -0,0 +1,96 @@
+#include "PseudoUnitTest.h"
+#include "TestSDKHelpers.h"
+
+#include <engine.h>
+#include <image.h>
+#include <interactor.h>
+#include <options.h>
+#include <scene.h>
+#include <types.h>
+#include <window.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+// A grid of triangles large enough to be replaced by a decimated proxy while interacting
+f3d::mesh_t CreateLargeGrid()
+{
+  constexpr unsigned int n = 300;
+  f3d::mesh_t mesh;
+  for (unsigned int j = 0; j <= n; j++)
+  {
+    for (unsigned int i = 0; i <= n; i++)
+    {
+      const float x = static_cast<float>(i) / n;
+      const float y = static_cast<float>(j) / n;
+      mesh.points.insert(mesh.points.end(), { x, y, 0.1f * std::sin(10.f * x) * y });
+    }
+  }
+  for (unsigned int j = 0; j < n; j++)
+  {
+    for (unsigned int i = 0; i < n; i++)
+    {
+      const unsigned int p = j * (n + 1) + i;
+      mesh.face_indices.insert(
+        mesh.face_indices.end(), { p, p + 1, p + n + 2, p, p + n + 2, p + n + 1 });
+      mesh.face_sides.insert(mesh.face_sides.end(), { 3, 3 });
+    }
+  }
+  return mesh;
+}
+}
+
+int TestSDKInteractiveRendering([[maybe_unused]] int argc, char* argv[])
+{
+  PseudoUnitTest test;
+
+  f3d::engine eng = TestSDKHelpers::CreateOffscreenEngine(std::string(argv[4]));
+  f3d::options& opt = eng.getOptions();
+  f3d::window& win = eng.getWindow().setSize(300, 300);
+  f3d::interactor& inter = eng.getInteractor();
+  eng.getScene().add(::CreateLargeGrid());
+
+  // a target that cannot be reached to make sure the effects are disabled while interacting
+  opt.render.effect.ambient_occlusion = true;
+  opt.render.background.blur.enable = true;
+  opt.interactor.target_frame_time = 1.0;
+  win.render();
+
+  const std::string recording =
+    std::string(argv[1]) + "/recordings/TestInteractionDragRotateVertical.log";
+
+  win.setCollectFrameStatistics(true);
+  test("play drag interaction", inter.playInteraction(recording));
+
+  const auto effectsDisabled = [](const f3d::window::frame_statistics_t& frame)
+  { return frame.interactiveEffectsDisabled; };
+  const auto proxyRendered = [](const f3d::window::frame_statistics_t& frame)
+  { return frame.interactiveProxyActors > 0; };
+
+  auto statistics = win.getFrameStatistics();
+  test("effects disabled while interacting", std::ranges::any_of(statistics, effectsDisabled));
+  test("effects enabled after interaction", !effectsDisabled(statistics.back()));
+
+  // slow interactive frames requested a proxy, which is decimated in the background and
+  // rendered by the next interactions once ready
+  bool rendered = false;
+  for (int i = 0; i < 10 && !rendered; i++)
+  {
+    win.setCollectFrameStatistics(true);
+    test("play drag interaction again", inter.playInteraction(recording));
+    statistics = win.getFrameStatistics();
+    rendered = std::ranges::any_of(statistics, proxyRendered);
+  }
+  test("proxy rendered while interacting", rendered);
+  test("proxy replaced after interaction", !proxyRendered(statistics.back()));
+  win.setCollectFrameStatistics(false);
+
+  // full quality must be restored once the interaction is over
+  const f3d::image interactive = win.renderToImage();
+  opt.reset("interactor.target_frame_time");
+  test("full quality restored after interaction", interactive.compare(win.renderToImage()) < 1e-6);
+
+  return test.result();
+}
@@ -0,0 +1,34 @@
+#include "PseudoUnitTest.h"
+#include "TestSDKHelpers.h"
+
+#include <engine.h>
+#include <scene.h>
+
+int TestSDKLoadStatistics([[maybe_unused]] int argc, char* argv[])
+{
+  PseudoUnitTest test;
+
+  f3d::engine eng = f3d::engine::createNone();
+  f3d::scene& sce = eng.getScene();
+  const std::string cow = std::string(argv[1]) + "data/cow.vtp";
+
+  sce.add(cow);
+  test("no statistics by default", sce.getLoadStatistics().empty());
+
+  sce.setCollectLoadStatistics(true);
+  sce.clear();
+  sce.add(cow);
+  sce.add(cow);
+
+  const auto statistics = sce.getLoadStatistics();
+  test("statistics of each load", statistics.size(), static_cast<size_t>(2));
+  test("positive reader time", statistics.front().readerTime > 0);
+  test("non negative coloring info time", statistics.front().coloringInfoTime >= 0);
+  test("non negative post-process time", statistics.front().postProcessTime >= 0);
+
+  test("statistics are cleared", sce.setCollectLoadStatistics(false).getLoadStatistics().empty());
+  sce.add(cow);
+  test("statistics are not collected when disabled", sce.getLoadStatistics().empty());
+
+  return test.result();
+}
@@ -0,0 +1,73 @@
+#include "PseudoUnitTest.h"
+#include "TestSDKHelpers.h"
+
+#include <camera.h>
+#include <engine.h>
+#include <options.h>
+#include <scene.h>
+#include <types.h>
+#include <window.h>
+
+namespace
+{
+// A square facing +Z, centered on the Z axis
+f3d::mesh_t CreateSquare(float halfSize, float z)
+{
+  f3d::mesh_t mesh;
+  mesh.points = { -halfSize, -halfSize, z, halfSize, -halfSize, z, halfSize, halfSize, z,
+    -halfSize, halfSize, z };
+  mesh.face_sides = { 4 };
+  mesh.face_indices = { 0, 1, 2, 3 };
+  return mesh;
+}
+
+// Add a small square hidden behind a large one
+void AddHiddenScene(f3d::engine& eng)
+{
+  eng.getScene().add(::CreateSquare(10.f, 0.f)).add(::CreateSquare(1.f, -5.f));
+  eng.getWindow().getCamera().setPosition({ 0, 0, 20 }).setFocalPoint({ 0, 0, 0 }).setViewUp(
+    { 0, 1, 0 });
+}
+}
+
+int TestSDKOcclusionCulling([[maybe_unused]] int argc, char* argv[])
+{
+  PseudoUnitTest test;
+
+  f3d::engine eng = TestSDKHelpers::CreateOffscreenEngine(std::string(argv[4]));
+  f3d::window& win = eng.getWindow().setSize(300, 300);
+  eng.getOptions().render.culling = true;
+  ::AddHiddenScene(eng);
+
+  // the queries issued by the first frame are read by the second one,
+  // the image read back makes sure their results are available
+  win.setCollectFrameStatistics(true);
+  win.renderToImage();
+  test("nothing occluded before the first queries",
+    win.getFrameStatistics().back().occlusionCulledActors, 0);
+  win.render();
+  test("hidden actor occluded after two renders",
+    win.getFrameStatistics().back().occlusionCulledActors > 0);
+  test("visible actor not culled", win.getFrameStatistics().back().frustumCulledActors, 0);
+
+  // the queries of the previous props are not used for the new ones
+  eng.getScene().clear();
+  ::AddHiddenScene(eng);
+  win.render();
+  test("queries discarded when the props change",
+    win.getFrameStatistics().back().occlusionCulledActors, 0);
+  win.renderToImage();
+  win.render();
+  test("new hidden actor occluded", win.getFrameStatistics().back().occlusionCulledActors > 0);
+
+  // the occluder moves behind the hidden actor from the point of view of the camera,
+  // the actor is culled by the queries of the previous frame but a single render displays it
+  win.getCamera().setPosition({ 0, 0, -20 });
+  const size_t nFrames = win.getFrameStatistics().size();
+  win.render();
+  test("uncovered actor rendered again", win.getFrameStatistics().size(), nFrames + 2);
+  test("uncovered actor displayed without another render",
+    win.getFrameStatistics().back().occlusionCulledActors, 0);
+
+  return test.result();
+}
@@ -28,7 +28,7 @@ int TestSDKOptionsDomains([[maybe_unused]] int argc, [[maybe_unused]] char* argv
 
   // Test getEnumDomain
   test("getEnumDomain", opt.getEnumDomain("render.effect.blending.mode"),
-    { "none", "ddp", "sort", "sort_cpu", "stochastic" });
+    { "none", "ddp", "sort", "sort_cpu", "stochastic", "weighted" });
   test.expect<f3d::options::incompatible_exception>(
     "getEnumDomain incompatible", [&]() { std::ignore = opt.getEnumDomain("model.scivis.cells"); });
   test.expect<f3d::options::inexistent_exception>(
@@ -141,6 +141,7 @@ int TestSDKOptionsDomains([[maybe_unused]] int argc, [[maybe_unused]] char* argv
   test("cycle", opt.render.effect.blending.mode == "ddp");
 
   opt.cycle("render.effect.blending.mode")
+    .cycle("render.effect.blending.mode")
     .cycle("render.effect.blending.mode")
     .cycle("render.effect.blending.mode")
     .cycle("render.effect.blending.mode");
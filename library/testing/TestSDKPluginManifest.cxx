@@ -0,0 +1,74 @@
+#include "PseudoUnitTest.h"
+
+#include <engine.h>
+#include <log.h>
+#include <scene.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+int TestSDKPluginManifest([[maybe_unused]] int argc, char* argv[])
+{
+  PseudoUnitTest test;
+
+  f3d::log::setVerboseLevel(f3d::log::VerboseLevel::DEBUG);
+
+  const fs::path tmpDir = fs::path(argv[2]) / "TestSDKPluginManifest";
+  fs::create_directories(tmpDir);
+
+  // The library is not a valid plugin, it can only be registered from its manifest
+  const fs::path libraryPath = tmpDir / "invalid_manifest.so";
+  fs::copy_file(fs::path(argv[1]) / "data" / "invalid.so", libraryPath,
+    fs::copy_options::overwrite_existing);
+  std::ofstream(tmpDir / "invalid_manifest.json") << R"({
+    "name": "manifest",
+    "description": "Plugin with a manifest",
+    "version": "1.0",
+    "readers": [
+      {
+        "name": "ManifestReader",
+        "description": "Manifest reader",
+        "extensions": ["f3dmanifest"],
+        "mimetypes": ["application/vnd.f3dmanifest"],
+        "magic": ["463344"],
+        "options": ["ManifestReader.option"],
+        "score": 50
+      }
+    ]
+  })";
+
+  std::ofstream(tmpDir / "wrong_magic.f3dmanifest") << "XYZ";
+  std::ofstream(tmpDir / "right_magic.f3dmanifest") << "F3D";
+
+  f3d::engine eng = f3d::engine::createNone();
+  f3d::scene& sce = eng.getScene();
+
+  auto hasManifestReader = []()
+  {
+    const auto readers = f3d::engine::getReadersInfo();
+    return std::ranges::any_of(readers, [](const f3d::engine::readerInformation& info)
+      { return info.Name == "ManifestReader" && info.PluginName == "manifest"; });
+  };
+
+  test("load plugin from manifest", [&]() { f3d::engine::loadPlugin(libraryPath.string()); });
+  test("manifest reader is registered", hasManifestReader());
+
+  const auto optionNames = f3d::engine::getAllReaderOptionNames();
+  test("manifest reader option is registered",
+    std::ranges::find(optionNames, "ManifestReader.option") != optionNames.end());
+  test("set manifest reader option",
+    [&]() { f3d::engine::setReaderOption("ManifestReader.option", "value"); });
+
+  // magic bytes are checked without loading the library
+  test("wrong magic is not supported", !sce.supports(tmpDir / "wrong_magic.f3dmanifest"));
+  test("manifest reader is still registered", hasManifestReader());
+
+  // the library is loaded when the reader is selected, it fails and the plugin is unregistered
+  test("invalid library is not supported", !sce.supports(tmpDir / "right_magic.f3dmanifest"));
+  test("manifest reader is unregistered", !hasManifestReader());
+
+  return test.result();
+}
@@ -0,0 +1,46 @@
+#include "PseudoUnitTest.h"
+#include "TestSDKHelpers.h"
+
+#include <camera.h>
+#include <engine.h>
+#include <image.h>
+#include <log.h>
+#include <scene.h>
+#include <window.h>
+
+int TestSDKRenderViews([[maybe_unused]] int argc, char* argv[])
+{
+  PseudoUnitTest test;
+
+  f3d::log::setVerboseLevel(f3d::log::VerboseLevel::DEBUG);
+  f3d::engine eng = TestSDKHelpers::CreateOffscreenEngine(std::string(argv[4]));
+  f3d::window& win = eng.getWindow().setSize(300, 300);
+  f3d::camera& cam = win.getCamera();
+  eng.getScene().add(std::string(argv[1]) + "/data/cow.vtp");
+  win.render();
+
+  const f3d::camera_state_t initialState = cam.getState();
+  f3d::camera_state_t sideState = initialState;
+  sideState.position = { initialState.focalPoint[0] + 10, initialState.focalPoint[1],
+    initialState.focalPoint[2] };
+
+  const std::vector<f3d::camera_state_t> views = { initialState, sideState };
+  const std::vector<f3d::image> images = win.renderViews(views);
+  test("one image per view", images.size(), views.size());
+  test("camera state is restored", cam.getState().position, initialState.position);
+  test("empty views", win.renderViews({}).empty());
+
+  // each view must match a render with the camera set to the same state
+  for (size_t i = 0; i < views.size(); i++)
+  {
+    cam.setState(views[i]);
+    test("view " + std::to_string(i) + " matches renderToImage",
+      images[i].compare(win.renderToImage()) < 1e-6);
+  }
+  test("views are different", images[0].compare(images[1]) > 1e-6);
+
+  const std::vector<f3d::image> rgbaImages = win.renderViews(views, true);
+  test("no background views", rgbaImages.size() == 2 && rgbaImages[0].getChannelCount() == 4);
+
+  return test.result();
+}
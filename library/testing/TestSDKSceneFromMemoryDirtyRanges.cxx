@@ -0,0 +1,96 @@
+#include "PseudoUnitTest.h"
+#include "TestSDKHelpers.h"
+
+#include <engine.h>
+#include <image.h>
+#include <mesh_view.h>
+#include <scene.h>
+#include <window.h>
+
+#include <vector>
+
+// Two quads side by side, the right one is moved in place by the test
+class TwoQuadsMesh : public f3d::mesh_view
+{
+public:
+  TwoQuadsMesh()
+  {
+    for (float x : { -1.f, 0.1f })
+    {
+      this->Points.insert(this->Points.end(),
+        { x, -0.5f, 0.f, x + 0.9f, -0.5f, 0.f, x + 0.9f, 0.5f, 0.f, x, 0.5f, 0.f });
+    }
+  }
+
+  std::array<double, 2> getTimeRange() const override
+  {
+    return { 0.0, 10.0 };
+  }
+
+  f3d::mesh_view::memory_view_t getMemoryView(double) const override
+  {
+    return { .pointCount = 8,
+      .points = { .data = this->Points.data(),
+        .components = 3,
+        .stride = 3,
+        .dirtyRanges = this->DirtyRanges },
+      .polygons = { .offsetCount = this->Offsets.size(),
+        .offsets = { .type = f3d::mesh_view::data_type::U32,
+          .data = this->Offsets.data(),
+          .timeDependent = false },
+        .indexCount = this->Indices.size(),
+        .indices = { .type = f3d::mesh_view::data_type::U32,
+          .data = this->Indices.data(),
+          .timeDependent = false } } };
+  }
+
+  void MoveRightQuad(float y)
+  {
+    for (size_t i = 4; i < 8; i++)
+    {
+      this->Points[3 * i + 1] += y;
+    }
+  }
+
+  std::vector<float> Points;
+  std::vector<unsigned int> Offsets = { 0, 4, 8 };
+  std::vector<unsigned int> Indices = { 0, 1, 2, 3, 4, 5, 6, 7 };
+  std::vector<std::pair<size_t, size_t>> DirtyRanges;
+};
+
+int TestSDKSceneFromMemoryDirtyRanges([[maybe_unused]] int argc, char* argv[])
+{
+  PseudoUnitTest test;
+
+  f3d::engine eng = TestSDKHelpers::CreateOffscreenEngine(std::string(argv[4]));
+  f3d::scene& sce = eng.getScene();
+  f3d::window& win = eng.getWindow().setSize(300, 300);
+
+  auto mesh = std::make_shared<TwoQuadsMesh>();
+  test("add animated mesh from memory", [&]() { sce.add(mesh); });
+
+  f3d::image both = win.renderToImage();
+
+  // only the points of the right quad are updated in place
+  mesh->MoveRightQuad(10.f);
+  mesh->DirtyRanges = { { 4, 8 } };
+  sce.loadAnimationTime(1.0);
+  f3d::image leftOnly = win.renderToImage();
+  test("modified range is rendered", both != leftOnly);
+
+  mesh->MoveRightQuad(-10.f);
+  sce.loadAnimationTime(2.0);
+  test("modified range is rendered back", win.renderToImage().compare(both) < 0.01);
+
+  // without dirty ranges the whole array is uploaded
+  mesh->MoveRightQuad(10.f);
+  mesh->DirtyRanges.clear();
+  sce.loadAnimationTime(3.0);
+  test("full upload is rendered", win.renderToImage().compare(leftOnly) < 0.01);
+
+  mesh->MoveRightQuad(-10.f);
+  sce.loadAnimationTime(4.0);
+  test("full upload is rendered back", win.renderToImage().compare(both) < 0.01);
+
+  return test.result();
+}
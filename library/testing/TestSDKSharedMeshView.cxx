@@ -0,0 +1,136 @@
+#include "PseudoUnitTest.h"
+#include "TestSDKHelpers.h"
+
+#include <engine.h>
+#include <image.h>
+#include <scene.h>
+#include <shared_mesh_view.h>
+#include <window.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <new>
+#include <string>
+#include <tuple>
+
+int TestSDKSharedMeshView([[maybe_unused]] int argc, char* argv[])
+{
+  PseudoUnitTest test;
+
+  using shared_mesh_view = f3d::shared_mesh_view;
+  using array_role = shared_mesh_view::array_role;
+  using data_type = f3d::mesh_view::data_type;
+
+  test.expect<shared_mesh_view::shared_memory_exception>(
+    "open missing segment", [&]() { shared_mesh_view view("/f3d_missing_segment"); });
+
+  // create a segment with a single triangle
+  const std::string segmentName = "/f3d_test_" + std::to_string(getpid());
+  constexpr size_t segmentSize = 4096;
+  int fd = shm_open(segmentName.c_str(), O_CREAT | O_RDWR, 0600);
+  test("create segment", fd >= 0);
+  test("resize segment", ftruncate(fd, segmentSize) == 0);
+  void* memory = mmap(nullptr, segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  test("map segment", memory != MAP_FAILED);
+
+  auto* bytes = static_cast<std::byte*>(memory);
+  auto* header = new (bytes) shared_mesh_view::header_t();
+  auto* arrays = new (bytes + sizeof(shared_mesh_view::header_t)) shared_mesh_view::array_t[3];
+
+  constexpr size_t dataOffset = 1024;
+  const float points[] = { 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 1.f, 0.f };
+  const unsigned int offsets[] = { 0, 3 };
+  const unsigned int indices[] = { 0, 1, 2 };
+  std::memcpy(bytes + dataOffset, points, sizeof(points));
+  std::memcpy(bytes + dataOffset + 64, offsets, sizeof(offsets));
+  std::memcpy(bytes + dataOffset + 128, indices, sizeof(indices));
+
+  auto setArray = [&](shared_mesh_view::array_t& array, array_role role, size_t offset,
+                    size_t count, uint32_t components, data_type type)
+  {
+    array.role = static_cast<uint8_t>(role);
+    array.offset = dataOffset + offset;
+    array.count = count;
+    array.components = components;
+    array.type = static_cast<uint8_t>(type);
+  };
+  setArray(arrays[0], array_role::POINTS, 0, 3, 3, data_type::F32);
+  setArray(arrays[1], array_role::POLYGONS_OFFSETS, 64, 2, 1, data_type::U32);
+  setArray(arrays[2], array_role::POLYGONS_INDICES, 128, 3, 1, data_type::U32);
+
+  header->size = segmentSize;
+  header->pointCount = 3;
+  header->arrayCount = 3;
+  header->timeRange[1] = 2.0;
+  std::strncpy(header->name, "triangle", sizeof(header->name) - 1);
+  header->sequence = 2;
+
+  {
+    shared_mesh_view view(segmentName);
+    test("name", view.getName(), std::string("triangle"));
+    test("time range", view.getTimeRange()[1], 2.0);
+    test("new frame before first view", view.hasNewFrame());
+
+    f3d::mesh_view::memory_view_t memoryView = view.getMemoryView(0.0);
+    test("point count", memoryView.pointCount, size_t(3));
+    test("points are not copied", memoryView.points.data,
+      static_cast<const void*>(bytes + dataOffset));
+    test("polygon offset count", memoryView.polygons.offsetCount, size_t(2));
+    test("polygon index count", memoryView.polygons.indexCount, size_t(3));
+    test("no new frame", !view.hasNewFrame());
+    test("sequence", view.getSequence(), uint64_t(2));
+
+    header->sequence = 4;
+    test("new frame", view.hasNewFrame());
+
+    // an array pointing outside of the segment is rejected
+    arrays[0].offset = segmentSize - 8;
+    test.expect<shared_mesh_view::shared_memory_exception>(
+      "out of bounds array", [&]() { std::ignore = view.getMemoryView(0.0); });
+    arrays[0].offset = dataOffset;
+
+    // an array with an invalid type is rejected
+    arrays[1].type = 42;
+    test.expect<shared_mesh_view::shared_memory_exception>(
+      "invalid array type", [&]() { std::ignore = view.getMemoryView(0.0); });
+    arrays[1].type = static_cast<uint8_t>(data_type::U32);
+
+    // a producer that never releases the header is detected
+    header->sequence = 5;
+    test.expect<shared_mesh_view::shared_memory_exception>(
+      "locked header", [&]() { std::ignore = view.getMemoryView(0.0); });
+  }
+  header->sequence = 6;
+
+  {
+    // a new frame published by the producer is picked up by the next render
+    f3d::engine eng = TestSDKHelpers::CreateOffscreenEngine(std::string(argv[4]));
+    f3d::window& win = eng.getWindow().setSize(300, 300);
+    eng.getScene().add(std::make_shared<shared_mesh_view>(segmentName));
+    f3d::image first = win.renderToImage();
+    test("same frame is rendered", first == win.renderToImage());
+
+    const float newPoints[] = { 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 1.f, 1.f, 0.f };
+    header->sequence = 7;
+    std::memcpy(bytes + dataOffset + 256, newPoints, sizeof(newPoints));
+    arrays[0].offset = dataOffset + 256;
+    header->sequence = 8;
+
+    f3d::image second = win.renderToImage();
+    test("new frame is rendered", first != second);
+    arrays[0].offset = dataOffset;
+  }
+
+  header->magic = 0;
+  test.expect<shared_mesh_view::shared_memory_exception>(
+    "invalid magic", [&]() { shared_mesh_view view(segmentName); });
+
+  munmap(memory, segmentSize);
+  shm_unlink(segmentName.c_str());
+
+  return test.result();
+}
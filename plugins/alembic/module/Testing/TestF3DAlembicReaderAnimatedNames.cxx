@@ -0,0 +1,49 @@
+#include <vtkNew.h>
+#include <vtkPolyData.h>
+#include <vtkTestUtilities.h>
+
+#include "vtkF3DAlembicReader.h"
+
+#include <iostream>
+#include <string>
+
+namespace
+{
+/**
+ * Check the X bounds of the output at the given time
+ */
+bool CheckBounds(vtkF3DAlembicReader* reader, double time, double xMin, double xMax)
+{
+  reader->UpdateTimeStep(time);
+  vtkPolyData* output = reader->GetOutput();
+
+  double bounds[6];
+  output->GetBounds(bounds);
+  if (output->GetNumberOfPoints() != 6 || bounds[0] != xMin || bounds[1] != xMax)
+  {
+    std::cerr << "Unexpected output at time " << time << ": " << output->GetNumberOfPoints()
+              << " points, X bounds [" << bounds[0] << ", " << bounds[1] << "]\n";
+    return false;
+  }
+  return true;
+}
+}
+
+int TestF3DAlembicReaderAnimatedNames(int vtkNotUsed(argc), char* argv[])
+{
+  // Two triangles named "mesh", each under its own transform.
+  // The "left" transform is static at X=-2, the "right" transform moves from X=2 to X=3.
+  const std::string filename = std::string(argv[1]) + "data/xform_anim_same_names.abc";
+
+  vtkNew<vtkF3DAlembicReader> reader;
+  reader->SetFileName(filename);
+
+  // Meshes sharing a name are cached separately and keep their own transform over time
+  if (!::CheckBounds(reader, 0.0, -2.0, 3.0) || !::CheckBounds(reader, 1.0, -2.0, 4.0) ||
+    !::CheckBounds(reader, 0.0, -2.0, 3.0))
+  {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -12,6 +12,7 @@
 #include <vtkPoints.h>
 #include <vtkPolyLine.h>
 #include <vtkResourceStream.h>
+#include <vtkSMPTools.h>
 #include <vtkSmartPointer.h>
 #include <vtkStreamingDemandDrivenPipeline.h>
 
@@ -28,6 +29,7 @@
 #pragma warning(pop)
 #endif
 
+#include <mutex>
 #include <numeric>
 #include <stack>
 #include <tuple>
@@ -51,8 +53,64 @@ struct IntermediateGeometry
   bool nFaceVarying = false;
 };
 
+static_assert(sizeof(Alembic::Abc::V3f) == 3 * sizeof(float), "V3f must be packed");
+
 class vtkF3DAlembicReader::vtkInternals
 {
+  /**
+   * Copy the first components of each vector into a packed float buffer, in parallel
+   */
+  static void CopyVectors(const Alembic::Abc::V3f* in, vtkIdType count, int nbComps, float* out)
+  {
+    vtkSMPTools::For(0, count,
+      [&](vtkIdType begin, vtkIdType end)
+      {
+        if (nbComps == 3)
+        {
+          std::copy_n(&in[begin].x, 3 * (end - begin), out + 3 * begin);
+          return;
+        }
+        for (vtkIdType i = begin; i < end; i++)
+        {
+          std::copy_n(&in[i].x, nbComps, out + nbComps * i);
+        }
+      });
+  }
+
+  /**
+   * Transform positions, or directions, into a packed float buffer, in parallel.
+   * When provided, sourceIds are the indices of the input vectors to transform,
+   * output vectors with an out of range source id are left untouched.
+   */
+  template<bool Direction>
+  static void TransformVectors(const Alembic::Abc::V3f* in, size_t inSize,
+    const vtkIdType* sourceIds, vtkIdType count, const Alembic::Abc::M44d& matrix, float* out)
+  {
+    vtkSMPTools::For(0, count,
+      [&](vtkIdType begin, vtkIdType end)
+      {
+        for (vtkIdType i = begin; i < end; i++)
+        {
+          const vtkIdType rawIndex = sourceIds ? sourceIds[i] : i;
+          if (rawIndex >= static_cast<vtkIdType>(inSize))
+          {
+            continue;
+          }
+
+          Alembic::Abc::V3f transformed;
+          if constexpr (Direction)
+          {
+            matrix.multDirMatrix(in[rawIndex], transformed);
+          }
+          else
+          {
+            matrix.multVecMatrix(in[rawIndex], transformed);
+          }
+          std::copy_n(&transformed.x, 3, out + 3 * i);
+        }
+      });
+  }
+
   void SetupIndicesStorage(const Alembic::AbcGeom::Int32ArraySamplePtr& faceVertexCounts,
     PerMeshWavefrontIndicesTripletsContainer& extractedIndices)
   {
@@ -109,12 +167,8 @@ class vtkF3DAlembicReader::vtkInternals
     const vtkIdType numPoints = static_cast<vtkIdType>(pArray.size());
 
     points->SetNumberOfPoints(numPoints);
-
-    for (vtkIdType i = 0; i < numPoints; ++i)
-    {
-      const auto& p = pArray[i];
-      points->SetPoint(i, p.x, p.y, p.z);
-    }
+    vtkInternals::CopyVectors(pArray.data(), numPoints, 3,
+      vtkFloatArray::SafeDownCast(points->GetData())->GetPointer(0));
     polydata->SetPoints(points);
 
     vtkIdType numCells = static_cast<vtkIdType>(data.Indices.size());
@@ -162,11 +216,7 @@ class vtkF3DAlembicReader::vtkInternals
       const auto& nArray = nMapIter->second;
       const vtkIdType numNormals = static_cast<vtkIdType>(nArray.size());
       normals->SetNumberOfTuples(numNormals);
-      for (vtkIdType i = 0; i < numNormals; i++)
-      {
-        const auto& n = nArray[i];
-        normals->SetTuple3(i, n.x, n.y, n.z);
-      }
+      vtkInternals::CopyVectors(nArray.data(), numNormals, 3, normals->GetPointer(0));
 
       vtkInformation* info = normals->GetInformation();
       info->Set(vtkF3DFaceVaryingPointDispatcher::INTERPOLATION_TYPE(), data.nFaceVarying ? 1 : 0);
@@ -182,12 +232,7 @@ class vtkF3DAlembicReader::vtkInternals
       const auto& uvArray = uvMapIter->second;
       vtkIdType numUVs = static_cast<vtkIdType>(uvArray.size());
       uvs->SetNumberOfTuples(numUVs);
-
-      for (vtkIdType i = 0; i < numUVs; i++)
-      {
-        const auto& uv = uvArray[i];
-        uvs->SetTuple2(i, uv.x, uv.y);
-      }
+      vtkInternals::CopyVectors(uvArray.data(), numUVs, 2, uvs->GetPointer(0));
 
       vtkInformation* info = uvs->GetInformation();
       info->Set(vtkF3DFaceVaryingPointDispatcher::INTERPOLATION_TYPE(), data.uvFaceVarying ? 1 : 0);
@@ -197,7 +242,14 @@ class vtkF3DAlembicReader::vtkInternals
   }
 
 public:
-  std::map<std::string, vtkSmartPointer<vtkPolyData>> OutputCache;
+  struct CachedMesh
+  {
+    vtkSmartPointer<vtkPolyData> Output;
+    Alembic::Abc::M44d Matrix;
+  };
+  std::map<std::string, CachedMesh> OutputCache;
+  std::mutex OutputCacheMutex;
+
   vtkSmartPointer<vtkPolyData> ProcessIPolyMesh(
     const Alembic::AbcGeom::IPolyMesh& pmesh, double time, const Alembic::Abc::M44d& matrix)
   {
@@ -214,75 +266,68 @@ public:
 
     Alembic::AbcGeom::ISampleSelector selector(time);
     schema.get(samp, selector);
-    const std::string& meshName = pmesh.getName();
+    // Names are not unique in the hierarchy, full names are
+    const std::string& meshName = pmesh.getFullName();
     auto topologyVariance = schema.getTopologyVariance();
     bool isTopologyConstant = (topologyVariance == Alembic::AbcGeom::kConstantTopology) ||
       (topologyVariance == Alembic::AbcGeom::kHomogenousTopology);
     Alembic::AbcGeom::P3fArraySamplePtr positions = samp.getPositions();
 
-    if (isTopologyConstant && this->OutputCache.count(meshName))
+    CachedMesh cached;
+    if (isTopologyConstant)
+    {
+      std::lock_guard<std::mutex> lock(this->OutputCacheMutex);
+      auto cacheIter = this->OutputCache.find(meshName);
+      if (cacheIter != this->OutputCache.end())
+      {
+        cached = cacheIter->second;
+      }
+    }
+
+    Alembic::AbcGeom::IN3fGeomParam normalsParam = schema.getNormalsParam();
+    if (cached.Output)
     {
-      vtkPolyData* cachedPoly = this->OutputCache[meshName];
-      polydata->ShallowCopy(cachedPoly);
+      // Rigid animation of a constant mesh with an unchanged transform, nothing to update
+      const bool isGeometryConstant = schema.getPositionsProperty().isConstant() &&
+        (!normalsParam.valid() || normalsParam.isConstant());
+      if (isGeometryConstant && matrix == cached.Matrix)
+      {
+        polydata->ShallowCopy(cached.Output);
+        return polydata;
+      }
+
+      polydata->ShallowCopy(cached.Output);
 
       vtkIdTypeArray* sourceIds =
         vtkIdTypeArray::SafeDownCast(polydata->GetPointData()->GetArray("SourceIds"));
+      const vtkIdType* sourceIdsPtr = sourceIds ? sourceIds->GetPointer(0) : nullptr;
 
-      const vtkIdType numPoints = polydata->GetNumberOfPoints();
+      // Without source ids, points are the raw positions
+      const vtkIdType numPoints = sourceIds
+        ? polydata->GetNumberOfPoints()
+        : std::min(polydata->GetNumberOfPoints(), static_cast<vtkIdType>(positions->size()));
       vtkNew<vtkPoints> newPoints;
-      newPoints->SetNumberOfPoints(numPoints);
-      if (sourceIds)
-      {
-        for (vtkIdType i = 0; i < numPoints; i++)
-        {
-          vtkIdType rawIndex = sourceIds->GetTypedComponent(i, 0);
-          if (rawIndex < static_cast<vtkIdType>(positions->size()))
-          {
-            Alembic::Abc::V3f tp;
-            matrix.multVecMatrix(positions->get()[rawIndex], tp);
-            newPoints->SetPoint(i, tp.x, tp.y, tp.z);
-          }
-        }
-      }
-      else
-      {
-        for (size_t i = 0; i < positions->size() && i < static_cast<size_t>(numPoints); i++)
-        {
-          const Alembic::Abc::V3f tp = positions->get()[i] * matrix;
-          newPoints->SetPoint(i, tp.x, tp.y, tp.z);
-        }
-      }
+      newPoints->SetNumberOfPoints(polydata->GetNumberOfPoints());
+      vtkInternals::TransformVectors<false>(positions->get(), positions->size(), sourceIdsPtr,
+        numPoints, matrix, vtkFloatArray::SafeDownCast(newPoints->GetData())->GetPointer(0));
       polydata->SetPoints(newPoints);
 
       // Update Normals
-      Alembic::AbcGeom::IN3fGeomParam normalsParam = schema.getNormalsParam();
       if (normalsParam.valid())
       {
         Alembic::AbcGeom::IN3fGeomParam::Sample normalValue =
           normalsParam.getIndexedValue(selector);
-        if (normalValue.valid())
+        vtkFloatArray* normals =
+          vtkFloatArray::SafeDownCast(polydata->GetPointData()->GetNormals());
+        auto vals = normalValue.valid() ? normalValue.getVals() : nullptr;
+        if (normals && vals)
         {
-          vtkFloatArray* normals =
-            vtkFloatArray::SafeDownCast(polydata->GetPointData()->GetNormals());
-          if (normals)
-          {
-            const vtkIdType numNormals = normals->GetNumberOfTuples();
-
-            auto vals = normalValue.getVals();
-            if (vals)
-            {
-              for (vtkIdType i = 0; i < numNormals; i++)
-              {
-                const vtkIdType rawIndex = sourceIds ? sourceIds->GetTypedComponent(i, 0) : i;
-                if (rawIndex < static_cast<vtkIdType>(vals->size()))
-                {
-                  Alembic::Abc::V3f normal;
-                  matrix.multDirMatrix((*vals)[rawIndex], normal);
-                  normals->SetTuple3(i, normal.x, normal.y, normal.z);
-                }
-              }
-            }
-          }
+          // Do not modify the cached normals
+          vtkNew<vtkFloatArray> newNormals;
+          newNormals->DeepCopy(normals);
+          vtkInternals::TransformVectors<true>(vals->get(), vals->size(), sourceIdsPtr,
+            newNormals->GetNumberOfTuples(), matrix, newNormals->GetPointer(0));
+          polydata->GetPointData()->SetNormals(newNormals);
         }
       }
     }
@@ -298,13 +343,9 @@ public:
 
       // Positions
       {
-        V3fContainer pV3F;
-        for (size_t pIndex = 0; pIndex < positions->size(); pIndex++)
-        {
-          Alembic::Abc::V3f tp;
-          matrix.multVecMatrix(positions->get()[pIndex], tp);
-          pV3F.emplace_back(tp.x, tp.y, tp.z);
-        }
+        V3fContainer pV3F(positions->size());
+        vtkInternals::TransformVectors<false>(positions->get(), positions->size(), nullptr,
+          static_cast<vtkIdType>(positions->size()), matrix, &pV3F.data()->x);
         originalData.Attributes.insert(AttributesContainer::value_type("P", pV3F));
         this->UpdateIndices<Alembic::AbcGeom::Int32ArraySamplePtr>(
           facePositionIndices, pIndicesOffset, originalData.Indices, doReverseRotate);
@@ -338,21 +379,17 @@ public:
         }
       }
       // Normals
-      Alembic::AbcGeom::IN3fGeomParam normalsParam = schema.getNormalsParam();
       if (normalsParam.valid())
       {
         Alembic::AbcGeom::IN3fGeomParam::Sample normalValue =
           normalsParam.getIndexedValue(selector);
         if (normalValue.valid())
         {
-          V3fContainer normal_v3f;
+          Alembic::AbcGeom::N3fArraySamplePtr vals = normalValue.getVals();
+          V3fContainer normal_v3f(vals->size());
           Alembic::AbcGeom::UInt32ArraySamplePtr normalIndices = normalValue.getIndices();
-          for (size_t index = 0; index < normalValue.getVals()->size(); ++index)
-          {
-            Alembic::AbcGeom::V3f normal;
-            matrix.multDirMatrix((*(normalValue.getVals()))[index], normal);
-            normal_v3f.emplace_back(normal);
-          }
+          vtkInternals::TransformVectors<true>(vals->get(), vals->size(), nullptr,
+            static_cast<vtkIdType>(vals->size()), matrix, &normal_v3f.data()->x);
           originalData.Attributes.insert(AttributesContainer::value_type("N", normal_v3f));
           if (normalsParam.getScope() == Alembic::AbcGeom::kFacevaryingScope)
           {
@@ -381,7 +418,8 @@ public:
       // Store data for the next frame
       if (isTopologyConstant)
       {
-        this->OutputCache[meshName] = polydata;
+        std::lock_guard<std::mutex> lock(this->OutputCacheMutex);
+        this->OutputCache[meshName] = { polydata, matrix };
       }
     }
     return polydata;
@@ -404,13 +442,10 @@ public:
       Alembic::AbcGeom::Int32ArraySamplePtr curveCounts = samp.getCurvesNumVertices();
 
       vtkNew<vtkPoints> points;
-      points->SetNumberOfPoints(positions->size());
-      for (size_t pIndex = 0; pIndex < positions->size(); ++pIndex)
-      {
-        Alembic::Abc::V3f tp;
-        matrix.multVecMatrix(positions->get()[pIndex], tp);
-        points->SetPoint(pIndex, tp.x, tp.y, tp.z);
-      }
+      points->SetNumberOfPoints(static_cast<vtkIdType>(positions->size()));
+      vtkInternals::TransformVectors<false>(positions->get(), positions->size(), nullptr,
+        static_cast<vtkIdType>(positions->size()), matrix,
+        vtkFloatArray::SafeDownCast(points->GetData())->GetPointer(0));
 
       size_t pOffsetIndex = 0;
       vtkNew<vtkCellArray> lines;
@@ -446,6 +481,15 @@ public:
       const Alembic::Abc::M44d>>
       objects;
 
+    // The hierarchy and transforms are traversed first, then geometries are sampled
+    struct GeometryTask
+    {
+      Alembic::AbcGeom::IPolyMesh PolyMesh;
+      Alembic::AbcGeom::ICurves Curves;
+      Alembic::Abc::M44d Matrix;
+    };
+    std::vector<GeometryTask> tasks;
+
     for (size_t i = 0; i < top.getNumChildren(); ++i)
     {
       objects.emplace(std::make_tuple(top, top.getChildHeader(i), identity));
@@ -458,13 +502,15 @@ public:
       Alembic::Abc::M44d objMatrix = matrix;
       if (Alembic::AbcGeom::IPolyMesh::matches(ohead))
       {
-        const Alembic::AbcGeom::IPolyMesh polymesh(parent, ohead.getName());
-        append->AddInputData(this->ProcessIPolyMesh(polymesh, time, objMatrix));
+        GeometryTask& task = tasks.emplace_back();
+        task.PolyMesh = Alembic::AbcGeom::IPolyMesh(parent, ohead.getName());
+        task.Matrix = objMatrix;
       }
       else if (Alembic::AbcGeom::ICurves::matches(ohead))
       {
-        const Alembic::AbcGeom::ICurves curve(parent, ohead.getName());
-        append->AddInputData(this->ProcessICurves(curve, time, objMatrix));
+        GeometryTask& task = tasks.emplace_back();
+        task.Curves = Alembic::AbcGeom::ICurves(parent, ohead.getName());
+        task.Matrix = objMatrix;
       }
       else if (Alembic::AbcGeom::IXform::matches(ohead))
       {
@@ -481,6 +527,33 @@ public:
         objects.emplace(std::make_tuple(obj, obj.getChildHeader(i), objMatrix));
       }
     }
+
+    // Independent objects are sampled in parallel when the archive can be read concurrently
+    std::vector<vtkSmartPointer<vtkPolyData>> outputs(tasks.size());
+    auto processTasks = [&](vtkIdType begin, vtkIdType end)
+    {
+      for (vtkIdType i = begin; i < end; i++)
+      {
+        const GeometryTask& task = tasks[i];
+        outputs[i] = task.PolyMesh.valid()
+          ? this->ProcessIPolyMesh(task.PolyMesh, time, task.Matrix)
+          : this->ProcessICurves(task.Curves, time, task.Matrix);
+      }
+    };
+
+    if (this->ConcurrentRead)
+    {
+      vtkSMPTools::For(0, static_cast<vtkIdType>(tasks.size()), 1, processTasks);
+    }
+    else
+    {
+      processTasks(0, static_cast<vtkIdType>(tasks.size()));
+    }
+
+    for (const vtkSmartPointer<vtkPolyData>& output : outputs)
+    {
+      append->AddInputData(output);
+    }
   }
 
   void ExtendTimeRange(double& start, double& end)
@@ -554,6 +627,7 @@ public:
   {
     Alembic::AbcCoreFactory::IFactory factory;
     Alembic::AbcCoreFactory::IFactory::CoreType coreType;
+    this->ConcurrentRead = false;
 
     if (stream)
     {
@@ -580,11 +654,15 @@ public:
     }
     else
     {
+      // One Ogawa stream per thread, so objects can be sampled concurrently
+      factory.setOgawaNumStreams(vtkSMPTools::GetEstimatedNumberOfThreads());
       this->Archive = factory.getArchive(filePath, coreType);
+      this->ConcurrentRead = coreType == Alembic::AbcCoreFactory::IFactory::kOgawa;
     }
     return this->Archive.valid();
   }
   Alembic::Abc::IArchive Archive;
+  bool ConcurrentRead = false;
 
 #if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 5, 20251210)
   std::unique_ptr<std::streambuf> Streambuf;
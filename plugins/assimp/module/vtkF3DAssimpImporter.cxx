@@ -1,13 +1,13 @@
 #include "vtkF3DAssimpImporter.h"
 
+#include "F3DTextureCache.h"
+
 #include <vtkActor.h>
 #include <vtkActorCollection.h>
 #include <vtkCamera.h>
 #include <vtkDoubleArray.h>
 #include <vtkFloatArray.h>
 #include <vtkImageData.h>
-#include <vtkImageReader2.h>
-#include <vtkImageReader2Factory.h>
 #include <vtkInformation.h>
 #include <vtkLight.h>
 #include <vtkMatrix4x4.h>
@@ -41,6 +41,7 @@
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
 
+#include <future>
 #include <memory>
 #include <regex>
 #include <set>
@@ -170,76 +171,109 @@ public:
 
   //----------------------------------------------------------------------------
   /**
-   * Generate a VTK texture from a file path
+   * Submit the decoding of all the textures used by the materials so it runs in the background
+   * while the meshes are converted
    */
-  vtkSmartPointer<vtkTexture> CreateTexture(const char* path, bool sRGB = false)
+  void SubmitTextures()
   {
-    vtkSmartPointer<vtkTexture> vTexture;
+    const aiTextureType types[] = { aiTextureType_DIFFUSE, aiTextureType_NORMALS,
+      aiTextureType_BASE_COLOR, aiTextureType_EMISSIVE };
+
+    for (unsigned int i = 0; i < this->Scene->mNumMaterials; i++)
+    {
+      for (aiTextureType type : types)
+      {
+        aiString path;
+        if (this->Scene->mMaterials[i]->GetTexture(type, 0, &path) == aiReturn_SUCCESS &&
+          this->PendingTextures.count(path.C_Str()) == 0)
+        {
+          this->PendingTextures.emplace(path.C_Str(), this->SubmitTexture(path.C_Str()));
+        }
+      }
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  /**
+   * Submit the decoding of a texture from a file path or an embedded texture index
+   */
+  F3DTextureCache::Image SubmitTexture(const char* path)
+  {
+    const aiTexture* aTexture = nullptr;
 
     if (path[0] == '*')
     {
       int texIndex = std::atoi(path + 1);
 
-      if (texIndex >= 0 && texIndex < static_cast<int>(this->EmbeddedTextures.size()))
+      if (texIndex >= 0 && texIndex < static_cast<int>(this->Scene->mNumTextures))
       {
-        vTexture = this->EmbeddedTextures[texIndex];
+        aTexture = this->Scene->mTextures[texIndex];
       }
     }
 
-    if (!vTexture)
+    if (!aTexture)
     {
       // sometimes, embedded textures are indexed by filename
-      const aiTexture* aTexture = this->Scene->GetEmbeddedTexture(path);
+      aTexture = this->Scene->GetEmbeddedTexture(path);
+    }
 
-      if (aTexture)
+    if (aTexture)
+    {
+      if (aTexture->mHeight == 0)
       {
-        vTexture = this->CreateEmbeddedTexture(aTexture);
+        return F3DTextureCache::DecodeBuffer(
+          aTexture->pcData, aTexture->mWidth, aTexture->achFormatHint);
       }
-      else
-      {
-        const char* filename = this->Parent->GetFileName();
-        if (!filename)
-        {
-          vtkWarningWithObjectMacro(
-            this->Parent, "Cannot read texture from file without a filename");
-          return nullptr;
-        }
 
-        std::string dir = vtksys::SystemTools::GetParentDirectory(filename);
-        std::string texturePath = vtksys::SystemTools::CollapseFullPath(path, dir);
+      // raw textures do not need decoding
+      vtkSmartPointer<vtkImageData> image = this->CreateRawImage(aTexture);
+      return std::async(std::launch::deferred, [image]() { return image; }).share();
+    }
 
-        // try to get the texture in the same dir as the model file
-        if (!vtksys::SystemTools::FileExists(texturePath))
-        {
-          std::string fileName = vtksys::SystemTools::GetFilenameName(path);
-          texturePath = vtksys::SystemTools::CollapseFullPath(fileName, dir);
-        }
+    const char* filename = this->Parent->GetFileName();
+    if (!filename)
+    {
+      vtkWarningWithObjectMacro(this->Parent, "Cannot read texture from file without a filename");
+      return {};
+    }
 
-        if (vtksys::SystemTools::FileExists(texturePath))
-        {
-          vtkSmartPointer<vtkImageReader2> reader;
-          reader.TakeReference(vtkImageReader2Factory::CreateImageReader2(texturePath.c_str()));
+    std::string dir = vtksys::SystemTools::GetParentDirectory(filename);
+    std::string texturePath = vtksys::SystemTools::CollapseFullPath(path, dir);
 
-          if (!reader)
-          {
-            vtkWarningWithObjectMacro(
-              this->Parent, "Cannot instantiate the image reader for texture: " << texturePath);
-            return nullptr;
-          }
+    // try to get the texture in the same dir as the model file
+    if (!vtksys::SystemTools::FileExists(texturePath))
+    {
+      std::string fileName = vtksys::SystemTools::GetFilenameName(path);
+      texturePath = vtksys::SystemTools::CollapseFullPath(fileName, dir);
+    }
+
+    if (!vtksys::SystemTools::FileExists(texturePath))
+    {
+      vtkWarningWithObjectMacro(this->Parent, "Cannot find texture: " << texturePath);
+      return {};
+    }
 
-          reader->SetFileName(texturePath.c_str());
+    return F3DTextureCache::DecodeFile(texturePath);
+  }
 
-          vTexture = vtkSmartPointer<vtkTexture>::New();
-          vTexture->SetInputConnection(reader->GetOutputPort());
-        }
-        else
-        {
-          vtkWarningWithObjectMacro(this->Parent, "Cannot find texture: " << texturePath);
-          return nullptr;
-        }
-      }
+  //----------------------------------------------------------------------------
+  /**
+   * Generate a VTK texture from a file path, waiting for its decoding if needed
+   */
+  vtkSmartPointer<vtkTexture> CreateTexture(const char* path, bool sRGB = false)
+  {
+    auto it = this->PendingTextures.find(path);
+    F3DTextureCache::Image pending =
+      it != this->PendingTextures.end() ? it->second : this->SubmitTexture(path);
+
+    vtkSmartPointer<vtkImageData> image = pending.valid() ? pending.get() : nullptr;
+    if (!image)
+    {
+      return nullptr;
     }
 
+    vtkNew<vtkTexture> vTexture;
+    vTexture->SetInputData(image);
     vTexture->MipmapOn();
     vTexture->InterpolateOn();
     vTexture->SetColorModeToDirectScalars();
@@ -250,57 +284,30 @@ public:
 
   //----------------------------------------------------------------------------
   /**
-   * Generate a VTK texture from an embedded ASSIMP texture
+   * Generate a VTK image from a raw embedded ASSIMP texture
    */
-  vtkSmartPointer<vtkTexture> CreateEmbeddedTexture(const aiTexture* aTexture)
+  vtkSmartPointer<vtkImageData> CreateRawImage(const aiTexture* aTexture)
   {
-    vtkNew<vtkTexture> vTexture;
+    // Sometimes Assimp returns corrupted textures (encountered with 3MF)
+    // Let's validate it before trying to read it
+    // See https://github.com/assimp/assimp/issues/5328
+    std::regex validRegexp("[rgba]{4}[0-9]{4}");
 
-    if (aTexture->mHeight == 0)
+    if (!std::regex_match(aTexture->achFormatHint, validRegexp))
     {
-      std::string fileType = aTexture->achFormatHint;
-
-      vtkSmartPointer<vtkImageReader2> reader;
-      reader.TakeReference(
-        vtkImageReader2Factory::CreateImageReader2FromExtension(fileType.c_str()));
-
-      if (reader)
-      {
-#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 5, 20251016)
-        vtkNew<vtkMemoryResourceStream> stream;
-        stream->SetBuffer(aTexture->pcData, aTexture->mWidth);
-        reader->SetStream(stream);
-#else
-        reader->SetMemoryBuffer(aTexture->pcData);
-        reader->SetMemoryBufferLength(aTexture->mWidth);
-#endif
-        reader->Update();
-        vTexture->SetInputConnection(reader->GetOutputPort());
-      }
+      return nullptr;
     }
-    else
-    {
-      // Sometimes Assimp returns corrupted textures (encountered with 3MF)
-      // Let's validate it before trying to read it
-      // See https://github.com/assimp/assimp/issues/5328
-      std::regex validRegexp("[rgba]{4}[0-9]{4}");
-
-      if (std::regex_match(aTexture->achFormatHint, validRegexp))
-      {
-        // only "rgba8888" is supported for now
-        vtkNew<vtkImageData> img;
-        img->SetDimensions(aTexture->mWidth, aTexture->mHeight, 1);
-        img->AllocateScalars(VTK_UNSIGNED_CHAR, 4);
 
-        unsigned char* imageBuffer = reinterpret_cast<unsigned char*>(img->GetScalarPointer());
-        std::copy(imageBuffer, imageBuffer + 4 * aTexture->mWidth * aTexture->mHeight,
-          reinterpret_cast<unsigned char*>(aTexture->pcData));
+    // only "rgba8888" is supported for now
+    vtkNew<vtkImageData> img;
+    img->SetDimensions(aTexture->mWidth, aTexture->mHeight, 1);
+    img->AllocateScalars(VTK_UNSIGNED_CHAR, 4);
 
-        vTexture->SetInputData(img);
-      }
-    }
+    unsigned char* imageBuffer = reinterpret_cast<unsigned char*>(img->GetScalarPointer());
+    std::copy(imageBuffer, imageBuffer + 4 * aTexture->mWidth * aTexture->mHeight,
+      reinterpret_cast<unsigned char*>(aTexture->pcData));
 
-    return vTexture;
+    return img;
   }
 
   //----------------------------------------------------------------------------
@@ -658,6 +665,9 @@ public:
 
     if (this->Scene)
     {
+      // decode textures in the background while converting meshes
+      this->SubmitTextures();
+
       // convert meshes to polyData
       this->Meshes.resize(this->Scene->mNumMeshes);
       for (unsigned int i = 0; i < this->Scene->mNumMeshes; i++)
@@ -665,19 +675,13 @@ public:
         this->Meshes[i] = this->CreateMesh(this->Scene->mMeshes[i]);
       }
 
-      // read embedded textures
-      this->EmbeddedTextures.resize(this->Scene->mNumTextures);
-      for (unsigned int i = 0; i < this->Scene->mNumTextures; i++)
-      {
-        this->EmbeddedTextures[i] = this->CreateEmbeddedTexture(this->Scene->mTextures[i]);
-      }
-
       // convert materials to properties
       this->Properties.resize(this->Scene->mNumMaterials);
       for (unsigned int i = 0; i < this->Scene->mNumMaterials; i++)
       {
         this->Properties[i] = this->CreateMaterial(this->Scene->mMaterials[i]);
       }
+      this->PendingTextures.clear();
       return true;
     }
     else
@@ -1051,7 +1055,7 @@ public:
   std::string Description;
   std::vector<vtkSmartPointer<vtkPolyData>> Meshes;
   std::vector<vtkSmartPointer<vtkProperty>> Properties;
-  std::vector<vtkSmartPointer<vtkTexture>> EmbeddedTextures;
+  std::unordered_map<std::string, F3DTextureCache::Image> PendingTextures;
   std::set<vtkIdType> EnabledAnimations; // indices of currently enabled animations
   std::vector<std::pair<std::string, vtkSmartPointer<vtkLight>>> Lights;
   std::vector<
@@ -13,11 +13,13 @@
 #include <vtkPoints.h>
 #include <vtkPolyData.h>
 #include <vtkResourceStream.h>
+#include <vtkSMPTools.h>
 
 #include <draco/compression/decode.h>
 #include <draco/draco_features.h>
 #include <draco/io/stdio_file_reader.h>
 
+#include <cstring>
 #include <string_view>
 
 #ifndef DRACO_MESH_COMPRESSION_SUPPORTED
@@ -41,15 +43,30 @@ public:
   {
     vtkNew<vtkAOSDataArrayTemplate<T>> arr;
 
-    arr->SetNumberOfComponents(attribute->num_components());
+    const int nbComponents = attribute->num_components();
+    arr->SetNumberOfComponents(nbComponents);
     arr->SetNumberOfTuples(nbPoints);
 
-    for (int i = 0; i < nbPoints; i++)
+    // decoded values are copied once, directly in the array memory
+    T* out = arr->GetPointer(0);
+    const size_t tupleSize = nbComponents * sizeof(T);
+    const size_t stride = static_cast<size_t>(attribute->byte_stride());
+    const uint8_t* data = attribute->buffer()->data() + attribute->byte_offset();
+    if (attribute->is_mapping_identity() && stride == tupleSize)
     {
-      draco::AttributeValueIndex idx = attribute->mapped_index(draco::PointIndex(i));
-      T* p = reinterpret_cast<T*>(attribute->buffer()->data() +
-        attribute->byte_stride() * idx.value() + attribute->byte_offset());
-      arr->SetTypedTuple(i, p);
+      std::memcpy(out, data, nbPoints * tupleSize);
+    }
+    else
+    {
+      vtkSMPTools::For(0, nbPoints,
+        [&](int first, int last)
+        {
+          for (int i = first; i < last; i++)
+          {
+            draco::AttributeValueIndex idx = attribute->mapped_index(draco::PointIndex(i));
+            std::memcpy(out + i * nbComponents, data + stride * idx.value(), tupleSize);
+          }
+        });
     }
 
     return arr;
@@ -146,19 +163,25 @@ public:
     offsets->SetNumberOfTuples(nbCells + 1);
     connectivity->SetNumberOfTuples(3 * nbCells);
 
-    for (int i = 0; i < nbCells; i++)
-    {
-      const draco::Mesh::Face& face = mesh->face(draco::FaceIndex(i));
+    vtkIdType* offsetsPtr = offsets->GetPointer(0);
+    vtkIdType* connectivityPtr = connectivity->GetPointer(0);
+    vtkSMPTools::For(0, nbCells,
+      [&](int first, int last)
+      {
+        for (int i = first; i < last; i++)
+        {
+          const draco::Mesh::Face& face = mesh->face(draco::FaceIndex(i));
 
-      offsets->SetTypedComponent(i, 0, 3 * i);
+          offsetsPtr[i] = 3 * i;
 
-      for (int j = 0; j < 3; j++)
-      {
-        connectivity->SetTypedComponent(3 * i + j, 0, face[j].value());
-      }
-    }
+          for (int j = 0; j < 3; j++)
+          {
+            connectivityPtr[3 * i + j] = face[j].value();
+          }
+        }
+      });
 
-    offsets->SetTypedComponent(nbCells, 0, 3 * nbCells);
+    offsetsPtr[nbCells] = 3 * nbCells;
 
     vtkNew<vtkCellArray> cells;
     cells->SetData(offsets, connectivity);
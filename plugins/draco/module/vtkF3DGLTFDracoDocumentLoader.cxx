@@ -1,8 +1,9 @@
 #include "vtkF3DGLTFDracoDocumentLoader.h"
 
 #include <vtkObjectFactory.h>
+#include <vtkSMPTools.h>
 
-#include <algorithm>
+#include <cassert>
 
 #include "draco/compression/decode.h"
 
@@ -17,7 +18,7 @@ std::vector<char> ComponentDispatcher(vtkGLTFDocumentLoader::ComponentType compT
     case vtkGLTFDocumentLoader::ComponentType::BYTE:
       return Decoder().template decode<int8_t>(args...);
     case vtkGLTFDocumentLoader::ComponentType::UNSIGNED_BYTE:
-      return Decoder().template decode<uint16_t>(args...);
+      return Decoder().template decode<uint8_t>(args...);
     case vtkGLTFDocumentLoader::ComponentType::SHORT:
       return Decoder().template decode<int16_t>(args...);
     case vtkGLTFDocumentLoader::ComponentType::UNSIGNED_SHORT:
@@ -34,22 +35,21 @@ std::vector<char> ComponentDispatcher(vtkGLTFDocumentLoader::ComponentType compT
 }
 
 //----------------------------------------------------------------------------
+// Decoders write the values directly in the final buffer layout
 struct IndexBufferDecoder
 {
   template<typename T>
-  std::vector<char> decode(const std::unique_ptr<draco::Mesh>& mesh)
+  std::vector<char> decode(const draco::Mesh& mesh)
   {
-    std::vector<char> outBuffer(mesh->num_faces() * 3 * sizeof(T));
+    std::vector<char> outBuffer(mesh.num_faces() * 3 * sizeof(T));
+    T* out = reinterpret_cast<T*>(outBuffer.data());
 
-    for (draco::FaceIndex f(0); f < mesh->num_faces(); ++f)
+    for (draco::FaceIndex f(0); f < mesh.num_faces(); ++f)
     {
-      const draco::Mesh::Face& face = mesh->face(f);
-
-      T indices[3] = { static_cast<T>(face[0].value()), static_cast<T>(face[1].value()),
-        static_cast<T>(face[2].value()) };
-
-      std::copy(
-        indices, indices + 3, reinterpret_cast<T*>(outBuffer.data() + f.value() * sizeof(indices)));
+      const draco::Mesh::Face& face = mesh.face(f);
+      *out++ = static_cast<T>(face[0].value());
+      *out++ = static_cast<T>(face[1].value());
+      *out++ = static_cast<T>(face[2].value());
     }
 
     return outBuffer;
@@ -58,7 +58,7 @@ struct IndexBufferDecoder
 
 //----------------------------------------------------------------------------
 std::vector<char> DecodeIndexBuffer(
-  const std::unique_ptr<draco::Mesh>& mesh, vtkGLTFDocumentLoader::ComponentType compType)
+  const draco::Mesh& mesh, vtkGLTFDocumentLoader::ComponentType compType)
 {
   // indexing using float does not make sense
   assert(compType != vtkGLTFDocumentLoader::ComponentType::FLOAT);
@@ -70,21 +70,16 @@ std::vector<char> DecodeIndexBuffer(
 struct VertexBufferDecoder
 {
   template<typename T>
-  std::vector<char> decode(
-    const std::unique_ptr<draco::Mesh>& mesh, const draco::PointAttribute* attribute)
+  std::vector<char> decode(const draco::Mesh& mesh, const draco::PointAttribute* attribute)
   {
-    std::vector<char> outBuffer(mesh->num_points() * attribute->num_components() * sizeof(T));
-    std::vector<T> values(attribute->num_components());
+    const int nbComponents = attribute->num_components();
+    std::vector<char> outBuffer(mesh.num_points() * nbComponents * sizeof(T));
+    T* out = reinterpret_cast<T*>(outBuffer.data());
 
-    size_t byteOffset = 0;
-    for (draco::PointIndex i(0); i < mesh->num_points(); ++i)
+    for (draco::PointIndex i(0); i < mesh.num_points(); ++i)
     {
-      attribute->ConvertValue<T>(
-        attribute->mapped_index(i), attribute->num_components(), values.data());
-
-      std::ranges::copy(values, reinterpret_cast<T*>(outBuffer.data() + byteOffset));
-
-      byteOffset += sizeof(T) * attribute->num_components();
+      attribute->ConvertValue<T>(attribute->mapped_index(i), nbComponents, out);
+      out += nbComponents;
     }
 
     return outBuffer;
@@ -92,12 +87,28 @@ struct VertexBufferDecoder
 };
 
 //----------------------------------------------------------------------------
-std::vector<char> DecodeVertexBuffer(vtkGLTFDocumentLoader::ComponentType compType,
-  const std::unique_ptr<draco::Mesh>& mesh, int attIndex)
+std::vector<char> DecodeVertexBuffer(
+  vtkGLTFDocumentLoader::ComponentType compType, const draco::Mesh& mesh, int attIndex)
 {
-  return ComponentDispatcher<VertexBufferDecoder>(
-    compType, mesh, mesh->GetAttributeByUniqueId(attIndex));
+  const draco::PointAttribute* attribute = mesh.GetAttributeByUniqueId(attIndex);
+  if (!attribute)
+  {
+    return {};
+  }
+  return ComponentDispatcher<VertexBufferDecoder>(compType, mesh, attribute);
 }
+
+//----------------------------------------------------------------------------
+// Buffers decoded from a Draco compressed primitive, and the accessors they replace
+struct DecodedPrimitive
+{
+  vtkGLTFDocumentLoader::Primitive* Primitive = nullptr;
+  bool Valid = false;
+  std::vector<char> IndexBuffer;
+  int NumberOfIndices = 0;
+  std::vector<std::pair<int, std::vector<char>>> VertexBuffers;
+  int NumberOfPoints = 0;
+};
 }
 
 //----------------------------------------------------------------------------
@@ -114,69 +125,107 @@ std::vector<std::string> vtkF3DGLTFDracoDocumentLoader::GetSupportedExtensions()
 //----------------------------------------------------------------------------
 void vtkF3DGLTFDracoDocumentLoader::PrepareData()
 {
+  this->Superclass::PrepareData();
+
   std::shared_ptr<Model> model = this->GetInternalModel();
 
-  for (size_t i = 0; i < model->Meshes.size(); i++)
+  // collect primitives with Draco metadata
+  std::vector<DecodedPrimitive> decoded;
+  for (Mesh& mesh : model->Meshes)
   {
-    for (Primitive& primitive : model->Meshes[i].Primitives)
+    for (Primitive& primitive : mesh.Primitives)
     {
-      // check if Draco metadata is present
-      auto& dracoMetaData = primitive.ExtensionMetaData.KHRDracoMetaData;
-      if (dracoMetaData.BufferView >= 0)
+      if (primitive.ExtensionMetaData.KHRDracoMetaData.BufferView >= 0)
       {
-        auto& view = model->BufferViews[primitive.ExtensionMetaData.KHRDracoMetaData.BufferView];
-        auto& buffer = model->Buffers[view.Buffer];
+        decoded.emplace_back().Primitive = &primitive;
+      }
+    }
+  }
+
+  // Primitives are compressed independently, decode them concurrently.
+  // The model is only read here, decoded buffers are added afterwards.
+  vtkSMPTools::For(0, static_cast<vtkIdType>(decoded.size()),
+    [&](vtkIdType first, vtkIdType last)
+    {
+      for (vtkIdType d = first; d < last; d++)
+      {
+        DecodedPrimitive& result = decoded[d];
+        const Primitive& primitive = *result.Primitive;
+        const auto& dracoMetaData = primitive.ExtensionMetaData.KHRDracoMetaData;
+        const BufferView& view = model->BufferViews[dracoMetaData.BufferView];
+        const std::vector<char>& buffer = model->Buffers[view.Buffer];
 
         draco::DecoderBuffer decoderBuffer;
         decoderBuffer.Init(buffer.data() + view.ByteOffset, view.ByteLength);
         auto decodeResult = draco::Decoder().DecodeMeshFromBuffer(&decoderBuffer);
-        if (decodeResult.ok())
+        if (!decodeResult.ok())
         {
-          const std::unique_ptr<draco::Mesh>& mesh = decodeResult.value();
-
-          // handle index buffer
-          if (primitive.IndicesId >= 0)
-          {
-            auto& accessor = model->Accessors[primitive.IndicesId];
-
-            model->Buffers.emplace_back(::DecodeIndexBuffer(mesh, accessor.ComponentTypeValue));
-
-            vtkGLTFDocumentLoader::BufferView decodedIndexBufferView;
-            decodedIndexBufferView.Buffer = static_cast<int>(model->Buffers.size() - 1);
-            decodedIndexBufferView.ByteLength = model->Buffers.back().size();
-            decodedIndexBufferView.ByteOffset = 0;
-            decodedIndexBufferView.ByteStride = 0;
-            decodedIndexBufferView.Target =
-              static_cast<int>(vtkGLTFDocumentLoader::Target::ARRAY_BUFFER);
-            model->BufferViews.emplace_back(std::move(decodedIndexBufferView));
+          continue;
+        }
+        const draco::Mesh& mesh = *decodeResult.value();
 
-            accessor.BufferView = static_cast<int>(model->BufferViews.size() - 1);
-            accessor.Count = static_cast<int>(mesh->num_faces() * 3);
-          }
+        if (primitive.IndicesId >= 0)
+        {
+          result.IndexBuffer =
+            ::DecodeIndexBuffer(mesh, model->Accessors[primitive.IndicesId].ComponentTypeValue);
+          result.NumberOfIndices = static_cast<int>(mesh.num_faces() * 3);
+        }
 
-          // handle vertex attributes
-          for (const auto& attrib : dracoMetaData.AttributeIndices)
+        for (const auto& [name, attIndex] : dracoMetaData.AttributeIndices)
+        {
+          auto accessorIt = primitive.AttributeIndices.find(name);
+          if (accessorIt != primitive.AttributeIndices.end())
           {
-            auto& attrAccessor = model->Accessors[primitive.AttributeIndices[attrib.first]];
-
-            model->Buffers.emplace_back(
-              ::DecodeVertexBuffer(attrAccessor.ComponentTypeValue, mesh, attrib.second));
-
-            vtkGLTFDocumentLoader::BufferView decodedBufferView;
-            decodedBufferView.Buffer = static_cast<int>(model->Buffers.size() - 1);
-            decodedBufferView.ByteLength = model->Buffers.back().size();
-            decodedBufferView.ByteOffset = 0;
-            decodedBufferView.ByteStride = 0;
-            decodedBufferView.Target =
-              static_cast<int>(vtkGLTFDocumentLoader::Target::ELEMENT_ARRAY_BUFFER);
-            model->BufferViews.emplace_back(std::move(decodedBufferView));
-
-            attrAccessor.BufferView = static_cast<int>(model->BufferViews.size() - 1);
-            attrAccessor.Count = static_cast<int>(mesh->num_points());
-            attrAccessor.ByteOffset = 0;
+            result.VertexBuffers.emplace_back(accessorIt->second,
+              ::DecodeVertexBuffer(
+                model->Accessors[accessorIt->second].ComponentTypeValue, mesh, attIndex));
           }
         }
+        result.NumberOfPoints = static_cast<int>(mesh.num_points());
+        result.Valid = true;
       }
+    });
+
+  // move the decoded buffers in the model and point the accessors to them
+  auto addBufferView = [&](std::vector<char>&& data, vtkGLTFDocumentLoader::Target target)
+  {
+    model->Buffers.emplace_back(std::move(data));
+
+    vtkGLTFDocumentLoader::BufferView decodedBufferView;
+    decodedBufferView.Buffer = static_cast<int>(model->Buffers.size() - 1);
+    decodedBufferView.ByteLength = model->Buffers.back().size();
+    decodedBufferView.ByteOffset = 0;
+    decodedBufferView.ByteStride = 0;
+    decodedBufferView.Target = static_cast<int>(target);
+    model->BufferViews.emplace_back(std::move(decodedBufferView));
+    return static_cast<int>(model->BufferViews.size() - 1);
+  };
+
+  for (DecodedPrimitive& result : decoded)
+  {
+    if (!result.Valid)
+    {
+      vtkErrorMacro("Cannot decode Draco compressed primitive");
+      continue;
+    }
+
+    // handle index buffer
+    if (result.Primitive->IndicesId >= 0)
+    {
+      auto& accessor = model->Accessors[result.Primitive->IndicesId];
+      accessor.BufferView = addBufferView(
+        std::move(result.IndexBuffer), vtkGLTFDocumentLoader::Target::ARRAY_BUFFER);
+      accessor.Count = result.NumberOfIndices;
+    }
+
+    // handle vertex attributes
+    for (auto& [accessorIndex, data] : result.VertexBuffers)
+    {
+      auto& attrAccessor = model->Accessors[accessorIndex];
+      attrAccessor.BufferView =
+        addBufferView(std::move(data), vtkGLTFDocumentLoader::Target::ELEMENT_ARRAY_BUFFER);
+      attrAccessor.Count = result.NumberOfPoints;
+      attrAccessor.ByteOffset = 0;
     }
   }
 }
@@ -2,6 +2,39 @@ void applyCustomReader(vtkAlgorithm* algo, const std::string&, vtkResourceStream
 {
   vtkExodusIIReader* exReader = vtkExodusIIReader::SafeDownCast(algo);
   exReader->UpdateInformation();
-  exReader->SetAllArrayStatus(vtkExodusIIReader::NODAL, 1);
-  exReader->SetAllArrayStatus(vtkExodusIIReader::ELEM_BLOCK, 1);
+
+  // No check needed, we know the option exists
+  // When arrays are listed, only read them and the coloring array, otherwise read all arrays
+  std::string arrays = ",";
+  for (const std::string& name :
+    vtksys::SystemTools::SplitString(this->ReaderOptions.at("ExodusII.arrays"), ','))
+  {
+    const std::string trimmed = vtksys::SystemTools::TrimWhitespace(name);
+    if (!trimmed.empty())
+    {
+      arrays += trimmed + ",";
+    }
+  }
+  if (arrays == ",")
+  {
+    exReader->SetAllArrayStatus(vtkExodusIIReader::NODAL, 1);
+    exReader->SetAllArrayStatus(vtkExodusIIReader::ELEM_BLOCK, 1);
+    return;
+  }
+  if (!this->ColoringArrayName.empty())
+  {
+    arrays += this->ColoringArrayName + ",";
+  }
+
+  for (int type : { vtkExodusIIReader::NODAL, vtkExodusIIReader::ELEM_BLOCK })
+  {
+    int numArrays = exReader->GetNumberOfObjectArrays(type);
+    for (int i = 0; i < numArrays; i++)
+    {
+      const char* arrayName = exReader->GetObjectArrayName(type, i);
+      const bool listed =
+        arrayName && arrays.find("," + std::string(arrayName) + ",") != std::string::npos;
+      exReader->SetObjectArrayStatus(type, i, listed ? 1 : 0);
+    }
+  }
 }
@@ -2,14 +2,33 @@ void applyCustomReader(vtkAlgorithm* algo, const std::string&, vtkResourceStream
 {
   vtkNetCDFReader* ncReader = vtkNetCDFReader::SafeDownCast(algo);
   ncReader->UpdateInformation();
-  
+
+  // No check needed, we know the option exists
+  // When arrays are listed, only read them and the coloring array, otherwise read all arrays
+  std::string arrays = ",";
+  for (const std::string& name :
+    vtksys::SystemTools::SplitString(this->ReaderOptions.at("NetCDF.arrays"), ','))
+  {
+    const std::string trimmed = vtksys::SystemTools::TrimWhitespace(name);
+    if (!trimmed.empty())
+    {
+      arrays += trimmed + ",";
+    }
+  }
+  const bool readAll = arrays == ",";
+  if (!this->ColoringArrayName.empty())
+  {
+    arrays += this->ColoringArrayName + ",";
+  }
+
   int numArrays = ncReader->GetNumberOfVariableArrays();
   for (int i = 0; i < numArrays; i++)
   {
     const char* arrayName = ncReader->GetVariableArrayName(i);
     if (arrayName)
     {
-      ncReader->SetVariableArrayStatus(arrayName, 1);
+      const bool listed = arrays.find("," + std::string(arrayName) + ",") != std::string::npos;
+      ncReader->SetVariableArrayStatus(arrayName, readAll || listed ? 1 : 0);
     }
   }
 }
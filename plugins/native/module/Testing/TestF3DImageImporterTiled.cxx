@@ -0,0 +1,110 @@
+#include <vtkActor.h>
+#include <vtkActorCollection.h>
+#include <vtkCamera.h>
+#include <vtkImageData.h>
+#include <vtkNew.h>
+#include <vtkRenderWindow.h>
+#include <vtkRenderer.h>
+#include <vtkTexture.h>
+
+#include "vtkF3DImageImporter.h"
+
+#include <iostream>
+
+namespace
+{
+bool CheckTextureSize(vtkActor* actor, int width, int height)
+{
+  vtkImageData* image = vtkImageData::SafeDownCast(actor->GetTexture()->GetInput());
+  if (!image)
+  {
+    std::cerr << "Missing tile image\n";
+    return false;
+  }
+
+  const int* dims = image->GetDimensions();
+  if (dims[0] != width || dims[1] != height)
+  {
+    std::cerr << "Unexpected tile size " << dims[0] << "x" << dims[1] << ", expected " << width
+              << "x" << height << "\n";
+    return false;
+  }
+  return true;
+}
+}
+
+int TestF3DImageImporterTiled(int vtkNotUsed(argc), char* argv[])
+{
+  // 10x6 RGB image, with the pixel value encoding its coordinates
+  std::string filename = std::string(argv[1]) + "data/TestF3DImageImporterTiled.png";
+
+  vtkNew<vtkRenderWindow> renWin;
+  renWin->SetSize(300, 300);
+  renWin->OffScreenRenderingOn();
+  vtkNew<vtkRenderer> renderer;
+  renWin->AddRenderer(renderer);
+
+  vtkNew<vtkF3DImageImporter> importer;
+  importer->SetFileName(filename.c_str());
+  importer->SetImageHint("png");
+  importer->SetTileSize(4);
+  importer->SetRenderWindow(renWin);
+  if (!importer->Update())
+  {
+    std::cerr << "Unexpected Update failure\n";
+    return EXIT_FAILURE;
+  }
+
+  vtkActorCollection* actors = importer->GetImportedActors();
+  if (actors->GetNumberOfItems() != 6)
+  {
+    std::cerr << "Unexpected number of tiles: " << actors->GetNumberOfItems() << "\n";
+    return EXIT_FAILURE;
+  }
+
+  // close to the image, tiles use the full resolution
+  renderer->ResetCamera();
+  renWin->Render();
+
+  actors->InitTraversal();
+  vtkActor* first = actors->GetNextActor();
+  if (!::CheckTextureSize(first, 4, 4))
+  {
+    return EXIT_FAILURE;
+  }
+
+  vtkImageData* image = vtkImageData::SafeDownCast(first->GetTexture()->GetInput());
+  unsigned char* pixel = static_cast<unsigned char*>(image->GetScalarPointer(3, 2, 0));
+  if (pixel[0] != 30 || pixel[1] != 20)
+  {
+    std::cerr << "Unexpected tile pixel value\n";
+    return EXIT_FAILURE;
+  }
+
+  // far from the image, tiles use the coarsest level which fits the image in one tile
+  renderer->GetActiveCamera()->Dolly(0.001);
+  renderer->ResetCameraClippingRange();
+  renWin->Render();
+
+  if (!::CheckTextureSize(first, 1, 1))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // in the image plane looking away from the first column of tiles, the tiles behind the camera
+  // use the coarsest level and the ones crossing the camera plane use the full resolution
+  vtkCamera* camera = renderer->GetActiveCamera();
+  camera->SetPosition(6.0, 3.0, 0.5);
+  camera->SetFocalPoint(20.0, 3.0, 0.5);
+  camera->SetViewUp(0.0, 0.0, 1.0);
+  renderer->ResetCameraClippingRange();
+  renWin->Render();
+
+  vtkActor* second = actors->GetNextActor();
+  if (!::CheckTextureSize(first, 1, 1) || !::CheckTextureSize(second, 4, 4))
+  {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,70 @@
+#include <vtkActor.h>
+#include <vtkActorCollection.h>
+#include <vtkImageData.h>
+#include <vtkNew.h>
+#include <vtkRenderWindow.h>
+#include <vtkRenderer.h>
+#include <vtkTexture.h>
+
+#include "vtkF3DImageImporter.h"
+
+#include <iostream>
+
+int TestF3DImageImporterTiledBackground(int vtkNotUsed(argc), char* argv[])
+{
+  // 10x6 RGB image, with the pixel value encoding its coordinates
+  std::string filename = std::string(argv[1]) + "data/TestF3DImageImporterTiled.png";
+
+  vtkNew<vtkRenderWindow> renWin;
+  renWin->SetSize(300, 300);
+  renWin->OffScreenRenderingOn();
+  vtkNew<vtkRenderer> renderer;
+  renWin->AddRenderer(renderer);
+
+  vtkNew<vtkF3DImageImporter> importer;
+  importer->SetFileName(filename.c_str());
+  importer->SetImageHint("png");
+  importer->SetTileSize(4);
+  importer->ForceBackgroundLevelsOn();
+  importer->SetRenderWindow(renWin);
+  if (!importer->Update())
+  {
+    std::cerr << "Unexpected Update failure\n";
+    return EXIT_FAILURE;
+  }
+
+  vtkActorCollection* actors = importer->GetImportedActors();
+  actors->InitTraversal();
+  vtkActor* first = actors->GetNextActor();
+
+  // the first render queues the levels and shows the placeholder meanwhile
+  renderer->ResetCamera();
+  renWin->Render();
+
+  vtkImageData* image = vtkImageData::SafeDownCast(first->GetTexture()->GetInput());
+  if (!image || image->GetDimensions()[0] != 1 || image->GetDimensions()[1] != 1)
+  {
+    std::cerr << "Tile does not show the placeholder before its level is created\n";
+    return EXIT_FAILURE;
+  }
+
+  // the next render uses the levels created in the background
+  importer->WaitForTileLevels();
+  renWin->Render();
+
+  image = vtkImageData::SafeDownCast(first->GetTexture()->GetInput());
+  if (!image || image->GetDimensions()[0] != 4 || image->GetDimensions()[1] != 4)
+  {
+    std::cerr << "Tile does not show the level created in the background\n";
+    return EXIT_FAILURE;
+  }
+
+  unsigned char* pixel = static_cast<unsigned char*>(image->GetScalarPointer(3, 2, 0));
+  if (pixel[0] != 30 || pixel[1] != 20)
+  {
+    std::cerr << "Unexpected tile pixel value\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
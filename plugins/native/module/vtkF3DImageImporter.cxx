@@ -1,22 +1,905 @@
 #include "vtkF3DImageImporter.h"
 
+#include <vtkCallbackCommand.h>
+#include <vtkCamera.h>
 #include <vtkCommand.h>
+#include <vtkEndian.h>
 #include <vtkFloatArray.h>
 #include <vtkImageData.h>
 #include <vtkImageReader2.h>
 #include <vtkImageReader2Collection.h>
 #include <vtkImageReader2Factory.h>
+#include <vtkMatrix4x4.h>
 #include <vtkPointData.h>
 #include <vtkPolyData.h>
 #include <vtkPolyDataMapper.h>
 #include <vtkProperty.h>
+#include <vtkRenderWindow.h>
+#include <vtkRenderWindowInteractor.h>
 #include <vtkRenderer.h>
 #include <vtkResourceStream.h>
+#include <vtkSMPTools.h>
 #include <vtkTexture.h>
+#include <vtkWeakPointer.h>
+#include <vtksys/SystemTools.hxx>
+
+#include <cstdio>
+
+#include <vtk_jpeg.h>
+#include <vtk_png.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <condition_variable>
+#include <csetjmp>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+// Maximum size in bytes of the tile levels kept in memory
+constexpr size_t TILE_CACHE_SIZE = 512 * 1024 * 1024;
+
+// Maximum size in bytes of the rows of the image decoded at once, at least one row is decoded
+constexpr size_t CHUNK_SIZE = 256 * 1024 * 1024;
+
+//----------------------------------------------------------------------------
+/**
+ * Create a textured quad covering the [x0, x1]x[y0, y1] rectangle
+ */
+vtkSmartPointer<vtkPolyData> CreateQuad(double x0, double y0, double x1, double y1)
+{
+  vtkNew<vtkPolyData> polydata;
+
+  // fill the polydata with a single quad
+  polydata->Allocate(1);
+  vtkIdType pts[4] = { 0, 1, 2, 3 };
+  polydata->InsertNextCell(VTK_QUAD, 4, pts);
+
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(4);
+  points->SetPoint(0, x0, y0, 0.0);
+  points->SetPoint(1, x1, y0, 0.0);
+  points->SetPoint(2, x1, y1, 0.0);
+  points->SetPoint(3, x0, y1, 0.0);
+
+  polydata->SetPoints(points);
+  vtkNew<vtkFloatArray> tcoords;
+  tcoords->SetNumberOfComponents(2);
+  tcoords->SetNumberOfTuples(4);
+  tcoords->SetTuple2(0, 0.0, 0.0);
+  tcoords->SetTuple2(1, 1.0, 0.0);
+  tcoords->SetTuple2(2, 1.0, 1.0);
+  tcoords->SetTuple2(3, 0.0, 1.0);
+  polydata->GetPointData()->SetTCoords(tcoords);
+
+  return polydata;
+}
+
+//----------------------------------------------------------------------------
+/**
+ * A tile level created from the rows of the image.
+ * Rows are accumulated in any order as long as the rows of a block are contiguous.
+ */
+struct PendingLevel
+{
+  std::pair<size_t, int> Level; // a tile index and a level
+  std::array<int, 4> Region; // xmin, xmax, ymin, ymax in pixels, max excluded
+  int Factor = 1;
+  vtkSmartPointer<vtkImageData> Image;
+  std::vector<double> Sums; // sums of the pixels of the current row of blocks
+  int BlockRows = 0; // rows accumulated in the current row of blocks
+  int Rows = 0; // rows accumulated in total
+};
+
+//----------------------------------------------------------------------------
+/**
+ * Accumulate the [yBegin, yEnd) rows of an image in the blocks of factor x factor pixels of a
+ * pending level, from the top row when topDown is true. Each row of blocks is averaged into the
+ * level image once all its rows are accumulated.
+ * src points to the first pixel of the row srcY0 of an image srcWidth pixels wide.
+ */
+template<typename T>
+void AccumulateRows(const T* src, int srcWidth, int srcY0, int nbComps, int yBegin, int yEnd,
+  bool topDown, PendingLevel& level)
+{
+  const std::array<int, 4>& region = level.Region;
+  const int factor = level.Factor;
+  const int dstWidth = level.Image->GetDimensions()[0];
+  T* dst = static_cast<T*>(level.Image->GetScalarPointer());
+
+  const int first = std::max(yBegin, region[2]);
+  const int last = std::min(yEnd, region[3]);
+  for (int k = 0; k < last - first; k++)
+  {
+    const int y = topDown ? last - 1 - k : first + k;
+    const T* row = src + static_cast<size_t>(y - srcY0) * srcWidth * nbComps;
+    for (int i = 0; i < dstWidth; i++)
+    {
+      const int x0 = region[0] + i * factor;
+      const int x1 = std::min(x0 + factor, region[1]);
+      const T* pixel = row + static_cast<size_t>(x0) * nbComps;
+      double* sum = level.Sums.data() + static_cast<size_t>(i) * nbComps;
+      for (int x = x0; x < x1; x++, pixel += nbComps)
+      {
+        for (int c = 0; c < nbComps; c++)
+        {
+          sum[c] += static_cast<double>(pixel[c]);
+        }
+      }
+    }
+    level.Rows++;
+
+    const int j = (y - region[2]) / factor;
+    const int y0 = region[2] + j * factor;
+    const int y1 = std::min(y0 + factor, region[3]);
+    if (++level.BlockRows < y1 - y0)
+    {
+      continue;
+    }
+
+    T* out = dst + static_cast<size_t>(j) * dstWidth * nbComps;
+    for (int i = 0; i < dstWidth; i++)
+    {
+      const int x0 = region[0] + i * factor;
+      const int x1 = std::min(x0 + factor, region[1]);
+      const double count = static_cast<double>((x1 - x0) * (y1 - y0));
+      for (int c = 0; c < nbComps; c++)
+      {
+        const double value = level.Sums[static_cast<size_t>(i) * nbComps + c] / count;
+        out[static_cast<size_t>(i) * nbComps + c] =
+          static_cast<T>(std::is_integral_v<T> ? std::round(value) : value);
+      }
+    }
+    std::fill(level.Sums.begin(), level.Sums.end(), 0.0);
+    level.BlockRows = 0;
+  }
+}
+
+//----------------------------------------------------------------------------
+/**
+ * Decode the rows of an image file one after the other, from the top of the image.
+ * Contrary to vtkImageReader2, which decodes sequential formats from the start of the file for
+ * each update extent, the rows of all the chunks are decoded in a single pass.
+ */
+class RowDecoder
+{
+public:
+  virtual ~RowDecoder() = default;
+
+  /**
+   * Open the file, return false if it cannot be decoded by rows
+   * or if the rows do not match the provided layout of the reader output
+   */
+  virtual bool Open(const std::string& path, int width, int nbComps, int scalarType) = 0;
+
+  /**
+   * Decode the next row of the file in the provided buffer, return false on error
+   */
+  virtual bool ReadRow(unsigned char* row) = 0;
+};
+
+//----------------------------------------------------------------------------
+/**
+ * Decode non interlaced PNG files, with the same transformations as vtkPNGReader
+ */
+class PNGRowDecoder : public RowDecoder
+{
+public:
+  ~PNGRowDecoder() override
+  {
+    if (this->Png)
+    {
+      png_destroy_read_struct(&this->Png, this->Info ? &this->Info : nullptr, nullptr);
+    }
+    if (this->File)
+    {
+      fclose(this->File);
+    }
+  }
+
+  bool Open(const std::string& path, int width, int nbComps, int scalarType) override
+  {
+    this->File = vtksys::SystemTools::Fopen(path, "rb");
+    this->Png = png_create_read_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
+    this->Info = this->Png ? png_create_info_struct(this->Png) : nullptr;
+    if (!this->File || !this->Info || setjmp(png_jmpbuf(this->Png)))
+    {
+      return false;
+    }
+
+    png_init_io(this->Png, this->File);
+    png_read_info(this->Png, this->Info);
+
+    // interlaced files need the whole image to decode a row
+    if (png_get_interlace_type(this->Png, this->Info) != PNG_INTERLACE_NONE)
+    {
+      return false;
+    }
+
+    const int colorType = png_get_color_type(this->Png, this->Info);
+    const int bitDepth = png_get_bit_depth(this->Png, this->Info);
+    if (colorType == PNG_COLOR_TYPE_PALETTE)
+    {
+      png_set_palette_to_rgb(this->Png);
+    }
+    if (colorType == PNG_COLOR_TYPE_GRAY && bitDepth < 8)
+    {
+      png_set_expand_gray_1_2_4_to_8(this->Png);
+    }
+    if (png_get_valid(this->Png, this->Info, PNG_INFO_tRNS))
+    {
+      png_set_tRNS_to_alpha(this->Png);
+    }
+#ifndef VTK_WORDS_BIGENDIAN
+    if (bitDepth > 8)
+    {
+      png_set_swap(this->Png);
+    }
+#endif
+    png_read_update_info(this->Png, this->Info);
+
+    const size_t rowSize = static_cast<size_t>(width) * nbComps *
+      vtkAbstractArray::GetDataTypeSize(scalarType);
+    return png_get_channels(this->Png, this->Info) == nbComps &&
+      png_get_rowbytes(this->Png, this->Info) == rowSize;
+  }
+
+  bool ReadRow(unsigned char* row) override
+  {
+    if (setjmp(png_jmpbuf(this->Png)))
+    {
+      return false;
+    }
+    png_read_row(this->Png, row, nullptr);
+    return true;
+  }
+
+private:
+  FILE* File = nullptr;
+  png_structp Png = nullptr;
+  png_infop Info = nullptr;
+};
+
+//----------------------------------------------------------------------------
+/**
+ * Decode JPEG files, with the same output color space as vtkJPEGReader
+ */
+class JPEGRowDecoder : public RowDecoder
+{
+public:
+  ~JPEGRowDecoder() override
+  {
+    if (this->Created)
+    {
+      jpeg_destroy_decompress(&this->Info);
+    }
+    if (this->File)
+    {
+      fclose(this->File);
+    }
+  }
+
+  bool Open(const std::string& path, int width, int nbComps, int scalarType) override
+  {
+    this->File = vtksys::SystemTools::Fopen(path, "rb");
+    if (!this->File || scalarType != VTK_UNSIGNED_CHAR)
+    {
+      return false;
+    }
+
+    // errors jump back instead of exiting
+    this->Info.err = jpeg_std_error(&this->Error.Manager);
+    this->Error.Manager.error_exit = [](j_common_ptr info)
+    { std::longjmp(reinterpret_cast<ErrorManager*>(info->err)->Buffer, 1); };
+    this->Error.Manager.output_message = [](j_common_ptr) {};
+    if (setjmp(this->Error.Buffer))
+    {
+      return false;
+    }
+
+    jpeg_create_decompress(&this->Info);
+    this->Created = true;
+    jpeg_stdio_src(&this->Info, this->File);
+    jpeg_read_header(&this->Info, TRUE);
+    jpeg_start_decompress(&this->Info);
+
+    return static_cast<int>(this->Info.output_width) == width &&
+      this->Info.output_components == nbComps;
+  }
+
+  bool ReadRow(unsigned char* row) override
+  {
+    if (setjmp(this->Error.Buffer))
+    {
+      return false;
+    }
+    JSAMPROW rows[1] = { row };
+    return jpeg_read_scanlines(&this->Info, rows, 1) == 1;
+  }
+
+private:
+  struct ErrorManager
+  {
+    jpeg_error_mgr Manager;
+    std::jmp_buf Buffer;
+  };
+
+  FILE* File = nullptr;
+  jpeg_decompress_struct Info;
+  ErrorManager Error;
+  bool Created = false;
+};
+}
+
+//----------------------------------------------------------------------------
+class vtkF3DImageImporter::vtkInternals
+{
+public:
+  struct Tile
+  {
+    int Region[4]; // xmin, xmax, ymin, ymax in pixels, max excluded
+    vtkSmartPointer<vtkTexture> Texture;
+    int Level = -1;
+  };
+
+  struct CacheEntry
+  {
+    vtkSmartPointer<vtkImageData> Image;
+    size_t Size;
+    uint64_t LastUse;
+  };
+
+  // a tile index and a level
+  using Key = std::pair<size_t, int>;
+
+  struct Result
+  {
+    Key Level;
+    vtkSmartPointer<vtkImageData> Image;
+  };
+
+  //----------------------------------------------------------------------------
+  ~vtkInternals()
+  {
+    this->StopWorker();
+    if (this->Renderer)
+    {
+      this->Renderer->RemoveObserver(this->ObserverTag);
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  /**
+   * Stop the worker thread and remove the observer of the interactor timer
+   */
+  void StopWorker()
+  {
+    if (this->Worker.joinable())
+    {
+      {
+        std::lock_guard<std::mutex> lock(this->Mutex);
+        this->Stop = true;
+      }
+      this->Condition.notify_all();
+      this->Worker.join();
+    }
+    this->Idle.notify_all();
+    if (this->Interactor)
+    {
+      this->Interactor->RemoveObserver(this->TimerObserverTag);
+    }
+    this->Interactor = nullptr;
+    this->Stop = false;
+    this->Async = false;
+    this->Queue.clear();
+    this->InFlight.clear();
+    this->Results.clear();
+  }
+
+  //----------------------------------------------------------------------------
+  /**
+   * Compute the level of a tile so that one texel covers about one pixel on the screen
+   */
+  int ComputeLevel(vtkRenderer* renderer, const Tile& tile) const
+  {
+    vtkMatrix4x4* view = renderer->GetActiveCamera()->GetViewTransformMatrix();
+
+    int nbBehind = 0;
+    double bounds[4] = { VTK_DOUBLE_MAX, VTK_DOUBLE_MIN, VTK_DOUBLE_MAX, VTK_DOUBLE_MIN };
+    for (int corner = 0; corner < 4; corner++)
+    {
+      double point[4] = { static_cast<double>(tile.Region[corner % 2]),
+        static_cast<double>(tile.Region[2 + corner / 2]), 0.0, 1.0 };
+
+      // corners behind the camera cannot be projected
+      double viewPoint[4];
+      view->MultiplyPoint(point, viewPoint);
+      if (viewPoint[2] >= 0.0)
+      {
+        nbBehind++;
+        continue;
+      }
+
+      renderer->SetWorldPoint(point);
+      renderer->WorldToDisplay();
+      const double* display = renderer->GetDisplayPoint();
+      bounds[0] = std::min(bounds[0], display[0]);
+      bounds[1] = std::max(bounds[1], display[0]);
+      bounds[2] = std::min(bounds[2], display[1]);
+      bounds[3] = std::max(bounds[3], display[1]);
+    }
+
+    // a tile entirely behind the camera is not visible
+    if (nbBehind == 4)
+    {
+      return this->CoarsestLevel;
+    }
+
+    // a tile crossing the camera plane is close to the camera
+    if (nbBehind > 0)
+    {
+      return 0;
+    }
+
+    const int* size = renderer->GetSize();
+    if (bounds[1] < 0 || bounds[0] > size[0] || bounds[3] < 0 || bounds[2] > size[1])
+    {
+      return this->CoarsestLevel;
+    }
+
+    const double tileSize =
+      std::max(tile.Region[1] - tile.Region[0], tile.Region[3] - tile.Region[2]);
+    const double screenSize = std::max({ bounds[1] - bounds[0], bounds[3] - bounds[2], 1.0 });
+    const int level = static_cast<int>(std::floor(std::log2(tileSize / screenSize)));
+    return std::clamp(level, 0, this->CoarsestLevel);
+  }
+
+  //----------------------------------------------------------------------------
+  /**
+   * Decode the [y0, y1) rows of the image with the reader.
+   * When the image was read from a stream, it is fully decoded once and kept in memory.
+   */
+  vtkSmartPointer<vtkImageData> ReadChunk(int y0, int y1)
+  {
+    if (this->Image)
+    {
+      return this->Image;
+    }
+
+    int extent[6] = { 0, this->Width - 1, y0, y1 - 1, this->Slice, this->Slice };
+    this->Reader->UpdateExtent(extent);
+
+    vtkNew<vtkImageData> image;
+    image->ShallowCopy(this->Reader->GetOutput());
+    return image;
+  }
+
+  //----------------------------------------------------------------------------
+  /**
+   * Open a decoder reading the rows of the file in a single pass, when the reader decodes it
+   * sequentially. Returns nullptr when the reader can decode the rows directly.
+   */
+  std::unique_ptr<::RowDecoder> OpenRowDecoder() const
+  {
+    const char* fileName = this->Reader->GetFileName();
+    if (this->Image || !fileName)
+    {
+      return nullptr;
+    }
+
+    std::unique_ptr<::RowDecoder> decoder;
+    if (this->Reader->IsA("vtkPNGReader"))
+    {
+      decoder = std::make_unique<::PNGRowDecoder>();
+    }
+    else if (this->Reader->IsA("vtkJPEGReader"))
+    {
+      decoder = std::make_unique<::JPEGRowDecoder>();
+    }
+
+    if (decoder &&
+      !decoder->Open(fileName, this->Width, this->Reader->GetNumberOfScalarComponents(),
+        this->Reader->GetDataScalarType()))
+    {
+      decoder.reset();
+    }
+    return decoder;
+  }
+
+  //----------------------------------------------------------------------------
+  /**
+   * Create the requested tile levels in a single pass over the rows of the image, decoded by
+   * chunks bounded in memory. The levels are passed to the callback as soon as they are created.
+   */
+  template<typename Callback>
+  void CreateTileImages(const std::vector<Key>& requests, Callback&& callback)
+  {
+    if (requests.empty())
+    {
+      return;
+    }
+
+    const int nbComps = this->Reader->GetNumberOfScalarComponents();
+    const int scalarType = this->Reader->GetDataScalarType();
+
+    std::vector<::PendingLevel> levels(requests.size());
+    int yMin = this->Height;
+    int yMax = 0;
+    for (size_t i = 0; i < requests.size(); i++)
+    {
+      const Tile& tile = this->Tiles[requests[i].first];
+      ::PendingLevel& level = levels[i];
+      level.Level = requests[i];
+      std::copy(tile.Region, tile.Region + 4, level.Region.begin());
+      level.Factor = 1 << requests[i].second;
+
+      const int width = (tile.Region[1] - tile.Region[0] + level.Factor - 1) / level.Factor;
+      const int height = (tile.Region[3] - tile.Region[2] + level.Factor - 1) / level.Factor;
+      level.Image = vtkSmartPointer<vtkImageData>::New();
+      level.Image->SetDimensions(width, height, 1);
+      level.Image->AllocateScalars(scalarType, nbComps);
+      level.Sums.resize(static_cast<size_t>(width) * nbComps, 0.0);
+
+      yMin = std::min(yMin, tile.Region[2]);
+      yMax = std::max(yMax, tile.Region[3]);
+    }
+
+    // accumulate the [y0, y1) rows of a chunk in the levels, and pass the completed ones
+    auto accumulate = [&](vtkImageData* chunk, int y0, int y1, bool topDown)
+    {
+      const int* extent = chunk->GetExtent();
+      vtkSMPTools::For(0, static_cast<vtkIdType>(levels.size()), 1,
+        [&](vtkIdType begin, vtkIdType end)
+        {
+          for (vtkIdType j = begin; j < end; j++)
+          {
+            if (!levels[j].Image)
+            {
+              continue;
+            }
+            switch (chunk->GetScalarType())
+            {
+              vtkTemplateMacro(
+                ::AccumulateRows(static_cast<const VTK_TT*>(chunk->GetScalarPointer()),
+                  extent[1] - extent[0] + 1, extent[2], nbComps, y0, y1, topDown, levels[j]));
+            }
+          }
+        });
+
+      std::vector<Result> results;
+      for (::PendingLevel& level : levels)
+      {
+        if (level.Image && level.Rows == level.Region[3] - level.Region[2])
+        {
+          results.push_back({ level.Level, std::move(level.Image) });
+        }
+      }
+      if (!results.empty())
+      {
+        callback(std::move(results));
+      }
+    };
+
+    std::unique_ptr<::RowDecoder> decoder = this->OpenRowDecoder();
+    if (decoder)
+    {
+      // the file is decoded from the top of the image, the rows above the tiles are skipped
+      std::vector<unsigned char> row(static_cast<size_t>(this->Width) * nbComps *
+        vtkAbstractArray::GetDataTypeSize(scalarType));
+      bool valid = true;
+      for (int y = this->Height - 1; y >= yMax && valid; y--)
+      {
+        valid = decoder->ReadRow(row.data());
+      }
+
+      vtkNew<vtkImageData> chunk;
+      for (int y1 = yMax; y1 > yMin && valid; y1 -= this->RowsPerChunk)
+      {
+        const int y0 = std::max(y1 - this->RowsPerChunk, yMin);
+        chunk->SetExtent(0, this->Width - 1, y0, y1 - 1, 0, 0);
+        chunk->AllocateScalars(scalarType, nbComps);
+        for (int y = y1 - 1; y >= y0 && valid; y--)
+        {
+          valid = decoder->ReadRow(static_cast<unsigned char*>(chunk->GetScalarPointer(0, y, 0)));
+        }
+        if (valid)
+        {
+          accumulate(chunk, y0, y1, true);
+        }
+      }
+
+      if (!valid)
+      {
+        vtkErrorWithObjectMacro(
+          this->Reader, "Could not decode the rows of " << this->Reader->GetFileName());
+      }
+      return;
+    }
+
+    for (int y0 = yMin; y0 < yMax; y0 += this->RowsPerChunk)
+    {
+      // chunks between the requested tiles are not decoded
+      const int y1 = std::min(y0 + this->RowsPerChunk, yMax);
+      if (std::any_of(levels.begin(), levels.end(), [&](const ::PendingLevel& level)
+            { return level.Image && level.Region[2] < y1 && level.Region[3] > y0; }))
+      {
+        accumulate(this->ReadChunk(y0, y1), y0, y1, false);
+      }
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  /**
+   * Create the queued tile levels in the background until stopped
+   */
+  void RunWorker()
+  {
+    std::unique_lock<std::mutex> lock(this->Mutex);
+    while (true)
+    {
+      this->Condition.wait(lock, [&] { return this->Stop || !this->Queue.empty(); });
+      if (this->Stop)
+      {
+        return;
+      }
+
+      std::vector<Key> requests;
+      requests.swap(this->Queue);
+      this->InFlight.insert(requests.begin(), requests.end());
+      lock.unlock();
+
+      this->CreateTileImages(requests,
+        [&](std::vector<Result>&& results)
+        {
+          std::lock_guard<std::mutex> resultsLock(this->Mutex);
+          for (Result& result : results)
+          {
+            this->InFlight.erase(result.Level);
+            this->Results.emplace_back(std::move(result));
+          }
+        });
+
+      // levels which could not be created are not in flight anymore
+      lock.lock();
+      for (const Key& key : requests)
+      {
+        this->InFlight.erase(key);
+      }
+      this->Idle.notify_all();
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  /**
+   * Add a created tile level to the cache
+   */
+  void AddToCache(Result&& result)
+  {
+    if (this->Cache.count(result.Level) > 0)
+    {
+      return;
+    }
+    const size_t size = result.Image->GetActualMemorySize() * 1024;
+    this->Cache[result.Level] = { std::move(result.Image), size, this->Frame };
+    this->CacheSize += size;
+  }
+
+  //----------------------------------------------------------------------------
+  /**
+   * Wait until the background thread created the queued tile levels
+   */
+  void WaitForWorker()
+  {
+    std::unique_lock<std::mutex> lock(this->Mutex);
+    this->Idle.wait(lock,
+      [&] { return !this->Async || (this->Queue.empty() && this->InFlight.empty()); });
+  }
+
+  //----------------------------------------------------------------------------
+  /**
+   * Start creating the tile levels in the background when the render window is interactive,
+   * or when forced. A render is triggered by the interactor timer when new levels are available.
+   * Otherwise, like when rendering offscreen, the levels are created before rendering.
+   */
+  void StartWorker(vtkRenderer* renderer)
+  {
+    vtkRenderWindow* renWin = renderer->GetRenderWindow();
+    vtkRenderWindowInteractor* interactor = renWin ? renWin->GetInteractor() : nullptr;
+    const bool interactive = interactor && !renWin->GetOffScreenRendering();
+    if (!interactive && !this->ForceBackground)
+    {
+      return;
+    }
+
+    this->Async = true;
+    this->Worker = std::thread(&vtkInternals::RunWorker, this);
+    if (!interactive)
+    {
+      return;
+    }
+
+    vtkNew<vtkCallbackCommand> timerCallback;
+    timerCallback->SetClientData(this);
+    timerCallback->SetCallback(
+      [](vtkObject*, unsigned long, void* clientData, void*)
+      {
+        vtkInternals* self = static_cast<vtkInternals*>(clientData);
+        bool available;
+        {
+          std::lock_guard<std::mutex> lock(self->Mutex);
+          available = !self->Results.empty();
+        }
+        if (available && self->Renderer && self->Renderer->GetRenderWindow())
+        {
+          self->Renderer->GetRenderWindow()->Render();
+        }
+      });
+    this->Interactor = interactor;
+    this->TimerObserverTag = interactor->AddObserver(vtkCommand::TimerEvent, timerCallback);
+  }
+
+  //----------------------------------------------------------------------------
+  /**
+   * Bind each tile to the level matching the current view.
+   * Missing levels are queued to the worker and the closest cached level is bound meanwhile,
+   * or they are created in parallel right away when there is no worker.
+   */
+  void Update(vtkRenderer* renderer)
+  {
+    this->Frame++;
+
+    if (!this->Started)
+    {
+      this->Started = true;
+      this->StartWorker(renderer);
+    }
+
+    std::vector<int> levels(this->Tiles.size());
+    std::vector<Key> missing;
+    for (size_t i = 0; i < this->Tiles.size(); i++)
+    {
+      levels[i] = this->ComputeLevel(renderer, this->Tiles[i]);
+      if (this->Cache.count({ i, levels[i] }) == 0)
+      {
+        missing.emplace_back(i, levels[i]);
+      }
+    }
+
+    if (this->Async)
+    {
+      std::vector<Result> results;
+      {
+        // replace the queued levels, the ones not needed anymore are dropped
+        std::lock_guard<std::mutex> lock(this->Mutex);
+        results.swap(this->Results);
+        this->Queue.clear();
+        for (const Key& key : missing)
+        {
+          if (this->InFlight.count(key) == 0)
+          {
+            this->Queue.emplace_back(key);
+          }
+        }
+      }
+      this->Condition.notify_one();
+
+      for (Result& result : results)
+      {
+        this->AddToCache(std::move(result));
+      }
+    }
+    else
+    {
+      this->CreateTileImages(missing,
+        [&](std::vector<Result>&& results)
+        {
+          for (Result& result : results)
+          {
+            this->AddToCache(std::move(result));
+          }
+        });
+    }
+
+    for (size_t i = 0; i < this->Tiles.size(); i++)
+    {
+      // use the closest available level, preferring the coarser ones
+      int level = -1;
+      for (int delta = 0; delta <= this->CoarsestLevel && level < 0; delta++)
+      {
+        for (int candidate : { levels[i] + delta, levels[i] - delta })
+        {
+          if (candidate >= 0 && candidate <= this->CoarsestLevel &&
+            this->Cache.count({ i, candidate }) > 0)
+          {
+            level = candidate;
+            break;
+          }
+        }
+      }
+
+      Tile& tile = this->Tiles[i];
+      if (level < 0)
+      {
+        continue;
+      }
+
+      CacheEntry& entry = this->Cache[{ i, level }];
+      entry.LastUse = this->Frame;
+      if (tile.Level != level)
+      {
+        tile.Texture->SetInputData(entry.Image);
+        tile.Level = level;
+      }
+    }
+
+    // evict the least recently used levels, the ones used by this frame are kept
+    while (this->CacheSize > ::TILE_CACHE_SIZE)
+    {
+      auto oldest = std::min_element(this->Cache.begin(), this->Cache.end(),
+        [](const auto& a, const auto& b) { return a.second.LastUse < b.second.LastUse; });
+      if (oldest == this->Cache.end() || oldest->second.LastUse == this->Frame)
+      {
+        break;
+      }
+      this->CacheSize -= oldest->second.Size;
+      this->Cache.erase(oldest);
+    }
+  }
+
+  vtkSmartPointer<vtkImageReader2> Reader;
+  vtkSmartPointer<vtkImageData> Image;
+  int Width = 0;
+  int Height = 0;
+  int Slice = 0;
+  int TileSize = 0;
+  int RowsPerChunk = 1;
+
+  std::vector<Tile> Tiles;
+  int CoarsestLevel = 0;
+
+  std::map<Key, CacheEntry> Cache;
+  size_t CacheSize = 0;
+  uint64_t Frame = 0;
+
+  vtkWeakPointer<vtkRenderer> Renderer;
+  unsigned long ObserverTag = 0;
+
+  // background creation of the tile levels, the reader is only used by the worker
+  bool Started = false;
+  bool ForceBackground = false;
+  bool Async = false;
+  std::thread Worker;
+  std::mutex Mutex;
+  std::condition_variable Condition;
+  std::condition_variable Idle;
+  bool Stop = false;
+  std::vector<Key> Queue;
+  std::set<Key> InFlight;
+  std::vector<Result> Results;
+  vtkWeakPointer<vtkRenderWindowInteractor> Interactor;
+  unsigned long TimerObserverTag = 0;
+};
 
 //----------------------------------------------------------------------------
 vtkStandardNewMacro(vtkF3DImageImporter);
 
+//----------------------------------------------------------------------------
+vtkF3DImageImporter::vtkF3DImageImporter()
+  : Internals(new vtkF3DImageImporter::vtkInternals())
+{
+}
+
+//----------------------------------------------------------------------------
+vtkF3DImageImporter::~vtkF3DImageImporter() = default;
+
 //----------------------------------------------------------------------------
 void vtkF3DImageImporter::ImportActors(vtkRenderer* renderer)
 {
@@ -62,46 +945,27 @@ void vtkF3DImageImporter::ImportActors(vtkRenderer* renderer)
   int w = extent[1] - extent[0] + 1;
   int h = extent[3] - extent[2] + 1;
 
+  // HDR and EXR files are expressed in linear color space
+  // All other ones so far are gamma-corrected
+  const bool sRGB = this->ImageHint != "hdr" && this->ImageHint != "exr";
+
+  // KTX2 textures are uploaded with their own mipmap levels, and may only be decoded by the texture
+  if ((w > this->TileSize || h > this->TileSize) && this->ImageHint != "ktx2")
+  {
+    this->ImportTiles(renderer, reader, w, h, sRGB);
+    return;
+  }
+
   vtkNew<vtkTexture> texture;
   texture->SetInputConnection(reader->GetOutputPort());
   texture->SetColorModeToDirectScalars();
-
-  vtkNew<vtkPolyData> polydata;
-
-  // fill the polydata with a single quad
-  polydata->Allocate(1);
-  vtkIdType pts[4] = { 0, 1, 2, 3 };
-  polydata->InsertNextCell(VTK_QUAD, 4, pts);
-
-  vtkNew<vtkPoints> points;
-  points->SetNumberOfPoints(4);
-  points->SetPoint(0, 0.0, 0.0, 0.0);
-  points->SetPoint(1, static_cast<double>(w), 0.0, 0.0);
-  points->SetPoint(2, static_cast<double>(w), static_cast<double>(h), 0.0);
-  points->SetPoint(3, 0.0, static_cast<double>(h), 0.0);
-
-  polydata->SetPoints(points);
-  vtkNew<vtkFloatArray> tcoords;
-  tcoords->SetNumberOfComponents(2);
-  tcoords->SetNumberOfTuples(4);
-  tcoords->SetTuple2(0, 0.0, 0.0);
-  tcoords->SetTuple2(1, 1.0, 0.0);
-  tcoords->SetTuple2(2, 1.0, 1.0);
-  tcoords->SetTuple2(3, 0.0, 1.0);
-  polydata->GetPointData()->SetTCoords(tcoords);
+  texture->SetUseSRGBColorSpace(sRGB);
 
   vtkNew<vtkActor> actor;
   vtkNew<vtkPolyDataMapper> mapper;
-  mapper->SetInputData(polydata);
+  mapper->SetInputData(::CreateQuad(0.0, 0.0, static_cast<double>(w), static_cast<double>(h)));
   actor->SetMapper(mapper);
 
-  // HDR and EXR files are expressed in linear color space
-  // All other ones so far are gamma-corrected
-  if (this->ImageHint != "hdr" && this->ImageHint != "exr")
-  {
-    texture->UseSRGBColorSpaceOn();
-  }
-
   actor->GetProperty()->LightingOff();
   actor->SetTexture(texture);
   renderer->AddActor(actor);
@@ -109,6 +973,106 @@ void vtkF3DImageImporter::ImportActors(vtkRenderer* renderer)
   this->ActorCollection->AddItem(actor);
 }
 
+//----------------------------------------------------------------------------
+void vtkF3DImageImporter::ImportTiles(
+  vtkRenderer* renderer, vtkImageReader2* reader, int width, int height, bool sRGB)
+{
+  vtkInternals& internals = *this->Internals;
+  internals.StopWorker();
+  internals.Started = false;
+  internals.Tiles.clear();
+  internals.Cache.clear();
+  internals.CacheSize = 0;
+  internals.Image = nullptr;
+  internals.Reader = reader;
+  internals.Width = width;
+  internals.Height = height;
+  internals.Slice = reader->GetDataExtent()[4];
+  internals.TileSize = this->TileSize;
+  internals.ForceBackground = this->ForceBackgroundLevels;
+
+  // a stream can only be decoded once, a file is decoded by chunks of rows when needed
+  if (!reader->GetFileName())
+  {
+    reader->Update();
+    internals.Image = reader->GetOutput();
+    internals.RowsPerChunk = height;
+  }
+  else
+  {
+    const size_t rowSize = static_cast<size_t>(width) * reader->GetNumberOfScalarComponents() *
+      vtkAbstractArray::GetDataTypeSize(reader->GetDataScalarType());
+    internals.RowsPerChunk = static_cast<int>(
+      std::clamp<size_t>(::CHUNK_SIZE / rowSize, 1, static_cast<size_t>(height)));
+  }
+
+  // the coarsest level fits the whole image in a single tile size
+  internals.CoarsestLevel = 0;
+  while ((std::max(width, height) >> internals.CoarsestLevel) > this->TileSize)
+  {
+    internals.CoarsestLevel++;
+  }
+
+  // tiles show an empty texture until one of their levels is created
+  vtkNew<vtkImageData> placeholder;
+  placeholder->SetDimensions(1, 1, 1);
+  placeholder->AllocateScalars(
+    reader->GetDataScalarType(), reader->GetNumberOfScalarComponents());
+  placeholder->GetPointData()->GetScalars()->Fill(0);
+
+  for (int y = 0; y < height; y += this->TileSize)
+  {
+    for (int x = 0; x < width; x += this->TileSize)
+    {
+      vtkInternals::Tile tile;
+      tile.Region[0] = x;
+      tile.Region[1] = std::min(x + this->TileSize, width);
+      tile.Region[2] = y;
+      tile.Region[3] = std::min(y + this->TileSize, height);
+
+      tile.Texture = vtkSmartPointer<vtkTexture>::New();
+      tile.Texture->SetInputData(placeholder);
+      tile.Texture->SetColorModeToDirectScalars();
+      tile.Texture->SetUseSRGBColorSpace(sRGB);
+      tile.Texture->InterpolateOn();
+      tile.Texture->MipmapOn();
+
+      vtkNew<vtkActor> actor;
+      vtkNew<vtkPolyDataMapper> mapper;
+      mapper->SetInputData(::CreateQuad(tile.Region[0], tile.Region[2], tile.Region[1],
+        tile.Region[3]));
+      actor->SetMapper(mapper);
+      actor->GetProperty()->LightingOff();
+      actor->SetTexture(tile.Texture);
+      renderer->AddActor(actor);
+      this->ActorCollection->AddItem(actor);
+
+      internals.Tiles.emplace_back(std::move(tile));
+    }
+  }
+
+  // bind the tiles to the levels matching the view before each render
+  if (internals.Renderer)
+  {
+    internals.Renderer->RemoveObserver(internals.ObserverTag);
+  }
+  vtkNew<vtkCallbackCommand> updateCallback;
+  updateCallback->SetClientData(&internals);
+  updateCallback->SetCallback(
+    [](vtkObject* caller, unsigned long, void* clientData, void*)
+    {
+      static_cast<vtkInternals*>(clientData)->Update(vtkRenderer::SafeDownCast(caller));
+    });
+  internals.Renderer = renderer;
+  internals.ObserverTag = renderer->AddObserver(vtkCommand::StartEvent, updateCallback);
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DImageImporter::WaitForTileLevels()
+{
+  this->Internals->WaitForWorker();
+}
+
 //------------------------------------------------------------------------------
 bool vtkF3DImageImporter::CanReadFile(vtkResourceStream* stream)
 {
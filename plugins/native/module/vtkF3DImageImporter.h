@@ -4,6 +4,16 @@
  *
  * This importer reads 2D image files using vtkImageReader2Factory and displays them as a textured
  * quad sized to the image dimensions. Supports both file-based and stream-based reading.
+ *
+ * Images larger than the tile size are split into several textured quads so they are not
+ * limited by the maximum texture size. Each time the renderer renders, every tile is bound to
+ * the mipmap level matching its size on screen, tiles outside of the view use the coarsest level.
+ * Image files are decoded by chunks of rows bounded in memory when levels are needed, so the
+ * whole image is never kept in memory. The missing levels are created in a single pass over the
+ * rows, PNG and JPEG files being decoded sequentially. Tile levels are computed in parallel and
+ * kept in a bounded cache. When the render window is interactive, they are computed by a
+ * background thread while the closest available level is shown, and a render is triggered by the
+ * interactor timer once they are ready.
  */
 
 #ifndef vtkF3DImageImporter_h
@@ -11,6 +21,10 @@
 
 #include <vtkF3DImporter.h>
 
+#include <memory>
+
+class vtkImageReader2;
+
 class vtkF3DImageImporter : public vtkF3DImporter
 {
 public:
@@ -34,17 +48,54 @@ public:
    */
   vtkSetMacro(ImageHint, std::string);
 
+  ///@{
+  /**
+   * Set/Get the maximum size in pixels of a tile.
+   * Images larger than this size in any dimension are tiled.
+   * Default is 4096.
+   */
+  vtkSetClampMacro(TileSize, int, 1, VTK_INT_MAX);
+  vtkGetMacro(TileSize, int);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get if the tile levels are computed by the background thread even when the render window
+   * is offscreen or not interactive. They are then used by the next render once ready.
+   * Default is false.
+   */
+  vtkSetMacro(ForceBackgroundLevels, bool);
+  vtkGetMacro(ForceBackgroundLevels, bool);
+  vtkBooleanMacro(ForceBackgroundLevels, bool);
+  ///@}
+
+  /**
+   * Wait until the background thread computed the tile levels requested by the last render
+   */
+  void WaitForTileLevels();
+
 protected:
-  vtkF3DImageImporter() = default;
-  ~vtkF3DImageImporter() override = default;
+  vtkF3DImageImporter();
+  ~vtkF3DImageImporter() override;
 
   void ImportActors(vtkRenderer*) override;
 
+  /**
+   * Import an image larger than the tile size as several tiles
+   */
+  void ImportTiles(
+    vtkRenderer* renderer, vtkImageReader2* reader, int width, int height, bool sRGB);
+
 private:
   vtkF3DImageImporter(const vtkF3DImageImporter&) = delete;
   void operator=(const vtkF3DImageImporter&) = delete;
 
   std::string ImageHint;
+  int TileSize = 4096;
+  bool ForceBackgroundLevels = false;
+
+  class vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
 };
 
 #endif
@@ -15,10 +15,14 @@
 #include <vtkPoints.h>
 #include <vtkPolyData.h>
 #include <vtkResourceStream.h>
+#include <vtkSMPTools.h>
 #include <vtkStreamingDemandDrivenPipeline.h>
 #include <vtkUnsignedCharArray.h>
 #include <vtkVersion.h>
 
+#include <algorithm>
+#include <vector>
+
 namespace
 {
 struct splat_t
@@ -28,6 +32,9 @@ struct splat_t
   unsigned char color[4];
   unsigned char rotation[4];
 };
+
+// Number of splats read at once, decoded in parallel
+constexpr size_t BLOCK_SIZE = 1 << 16;
 }
 
 //----------------------------------------------------------------------------
@@ -85,20 +92,36 @@ int vtkF3DSplatReader::RequestData(
   rotationArray->SetNumberOfTuples(nbSplats);
   rotationArray->SetName("rotation");
 
-  ::splat_t splat;
-  for (size_t i = 0; i < nbSplats; i++)
+  float* positions = positionArray->GetPointer(0);
+  float* scales = scaleArray->GetPointer(0);
+  unsigned char* colors = colorArray->GetPointer(0);
+  float* rotations = rotationArray->GetPointer(0);
+
+  // Read large blocks of splats and decode them in parallel chunks
+  std::vector<::splat_t> block(std::min(nbSplats, ::BLOCK_SIZE));
+  for (size_t offset = 0; offset < nbSplats; offset += block.size())
   {
+    const size_t count = std::min(block.size(), nbSplats - offset);
+
     // This cannot read less bytes than expected because of nbSplats being computed above
-    stream->Read(&splat, sizeof(::splat_t));
-
-    positionArray->SetTypedTuple(i, splat.position);
-    scaleArray->SetTypedTuple(i, splat.scale);
-    colorArray->SetTypedTuple(i, splat.color);
-    for (int c = 0; c < 4; c++)
-    {
-      rotationArray->SetTypedComponent(
-        i, c, (static_cast<float>(splat.rotation[c]) - 128.f) / 128.f);
-    }
+    stream->Read(block.data(), count * sizeof(::splat_t));
+
+    vtkSMPTools::For(0, static_cast<vtkIdType>(count),
+      [&](vtkIdType begin, vtkIdType end)
+      {
+        for (vtkIdType j = begin; j < end; j++)
+        {
+          const ::splat_t& splat = block[j];
+          const size_t i = offset + j;
+          std::copy_n(splat.position, 3, positions + 3 * i);
+          std::copy_n(splat.scale, 3, scales + 3 * i);
+          std::copy_n(splat.color, 4, colors + 4 * i);
+          for (int c = 0; c < 4; c++)
+          {
+            rotations[4 * i + c] = (static_cast<float>(splat.rotation[c]) - 128.f) / 128.f;
+          }
+        }
+      });
   }
 
   vtkNew<vtkPoints> points;
@@ -1,23 +1,207 @@
 #include "vtkF3DPDALReader.h"
 
+#include "vtkCellArray.h"
 #include "vtkFloatArray.h"
+#include "vtkIdTypeArray.h"
 #include "vtkPointData.h"
 #include "vtkSMPTools.h"
 #include "vtkTypeUInt16Array.h"
 
+#include <pdal/Options.hpp>
+#include <pdal/PointTable.hpp>
+#include <pdal/PointView.hpp>
+#include <pdal/StageFactory.hpp>
+#include <pdal/filters/StreamCallbackFilter.hpp>
+#include <pdal/io/BufferReader.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+// Number of points of the streaming buffer
+constexpr pdal::point_count_t STREAM_CAPACITY = 10000;
+}
+
 //----------------------------------------------------------------------------
 vtkStandardNewMacro(vtkF3DPDALReader);
 
+//----------------------------------------------------------------------------
+bool vtkF3DPDALReader::ReadWithPointBudget(vtkPolyData* output)
+{
+  if (!this->FileName)
+  {
+    vtkErrorMacro("No FileName specified");
+    return false;
+  }
+
+  try
+  {
+    pdal::StageFactory factory;
+    const std::string driverName = factory.inferReaderDriver(this->FileName);
+    pdal::Stage* reader = factory.createStage(driverName);
+    if (!reader)
+    {
+      vtkErrorMacro("Cannot infer PDAL reader for " << this->FileName);
+      return false;
+    }
+
+    // Read the points and add a vertex cell per point, as the superclass does
+    auto read = [&](pdal::Stage& stage)
+    {
+      vtkNew<vtkPolyData> points;
+      this->ReadPointRecordData(stage, points);
+      output->ShallowCopy(points);
+
+      const vtkIdType nbPoints = points->GetNumberOfPoints();
+      vtkNew<vtkIdTypeArray> offsets;
+      offsets->SetNumberOfTuples(nbPoints + 1);
+      vtkNew<vtkIdTypeArray> connectivity;
+      connectivity->SetNumberOfTuples(nbPoints);
+      vtkIdType* offsetsPtr = offsets->GetPointer(0);
+      vtkIdType* connectivityPtr = connectivity->GetPointer(0);
+      vtkSMPTools::For(0, nbPoints + 1,
+        [&](vtkIdType begin, vtkIdType end)
+        {
+          std::iota(offsetsPtr + begin, offsetsPtr + end, begin);
+          std::iota(connectivityPtr + begin, connectivityPtr + std::min(end, nbPoints), begin);
+        });
+
+      vtkNew<vtkCellArray> verts;
+      verts->SetData(offsets, connectivity);
+      output->SetVerts(verts);
+    };
+
+    pdal::Options options;
+    options.add("filename", this->FileName);
+    reader->setOptions(options);
+
+    // The header is enough to know the number of points and the bounds
+    const pdal::QuickInfo info = reader->preview();
+    if (!info.valid() || info.m_pointCount <= static_cast<pdal::point_count_t>(this->PointBudget))
+    {
+      read(*reader);
+      return true;
+    }
+
+    const pdal::point_count_t budget = static_cast<pdal::point_count_t>(this->PointBudget);
+    if (driverName == "readers.copc")
+    {
+      // COPC files are octrees whose levels are stored by increasing density,
+      // read only the levels needed to reach the spacing giving the point budget
+      const double area =
+        (info.m_bounds.maxx - info.m_bounds.minx) * (info.m_bounds.maxy - info.m_bounds.miny);
+      if (area > 0)
+      {
+        options.add("resolution", std::sqrt(area / static_cast<double>(this->PointBudget)));
+        options.add("threads", vtkSMPTools::GetEstimatedNumberOfThreads());
+        reader->setOptions(options);
+      }
+
+      pdal::PointTable levelsTable;
+      reader->prepare(levelsTable);
+      pdal::BufferReader levels;
+      pdal::point_count_t nbLevelsPoints = 0;
+      for (const pdal::PointViewPtr& view : reader->execute(levelsTable))
+      {
+        levels.addView(view);
+        nbLevelsPoints += view->size();
+      }
+      if (nbLevelsPoints <= budget)
+      {
+        read(levels);
+        return true;
+      }
+
+      // The spacing assumes evenly spread points, so the levels can exceed the budget,
+      // keep one of their points every step as for other formats
+      pdal::Stage* decimation = factory.createStage("filters.decimation");
+      pdal::Options decimationOptions;
+      decimationOptions.add("step", (nbLevelsPoints + budget - 1) / budget);
+      decimation->setOptions(decimationOptions);
+      decimation->setInput(levels);
+      read(*decimation);
+      return true;
+    }
+
+    // Other formats have no levels of detail, keep one point every step
+    pdal::Stage* decimation = factory.createStage("filters.decimation");
+    pdal::Options decimationOptions;
+    decimationOptions.add("step", (info.m_pointCount + budget - 1) / budget);
+    decimation->setOptions(decimationOptions);
+    decimation->setInput(*reader);
+    if (!decimation->pipelineStreamable())
+    {
+      read(*decimation);
+      return true;
+    }
+
+    // Stream the points through a fixed size buffer so only the kept points are in memory,
+    // they are copied to a view which is then read as any other stage
+    pdal::StreamCallbackFilter keep;
+    keep.setInput(*decimation);
+    pdal::FixedPointTable streamTable(STREAM_CAPACITY);
+    keep.prepare(streamTable);
+
+    pdal::PointTable keptTable;
+    const pdal::PointLayoutPtr layout = streamTable.layout();
+    std::vector<pdal::Dimension::Id> dims = layout->dims();
+    for (pdal::Dimension::Id dim : dims)
+    {
+      keptTable.layout()->registerOrAssignDim(layout->dimName(dim), layout->dimType(dim));
+    }
+    keptTable.finalize();
+    pdal::PointViewPtr kept = std::make_shared<pdal::PointView>(keptTable);
+    kept->setSpatialReference(streamTable.anySpatialReference());
+
+    std::vector<char> field;
+    keep.setCallback(
+      [&](pdal::PointRef& point)
+      {
+        const pdal::PointId idx = kept->size();
+        for (pdal::Dimension::Id dim : dims)
+        {
+          const pdal::Dimension::Type type = layout->dimType(dim);
+          field.resize(pdal::Dimension::size(type));
+          point.getField(field.data(), dim, type);
+          kept->setField(keptTable.layout()->findDim(layout->dimName(dim)), type, idx,
+            field.data());
+        }
+        return true;
+      });
+    keep.execute(streamTable);
+
+    pdal::BufferReader buffer;
+    buffer.addView(kept);
+    read(buffer);
+  }
+  catch (const std::exception& e)
+  {
+    vtkErrorMacro("Cannot read " << this->FileName << ": " << e.what());
+    return false;
+  }
+  return true;
+}
+
 //----------------------------------------------------------------------------
 int vtkF3DPDALReader::RequestData(
   vtkInformation*, vtkInformationVector**, vtkInformationVector* outputVector)
 {
-  if (this->Superclass::RequestData(nullptr, nullptr, outputVector) == 0)
+  vtkPolyData* output = vtkPolyData::GetData(outputVector);
+  if (this->PointBudget > 0)
+  {
+    if (!this->ReadWithPointBudget(output))
+    {
+      return 0;
+    }
+  }
+  else if (this->Superclass::RequestData(nullptr, nullptr, outputVector) == 0)
   {
     return 0;
   }
 
-  vtkPolyData* output = vtkPolyData::GetData(outputVector);
   vtkPointData* pointData = output->GetPointData();
   vtkTypeUInt16Array* colors = vtkTypeUInt16Array::SafeDownCast(pointData->GetArray("Color"));
   if (colors)
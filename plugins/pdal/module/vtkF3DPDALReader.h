@@ -3,7 +3,10 @@
  * @brief   Specialized version of the PDAL reader to read direct scalars data
  *
  * A specialized version of the vtkPDALReader that is able to read colors to be displayed
- * as direct scalars
+ * as direct scalars.
+ * It can also limit the number of points read to a point budget, using the octree levels of
+ * COPC files so only the coarsest levels needed are read, or decimating other files while
+ * streaming them so only the kept points are loaded.
  */
 
 #ifndef vtkF3DPDALReader_h
@@ -17,17 +20,38 @@ public:
   static vtkF3DPDALReader* New();
   vtkTypeMacro(vtkF3DPDALReader, vtkPDALReader);
 
+  ///@{
+  /**
+   * Set/Get the maximum number of points to read, 0 means no limit.
+   * COPC files are read up to the octree level whose resolution fits the budget,
+   * assuming points are spread over the XY extent, which is typical of aerial lidar,
+   * then decimated if these levels still exceed the budget.
+   * Other files are decimated by the smallest step that fits the budget.
+   * Default is 0.
+   */
+  vtkSetMacro(PointBudget, vtkIdType);
+  vtkGetMacro(PointBudget, vtkIdType);
+  ///@}
+
 protected:
   vtkF3DPDALReader() = default;
   ~vtkF3DPDALReader() override = default;
 
   /**
-   * Call request data on the superclass, then, if Colors are provided,
+   * Call request data on the superclass, or read the points within the point budget if any,
+   * then, if Colors are provided,
    * convert them into a normalized vtkDoubleArray for direct scalars rendering.
    */
   int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
 
 private:
+  /**
+   * Read the points of the file within the point budget into the output.
+   */
+  bool ReadWithPointBudget(vtkPolyData* output);
+
+  vtkIdType PointBudget = 0;
+
   vtkF3DPDALReader(const vtkF3DPDALReader&) = delete;
   void operator=(const vtkF3DPDALReader&) = delete;
 };
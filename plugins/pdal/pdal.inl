@@ -0,0 +1,9 @@
+void applyCustomReader(
+  vtkAlgorithm* algo, const std::string& vtkNotUsed(fileName), vtkResourceStream*) const override
+{
+  vtkF3DPDALReader* pdalReader = vtkF3DPDALReader::SafeDownCast(algo);
+
+  const std::string optName = "LAS.point_budget";
+  const std::string str = this->ReaderOptions.at(optName);
+  pdalReader->SetPointBudget(static_cast<vtkIdType>(F3DUtils::ParseToInt64(str, 0, optName)));
+}
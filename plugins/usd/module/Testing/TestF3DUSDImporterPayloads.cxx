@@ -0,0 +1,70 @@
+#include "vtkF3DUSDImporter.h"
+
+#include <vtkActor.h>
+#include <vtkActorCollection.h>
+#include <vtkNew.h>
+#include <vtkPolyData.h>
+#include <vtkPolyDataMapper.h>
+#include <vtkProperty.h>
+#include <vtkRenderer.h>
+
+#include <cmath>
+#include <iostream>
+#include <string>
+
+namespace
+{
+vtkActor* ImportSingleActor(vtkF3DUSDImporter* importer, const std::string& path)
+{
+  importer->SetFileName(path.c_str());
+  importer->Update();
+
+  vtkActorCollection* actors = importer->GetRenderer()->GetActors();
+  if (actors->GetNumberOfItems() != 1)
+  {
+    std::cerr << "Unexpected number of actors: " << actors->GetNumberOfItems() << "\n";
+    return nullptr;
+  }
+  return vtkActor::SafeDownCast(actors->GetItemAsObject(0));
+}
+}
+
+int TestF3DUSDImporterPayloads(int vtkNotUsed(argc), char* argv[])
+{
+  // A single prim whose quad is stored in a payload
+  const std::string path = std::string(argv[1]) + "data/TestF3DUSDImporterPayloads.usda";
+
+  // Payload loaded, the quad is imported
+  vtkNew<vtkF3DUSDImporter> importer;
+  vtkActor* actor = ::ImportSingleActor(importer, path);
+  vtkPolyData* quad = actor ? vtkPolyData::SafeDownCast(actor->GetMapper()->GetInput()) : nullptr;
+  if (!quad || quad->GetNumberOfPoints() != 4 || quad->GetNumberOfPolys() != 1)
+  {
+    std::cerr << "Payload geometry is not imported\n";
+    return EXIT_FAILURE;
+  }
+
+  // Payload deferred, the extents hint is imported as a wireframe box
+  vtkNew<vtkF3DUSDImporter> deferredImporter;
+  deferredImporter->SetLoadPayloads(false);
+  vtkActor* proxy = ::ImportSingleActor(deferredImporter, path);
+  if (!proxy || proxy->GetProperty()->GetRepresentation() != VTK_WIREFRAME)
+  {
+    std::cerr << "Unloaded payload is not shown as a proxy\n";
+    return EXIT_FAILURE;
+  }
+
+  double bounds[6];
+  proxy->GetMapper()->GetInput()->GetBounds(bounds);
+  const double expected[6] = { 0, 2, 0, 1, 0, 0 };
+  for (int i = 0; i < 6; i++)
+  {
+    if (std::abs(bounds[i] - expected[i]) > 1e-6)
+    {
+      std::cerr << "Unexpected proxy bounds\n";
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -1,5 +1,6 @@
 #include "vtkF3DUSDImporter.h"
 
+#include "F3DTextureCache.h"
 #include "vtkF3DFaceVaryingPointDispatcher.h"
 
 #include <vtkActor.h>
@@ -10,13 +11,12 @@
 #include <vtkCylinderSource.h>
 #include <vtkDataAssembly.h>
 #include <vtkDoubleArray.h>
+#include <vtkFieldData.h>
 #include <vtkFloatArray.h>
 #include <vtkIdTypeArray.h>
 #include <vtkImageAppendComponents.h>
 #include <vtkImageData.h>
 #include <vtkImageExtractComponents.h>
-#include <vtkImageReader2.h>
-#include <vtkImageReader2Factory.h>
 #include <vtkImageResize.h>
 #include <vtkInformation.h>
 #include <vtkInformationStringKey.h>
@@ -30,6 +30,7 @@
 #include <vtkPolyDataTangents.h>
 #include <vtkProperty.h>
 #include <vtkRenderer.h>
+#include <vtkSMPTools.h>
 #include <vtkShaderProperty.h>
 #include <vtkSmartPointer.h>
 #include <vtkSphereSource.h>
@@ -43,10 +44,8 @@
 
 #include <algorithm>
 #include <cassert>
-
-#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 5, 20251016)
-#include <vtkMemoryResourceStream.h>
-#endif
+#include <future>
+#include <mutex>
 
 #include "F3DUSDMemoryResolver.h"
 
@@ -78,6 +77,7 @@
 #include <pxr/usd/usdGeom/cylinder.h>
 #include <pxr/usd/usdGeom/mesh.h>
 #include <pxr/usd/usdGeom/metrics.h>
+#include <pxr/usd/usdGeom/modelAPI.h>
 #include <pxr/usd/usdGeom/pointInstancer.h>
 #include <pxr/usd/usdGeom/points.h>
 #include <pxr/usd/usdGeom/primvarsAPI.h>
@@ -139,24 +139,26 @@ public:
   vtkInternals(const vtkInternals&) = delete;
   vtkInternals& operator=(const vtkInternals&) = delete;
 
-  void ReadScene(const std::string& filePath)
+  void ReadScene(const std::string& filePath, bool loadPayloads)
   {
     // in case of failure, you may want to set PXR_PLUGINPATH_NAME to the lib/usd path
     if (!this->Stage)
     {
-      this->Stage = pxr::UsdStage::Open(filePath);
+      this->Stage = pxr::UsdStage::Open(
+        filePath, loadPayloads ? pxr::UsdStage::LoadAll : pxr::UsdStage::LoadNone);
       this->InitStage();
     }
   }
 
 #if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 5, 20251016)
-  void ReadScene(vtkResourceStream* stream, const std::string& hint)
+  void ReadScene(vtkResourceStream* stream, const std::string& hint, bool loadPayloads)
   {
     if (!this->Stage)
     {
       this->MemoryResolverContext.Stream = stream;
       pxr::ArResolverContext ctx(this->MemoryResolverContext);
-      this->Stage = pxr::UsdStage::Open("f3dmem:stream." + hint, ctx);
+      this->Stage = pxr::UsdStage::Open("f3dmem:stream." + hint, ctx,
+        loadPayloads ? pxr::UsdStage::LoadAll : pxr::UsdStage::LoadNone);
       this->InitStage();
     }
   }
@@ -379,36 +381,404 @@ public:
     actor->SetUserMatrix(mat);
   }
 
-  void ImportNode(vtkRenderer* renderer, vtkDataAssembly* hierarchy,
-    vtkActorCollection* actorCollection, const pxr::UsdPrim& node, const pxr::SdfPath& path,
-    vtkMatrix4x4* currentMatrix)
+  /**
+   * Return true if the prim, and therefore its children, should not be imported
+   * because it is invisible or only used as a proxy or a guide
+   */
+  bool IsSkipped(const pxr::UsdPrim& prim, pxr::UsdTimeCode timeCode)
   {
-    pxr::UsdTimeCode timeCode = this->CurrentTime * this->Stage->GetTimeCodesPerSecond();
+    if (!prim.IsA<pxr::UsdGeomImageable>())
+    {
+      return false;
+    }
 
-    // simple range-for iteration
-    for (pxr::UsdPrim prim : pxr::UsdPrimSiblingRange(node.GetAllChildren()))
+    pxr::UsdGeomImageable imageable = pxr::UsdGeomImageable(prim);
+
+    pxr::TfToken visibility;
+    pxr::UsdAttribute visAttr = imageable.GetVisibilityAttr();
+    if (visAttr && visAttr.HasAuthoredValue() && visAttr.Get(&visibility, timeCode) &&
+      visibility == pxr::UsdGeomTokens->invisible)
+    {
+      // not visible, skip
+      return true;
+    }
+
+    pxr::TfToken purpose;
+    pxr::UsdAttribute purpAttr = imageable.GetPurposeAttr();
+    if (purpAttr && purpAttr.HasAuthoredValue() && purpAttr.Get(&purpose, timeCode) &&
+      (purpose == pxr::UsdGeomTokens->proxy || purpose == pxr::UsdGeomTokens->guide))
     {
-      if (prim.IsA<pxr::UsdGeomImageable>())
+      // proxy, skip
+      return true;
+    }
+
+    return false;
+  }
+
+  /**
+   * Return true if the mesh topology, points or primvars may change over time
+   */
+  bool IsMeshTimeVarying(const pxr::UsdGeomMesh& meshPrim)
+  {
+    auto TimeVarying = [](const auto& a) { return a.ValueMightBeTimeVarying(); };
+
+    std::vector<pxr::UsdGeomPrimvar> primVars = pxr::UsdGeomPrimvarsAPI(meshPrim).GetPrimvars();
+
+    return std::ranges::any_of(primVars, TimeVarying) ||
+      TimeVarying(meshPrim.GetPointsAttr()) || TimeVarying(meshPrim.GetNormalsAttr()) ||
+      TimeVarying(meshPrim.GetFaceVertexCountsAttr()) ||
+      TimeVarying(meshPrim.GetFaceVertexIndicesAttr());
+  }
+
+  /**
+   * Convert a mesh to a polydata at the given time.
+   * Skinning and blend shapes are only read on the first build.
+   * Only reads the stage and the skeleton cache, so different meshes can be converted
+   * concurrently.
+   */
+  vtkSmartPointer<vtkPolyData> ConvertMesh(
+    const pxr::UsdGeomMesh& meshPrim, pxr::UsdTimeCode timeCode, bool firstBuild)
+  {
+    pxr::UsdPrim prim = meshPrim.GetPrim();
+
+    // attributes
+    pxr::UsdAttribute normalsAttr = meshPrim.GetNormalsAttr();
+    pxr::UsdAttribute pointsAttr = meshPrim.GetPointsAttr();
+    pxr::UsdAttribute facesCountAttr = meshPrim.GetFaceVertexCountsAttr();
+    pxr::UsdAttribute facesIndicesAttr = meshPrim.GetFaceVertexIndicesAttr();
+
+    std::vector<pxr::UsdGeomPrimvar> primVars = pxr::UsdGeomPrimvarsAPI(meshPrim).GetPrimvars();
+
+    vtkNew<vtkPolyData> newPolyData;
+
+    // normals
+    pxr::VtArray<pxr::GfVec3f> normals;
+    normalsAttr.Get(&normals, timeCode);
+
+    if (normals.size() > 0)
+    {
+      vtkNew<vtkFloatArray> vNormals;
+      vNormals->SetName("Normals");
+      vNormals->SetNumberOfComponents(3);
+#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 6, 20260320)
+      vNormals->ReserveValues(normals.size());
+#else
+      vNormals->Allocate(normals.size());
+#endif
+
+      for (const pxr::GfVec3f& n : normals)
       {
-        pxr::UsdGeomImageable imageable = pxr::UsdGeomImageable(prim);
+        vNormals->InsertNextTuple3(n[0], n[1], n[2]);
+      }
 
-        pxr::TfToken visibility;
-        pxr::UsdAttribute visAttr = imageable.GetVisibilityAttr();
-        if (visAttr && visAttr.HasAuthoredValue() && visAttr.Get(&visibility, timeCode) &&
-          visibility == pxr::UsdGeomTokens->invisible)
+      vtkInformation* info = vNormals->GetInformation();
+      info->Set(vtkF3DFaceVaryingPointDispatcher::INTERPOLATION_TYPE(),
+        meshPrim.GetNormalsInterpolation() == pxr::UsdGeomTokens->faceVarying ? 1 : 0);
+
+      newPolyData->GetPointData()->SetNormals(vNormals);
+    }
+
+    // texture coordinates
+    bool firstArray = true;
+    for (const pxr::UsdGeomPrimvar& primVar : primVars)
+    {
+      if (primVar.GetTypeName() == "texCoord2f[]" || primVar.GetTypeName() == "float2[]")
+      {
+        pxr::VtArray<pxr::GfVec2f> uvs;
+        primVar.Get(&uvs, timeCode);
+
+        if (uvs.size() > 0)
         {
-          // not visible, skip
-          continue;
+          std::string name = primVar.GetPrimvarName();
+
+          vtkNew<vtkFloatArray> texCoords;
+          texCoords->SetName(name.c_str());
+          texCoords->SetNumberOfComponents(2);
+
+          if (primVar.IsIndexed())
+          {
+            pxr::UsdAttribute indicesAttr = primVar.GetIndicesAttr();
+
+            pxr::VtArray<int> indices;
+            if (indicesAttr.Get(&indices) && indices.size() > 0)
+            {
+#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 6, 20260320)
+              texCoords->ReserveValues(indices.size());
+#else
+              texCoords->Allocate(indices.size());
+#endif
+
+              for (int index : indices)
+              {
+                const pxr::GfVec2f& uv = uvs[index];
+                texCoords->InsertNextTuple2(uv[0], uv[1]);
+              }
+            }
+          }
+          else
+          {
+#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 6, 20260320)
+            texCoords->ReserveValues(uvs.size());
+#else
+            texCoords->Allocate(uvs.size());
+#endif
+
+            for (const pxr::GfVec2f& uv : uvs)
+            {
+              texCoords->InsertNextTuple2(uv[0], uv[1]);
+            }
+          }
+
+          vtkInformation* info = texCoords->GetInformation();
+          info->Set(vtkF3DFaceVaryingPointDispatcher::INTERPOLATION_TYPE(),
+            primVar.GetInterpolation() == pxr::UsdGeomTokens->faceVarying ? 1 : 0);
+
+          // the size of the array can be larger than the number of points if the attribute
+          // interpolation is face-varying.
+          // It will be normalized by the vtkF3DFaceVaryingPointDispatcher later
+          newPolyData->GetPointData()->AddArray(texCoords);
+
+          if (firstArray)
+          {
+            // sometimes we are enable to fetch the array name to use for texture mapping
+            // so we fallback to the first UV set added
+            // see https://github.com/f3d-app/f3d/issues/1184
+            firstArray = false;
+            newPolyData->GetPointData()->SetTCoords(texCoords);
+          }
         }
+      }
+    }
+
+    // points
+    pxr::VtArray<pxr::GfVec3f> positions;
+    pointsAttr.Get(&positions, timeCode);
 
-        pxr::TfToken purpose;
-        pxr::UsdAttribute purpAttr = imageable.GetPurposeAttr();
-        if (purpAttr && purpAttr.HasAuthoredValue() && purpAttr.Get(&purpose, timeCode) &&
-          (purpose == pxr::UsdGeomTokens->proxy || purpose == pxr::UsdGeomTokens->guide))
+    vtkNew<vtkPoints> points;
+#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 6, 20260320)
+    points->Reserve(positions.size());
+#else
+    points->Allocate(positions.size());
+#endif
+    for (const pxr::GfVec3f& p : positions)
+    {
+      points->InsertNextPoint(p[0], p[1], p[2]);
+    }
+
+    newPolyData->SetPoints(points);
+
+    // faces
+    pxr::VtArray<int> counts;
+    facesCountAttr.Get(&counts, timeCode);
+
+    pxr::VtArray<int> indices;
+    facesIndicesAttr.Get(&indices, timeCode);
+
+    // add polygons
+    vtkNew<vtkCellArray> cells;
+    auto currentCellIt = indices.cbegin();
+    std::vector<vtkIdType> indexArr;
+    for (int c : counts)
+    {
+      indexArr.clear();
+      indexArr.insert(indexArr.begin(), currentCellIt, std::next(currentCellIt, c));
+      cells->InsertNextCell(c, indexArr.data());
+      std::advance(currentCellIt, c);
+    }
+
+    newPolyData->SetPolys(cells);
+
+    if (pxr::UsdSkelSkinningQuery skinningQuery = this->SkelCache.GetSkinningQuery(prim))
+    {
+      // save skinning buffers to the polydata
+      if (skinningQuery.HasJointInfluences() && firstBuild)
+      {
+        pxr::VtIntArray jointIndices;
+        pxr::VtFloatArray jointWeights;
+        int numInfluences = skinningQuery.GetNumInfluencesPerComponent();
+
+        if (skinningQuery.ComputeVaryingJointInfluences(
+              positions.size(), &jointIndices, &jointWeights))
+        {
+          vtkNew<vtkUnsignedShortArray> jointsArr;
+          jointsArr->SetName("JOINTS_0");
+          jointsArr->SetNumberOfComponents(4);
+          jointsArr->SetNumberOfTuples(static_cast<vtkIdType>(positions.size()));
+          jointsArr->Fill(0);
+
+          vtkNew<vtkFloatArray> weightsArr;
+          weightsArr->SetName("WEIGHTS_0");
+          weightsArr->SetNumberOfComponents(4);
+          weightsArr->SetNumberOfTuples(static_cast<vtkIdType>(positions.size()));
+          weightsArr->Fill(0);
+
+          // F3D mapper is limited to 4 influences
+          int components = std::min(numInfluences, 4);
+
+          std::vector<std::pair<float, int>> influences;
+          influences.reserve(numInfluences);
+
+          for (std::size_t i = 0; i < positions.size(); i++)
+          {
+            // point influences
+            influences.resize(numInfluences);
+
+            for (int j = 0; j < numInfluences; j++)
+            {
+              int idx = static_cast<int>(i) * numInfluences + j;
+              influences[j] = std::make_pair(jointWeights[idx], jointIndices[idx]);
+            }
+
+            // Sort descending by weight to get the top 4
+            std::ranges::partial_sort(influences, influences.begin() + components,
+              [](const auto& a, const auto& b) { return a.first > b.first; });
+
+            float totalWeight = 0.0f;
+            for (int j = 0; j < components; j++)
+            {
+              jointsArr->SetTypedComponent(static_cast<vtkIdType>(i), j,
+                static_cast<unsigned short>(influences[j].second));
+              weightsArr->SetTypedComponent(static_cast<vtkIdType>(i), j, influences[j].first);
+              totalWeight += influences[j].first;
+            }
+
+            // Re-normalize after potential truncation
+            if (totalWeight > 0.0f)
+            {
+              for (int j = 0; j < components; j++)
+              {
+                float w = weightsArr->GetTypedComponent(static_cast<vtkIdType>(i), j);
+                weightsArr->SetTypedComponent(static_cast<vtkIdType>(i), j, w / totalWeight);
+              }
+            }
+          }
+          newPolyData->GetPointData()->AddArray(jointsArr);
+          newPolyData->GetPointData()->AddArray(weightsArr);
+        }
+      }
+
+      // save morphing info (aka blend shapes)
+      if (skinningQuery.HasBlendShapes() && firstBuild)
+      {
+        // nodes are stable, the reference stays valid when other meshes are inserted
+        std::unique_lock<std::mutex> lock(this->MorphingMutex);
+        MorphingInfo& info = this->MorphingMap[meshPrim.GetPath().GetAsString()];
+        lock.unlock();
+
+        // Cache blend shape data, offsets are uploaded once and applied on the GPU
+        info.NumberOfPoints = positions.size();
+        pxr::UsdSkelBindingAPI binding(prim);
+        pxr::UsdSkelBlendShapeQuery blendShapeQuery(binding);
+        if (blendShapeQuery)
+        {
+          info.BlendShapePointIndices = blendShapeQuery.ComputeBlendShapePointIndices();
+          info.SubShapePointOffsets = blendShapeQuery.ComputeSubShapePointOffsets();
+          for (size_t i = 0; i < blendShapeQuery.GetNumSubShapes(); i++)
+          {
+            info.SubShapeBlendShapes.push_back(blendShapeQuery.GetBlendShapeIndex(i));
+          }
+        }
+      }
+    }
+
+    vtkNew<vtkF3DFaceVaryingPointDispatcher> faceVaryingFilter;
+    faceVaryingFilter->SetInputData(newPolyData);
+    faceVaryingFilter->Update();
+
+    vtkSmartPointer<vtkPolyData> polydata = faceVaryingFilter->GetOutput();
+
+    MorphingInfo* morphing = nullptr;
+    {
+      std::scoped_lock lock(this->MorphingMutex);
+      auto morphIter = this->MorphingMap.find(meshPrim.GetPath().GetAsString());
+      morphing = morphIter != this->MorphingMap.end() ? &morphIter->second : nullptr;
+    }
+
+    if (morphing)
+    {
+      this->AddBlendShapeOffsets(*morphing, polydata);
+    }
+
+    return polydata;
+  }
+
+  /**
+   * Convert all the meshes that are new or time varying in parallel.
+   * The stage is traversed with the same pruning as ImportNode, including instance prototypes,
+   * and the results are stored in MeshMap, so ImportNode only has to assemble the actors and
+   * the hierarchy, always in the same order.
+   */
+  void ConvertMeshes(pxr::UsdTimeCode timeCode)
+  {
+    struct MeshTask
+    {
+      pxr::UsdGeomMesh Mesh;
+      std::string Path;
+      bool FirstBuild;
+      vtkSmartPointer<vtkPolyData> Output;
+    };
+    std::vector<MeshTask> tasks;
+
+    auto collect = [&](const pxr::UsdPrim& root)
+    {
+      pxr::UsdPrimRange range(root, pxr::UsdPrimAllPrimsPredicate);
+      for (auto it = range.begin(); it != range.end(); ++it)
+      {
+        if (this->IsSkipped(*it, timeCode))
         {
-          // proxy, skip
+          it.PruneChildren();
           continue;
         }
+
+        if (it->IsA<pxr::UsdGeomMesh>())
+        {
+          pxr::UsdGeomMesh meshPrim(*it);
+          std::string path = it->GetPath().GetAsString();
+
+          auto meshIt = this->MeshMap.find(path);
+          bool firstBuild = meshIt == this->MeshMap.end() || !meshIt->second;
+          if (firstBuild || this->IsMeshTimeVarying(meshPrim))
+          {
+            tasks.push_back({ meshPrim, path, firstBuild, nullptr });
+          }
+        }
+      }
+    };
+
+    collect(this->Stage->GetPseudoRoot());
+    for (const pxr::UsdPrim& prototype : this->Stage->GetPrototypes())
+    {
+      collect(prototype);
+    }
+
+    vtkSMPTools::For(0, static_cast<vtkIdType>(tasks.size()), 1,
+      [&](vtkIdType begin, vtkIdType end)
+      {
+        for (vtkIdType i = begin; i < end; i++)
+        {
+          MeshTask& task = tasks[i];
+          task.Output = this->ConvertMesh(task.Mesh, timeCode, task.FirstBuild);
+        }
+      });
+
+    for (MeshTask& task : tasks)
+    {
+      this->MeshMap[task.Path] = task.Output;
+    }
+  }
+
+  void ImportNode(vtkRenderer* renderer, vtkDataAssembly* hierarchy,
+    vtkActorCollection* actorCollection, const pxr::UsdPrim& node, const pxr::SdfPath& path,
+    vtkMatrix4x4* currentMatrix)
+  {
+    pxr::UsdTimeCode timeCode = this->CurrentTime * this->Stage->GetTimeCodesPerSecond();
+
+    // simple range-for iteration
+    for (pxr::UsdPrim prim : pxr::UsdPrimSiblingRange(node.GetAllChildren()))
+    {
+      if (this->IsSkipped(prim, timeCode))
+      {
+        continue;
       }
 
       if (prim.IsInstance())
@@ -457,260 +827,11 @@ public:
 
           vtkSmartPointer<vtkPolyData>& mappedPolydata =
             this->MeshMap[meshPrim.GetPath().GetAsString()];
-          bool meshAlreadyExists = (mappedPolydata != nullptr);
 
-          // attributes
-          pxr::UsdAttribute normalsAttr = meshPrim.GetNormalsAttr();
-          pxr::UsdAttribute pointsAttr = meshPrim.GetPointsAttr();
-          pxr::UsdAttribute facesCountAttr = meshPrim.GetFaceVertexCountsAttr();
-          pxr::UsdAttribute facesIndicesAttr = meshPrim.GetFaceVertexIndicesAttr();
-
-          std::vector<pxr::UsdGeomPrimvar> primVars =
-            pxr::UsdGeomPrimvarsAPI(meshPrim).GetPrimvars();
-
-          auto TimeVarying = [](const auto& a) { return a.ValueMightBeTimeVarying(); };
-
-          bool animatedAttribute = std::ranges::any_of(primVars, TimeVarying);
-          animatedAttribute = animatedAttribute || TimeVarying(pointsAttr);
-          animatedAttribute = animatedAttribute || TimeVarying(normalsAttr);
-          animatedAttribute = animatedAttribute || TimeVarying(facesCountAttr);
-          animatedAttribute = animatedAttribute || TimeVarying(facesIndicesAttr);
-
-          // Check if the mesh has to be rebuilt
-          if (!meshAlreadyExists || animatedAttribute)
+          // meshes are usually converted beforehand by ConvertMeshes
+          if (!mappedPolydata)
           {
-            vtkNew<vtkPolyData> newPolyData;
-
-            // normals
-            pxr::VtArray<pxr::GfVec3f> normals;
-            normalsAttr.Get(&normals, timeCode);
-
-            if (normals.size() > 0)
-            {
-              vtkNew<vtkFloatArray> vNormals;
-              vNormals->SetName("Normals");
-              vNormals->SetNumberOfComponents(3);
-#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 6, 20260320)
-              vNormals->ReserveValues(normals.size());
-#else
-              vNormals->Allocate(normals.size());
-#endif
-
-              for (const pxr::GfVec3f& n : normals)
-              {
-                vNormals->InsertNextTuple3(n[0], n[1], n[2]);
-              }
-
-              vtkInformation* info = vNormals->GetInformation();
-              info->Set(vtkF3DFaceVaryingPointDispatcher::INTERPOLATION_TYPE(),
-                meshPrim.GetNormalsInterpolation() == pxr::UsdGeomTokens->faceVarying ? 1 : 0);
-
-              newPolyData->GetPointData()->SetNormals(vNormals);
-            }
-
-            // texture coordinates
-            bool firstArray = true;
-            for (const pxr::UsdGeomPrimvar& primVar : primVars)
-            {
-              if (primVar.GetTypeName() == "texCoord2f[]" || primVar.GetTypeName() == "float2[]")
-              {
-                pxr::VtArray<pxr::GfVec2f> uvs;
-                primVar.Get(&uvs, timeCode);
-
-                if (uvs.size() > 0)
-                {
-                  std::string name = primVar.GetPrimvarName();
-
-                  vtkNew<vtkFloatArray> texCoords;
-                  texCoords->SetName(name.c_str());
-                  texCoords->SetNumberOfComponents(2);
-
-                  if (primVar.IsIndexed())
-                  {
-                    pxr::UsdAttribute indicesAttr = primVar.GetIndicesAttr();
-
-                    pxr::VtArray<int> indices;
-                    if (indicesAttr.Get(&indices) && indices.size() > 0)
-                    {
-#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 6, 20260320)
-                      texCoords->ReserveValues(indices.size());
-#else
-                      texCoords->Allocate(indices.size());
-#endif
-
-                      for (int index : indices)
-                      {
-                        const pxr::GfVec2f& uv = uvs[index];
-                        texCoords->InsertNextTuple2(uv[0], uv[1]);
-                      }
-                    }
-                  }
-                  else
-                  {
-#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 6, 20260320)
-                    texCoords->ReserveValues(uvs.size());
-#else
-                    texCoords->Allocate(uvs.size());
-#endif
-
-                    for (const pxr::GfVec2f& uv : uvs)
-                    {
-                      texCoords->InsertNextTuple2(uv[0], uv[1]);
-                    }
-                  }
-
-                  vtkInformation* info = texCoords->GetInformation();
-                  info->Set(vtkF3DFaceVaryingPointDispatcher::INTERPOLATION_TYPE(),
-                    primVar.GetInterpolation() == pxr::UsdGeomTokens->faceVarying ? 1 : 0);
-
-                  // the size of the array can be larger than the number of points if the attribute
-                  // interpolation is face-varying.
-                  // It will be normalized by the vtkF3DFaceVaryingPointDispatcher later
-                  newPolyData->GetPointData()->AddArray(texCoords);
-
-                  if (firstArray)
-                  {
-                    // sometimes we are enable to fetch the array name to use for texture mapping
-                    // so we fallback to the first UV set added
-                    // see https://github.com/f3d-app/f3d/issues/1184
-                    firstArray = false;
-                    newPolyData->GetPointData()->SetTCoords(texCoords);
-                  }
-                }
-              }
-            }
-
-            // points
-            pxr::VtArray<pxr::GfVec3f> positions;
-            pointsAttr.Get(&positions, timeCode);
-
-            vtkNew<vtkPoints> points;
-#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 6, 20260320)
-            points->Reserve(positions.size());
-#else
-            points->Allocate(positions.size());
-#endif
-            for (const pxr::GfVec3f& p : positions)
-            {
-              points->InsertNextPoint(p[0], p[1], p[2]);
-            }
-
-            newPolyData->SetPoints(points);
-
-            // faces
-            pxr::VtArray<int> counts;
-            facesCountAttr.Get(&counts, timeCode);
-
-            pxr::VtArray<int> indices;
-            facesIndicesAttr.Get(&indices, timeCode);
-
-            // add polygons
-            vtkNew<vtkCellArray> cells;
-            auto currentCellIt = indices.cbegin();
-            std::vector<vtkIdType> indexArr;
-            for (int c : counts)
-            {
-              indexArr.clear();
-              indexArr.insert(indexArr.begin(), currentCellIt, std::next(currentCellIt, c));
-              cells->InsertNextCell(c, indexArr.data());
-              std::advance(currentCellIt, c);
-            }
-
-            newPolyData->SetPolys(cells);
-
-            if (pxr::UsdSkelSkinningQuery skinningQuery = this->SkelCache.GetSkinningQuery(prim))
-            {
-              // save skinning buffers to the polydata
-              if (skinningQuery.HasJointInfluences() && !meshAlreadyExists)
-              {
-                pxr::VtIntArray jointIndices;
-                pxr::VtFloatArray jointWeights;
-                int numInfluences = skinningQuery.GetNumInfluencesPerComponent();
-
-                if (skinningQuery.ComputeVaryingJointInfluences(
-                      positions.size(), &jointIndices, &jointWeights))
-                {
-                  vtkNew<vtkUnsignedShortArray> jointsArr;
-                  jointsArr->SetName("JOINTS_0");
-                  jointsArr->SetNumberOfComponents(4);
-                  jointsArr->SetNumberOfTuples(static_cast<vtkIdType>(positions.size()));
-                  jointsArr->Fill(0);
-
-                  vtkNew<vtkFloatArray> weightsArr;
-                  weightsArr->SetName("WEIGHTS_0");
-                  weightsArr->SetNumberOfComponents(4);
-                  weightsArr->SetNumberOfTuples(static_cast<vtkIdType>(positions.size()));
-                  weightsArr->Fill(0);
-
-                  // F3D mapper is limited to 4 influences
-                  int components = std::min(numInfluences, 4);
-
-                  std::vector<std::pair<float, int>> influences;
-                  influences.reserve(numInfluences);
-
-                  for (std::size_t i = 0; i < positions.size(); i++)
-                  {
-                    // point influences
-                    influences.resize(numInfluences);
-
-                    for (int j = 0; j < numInfluences; j++)
-                    {
-                      int idx = static_cast<int>(i) * numInfluences + j;
-                      influences[j] = std::make_pair(jointWeights[idx], jointIndices[idx]);
-                    }
-
-                    // Sort descending by weight to get the top 4
-                    std::ranges::partial_sort(influences, influences.begin() + components,
-                      [](const auto& a, const auto& b) { return a.first > b.first; });
-
-                    float totalWeight = 0.0f;
-                    for (int j = 0; j < components; j++)
-                    {
-                      jointsArr->SetTypedComponent(static_cast<vtkIdType>(i), j,
-                        static_cast<unsigned short>(influences[j].second));
-                      weightsArr->SetTypedComponent(
-                        static_cast<vtkIdType>(i), j, influences[j].first);
-                      totalWeight += influences[j].first;
-                    }
-
-                    // Re-normalize after potential truncation
-                    if (totalWeight > 0.0f)
-                    {
-                      for (int j = 0; j < components; j++)
-                      {
-                        float w = weightsArr->GetTypedComponent(static_cast<vtkIdType>(i), j);
-                        weightsArr->SetTypedComponent(
-                          static_cast<vtkIdType>(i), j, w / totalWeight);
-                      }
-                    }
-                  }
-                  newPolyData->GetPointData()->AddArray(jointsArr);
-                  newPolyData->GetPointData()->AddArray(weightsArr);
-                }
-              }
-
-              // save morphing info (aka blend shapes)
-              if (skinningQuery.HasBlendShapes() && !meshAlreadyExists)
-              {
-                MorphingInfo& info = this->MorphingMap[meshPrim.GetPath().GetAsString()];
-
-                // Cache blend shape data for per-frame CPU deformation
-                info.BindPositions = positions;
-                pxr::UsdSkelBindingAPI binding(prim);
-                pxr::UsdSkelBlendShapeQuery blendShapeQuery(binding);
-                if (blendShapeQuery)
-                {
-                  info.BlendShapePointIndices = blendShapeQuery.ComputeBlendShapePointIndices();
-                  info.SubShapePointOffsets = blendShapeQuery.ComputeSubShapePointOffsets();
-                }
-              }
-            }
-
-            vtkNew<vtkF3DFaceVaryingPointDispatcher> faceVaryingFilter;
-            faceVaryingFilter->SetInputData(newPolyData);
-            faceVaryingFilter->Update();
-
-            mappedPolydata = faceVaryingFilter->GetOutput();
+            mappedPolydata = this->ConvertMesh(meshPrim, timeCode, true);
           }
 
           polydata = mappedPolydata;
@@ -1003,6 +1124,32 @@ public:
           }
         }
       }
+      else if (!prim.IsLoaded() && prim.HasAuthoredPayloads())
+      {
+        // payload loading is deferred, show the extents hint as a proxy box if authored
+        pxr::VtVec3fArray extents;
+        if (pxr::UsdGeomModelAPI(prim).GetExtentsHint(&extents, timeCode) && extents.size() >= 2)
+        {
+          vtkNew<vtkCubeSource> box;
+          box->SetBounds(extents[0][0], extents[1][0], extents[0][1], extents[1][1],
+            extents[0][2], extents[1][2]);
+          box->Update();
+
+          auto mat = this->GetLocalTransform(pxr::UsdGeomImageable(prim), timeCode);
+          vtkMatrix4x4::Multiply4x4(currentMatrix, mat, mat);
+
+          this->AddActor(renderer, hierarchy, actorCollection, path, pxr::UsdGeomGprim(prim),
+            prim, mat, box->GetOutput());
+
+          std::string actorPath = path.AppendChild(prim.GetName()).GetAsString();
+          this->ActorMap[actorPath]->GetProperty()->SetRepresentationToWireframe();
+        }
+        else
+        {
+          this->GetOrCreateHierarchyNode(
+            hierarchy, path.AppendChild(prim.GetName()), prim.GetName().GetString());
+        }
+      }
       else
       {
         // Create hierarchy node for this intermediate node (Xform, Scope, etc.)
@@ -1181,7 +1328,7 @@ public:
                 "jointMatrices", static_cast<int>(skinningXforms.size()), jointMatrices.data());
             }
 
-            // Morphing: compute blend shape deformations and update points
+            // Morphing: update shader blend shape weights, offsets are applied on the GPU
             pxr::VtFloatArray allWeights;
             const pxr::UsdSkelAnimQuery& animQuery = skelQuery.GetAnimQuery();
             if (!animQuery || !animQuery.ComputeBlendShapeWeights(&allWeights, timeCode))
@@ -1207,45 +1354,24 @@ public:
             blendShapeQuery.ComputeSubShapeWeights(
               allWeights, &subShapeWeights, &blendShapeIndices, &subShapeIndices);
 
-            const auto& morphInfo = this->MorphingMap[primPath];
-
-            // Execute CPU-side morphing
-            pxr::VtArray<pxr::GfVec3f> positions = morphInfo.BindPositions;
-            blendShapeQuery.ComputeDeformedPoints(subShapeWeights, blendShapeIndices,
-              subShapeIndices, morphInfo.BlendShapePointIndices, morphInfo.SubShapePointOffsets,
-              positions);
-
-            // Find the VTK polydata for this mesh and update its points in-place
-            vtkPolyData* polydata = this->MeshMap[primPath];
-            vtkPoints* outputPoints = polydata->GetPoints();
-
-            vtkIdTypeArray* sourceIds =
-              vtkIdTypeArray::SafeDownCast(polydata->GetPointData()->GetArray("SourceIds"));
-
-            if (sourceIds)
+            // One weight per sub-shape, packed in vec4 to reduce the number of uniforms
+            size_t nbSubShapes = this->MorphingMap[primPath].SubShapeBlendShapes.size();
+            if (nbSubShapes == 0)
             {
-              for (vtkIdType i = 0; i < outputPoints->GetNumberOfPoints(); i++)
-              {
-                // Remap if face-varying
-                vtkIdType srcIdx = sourceIds->GetValue(i);
-                if (srcIdx < static_cast<vtkIdType>(positions.size()))
-                {
-                  const pxr::GfVec3f& p = positions[srcIdx];
-                  outputPoints->SetPoint(i, p[0], p[1], p[2]);
-                }
-              }
+              continue;
             }
-            else
+
+            std::vector<float> weights(4 * ((nbSubShapes + 3) / 4), 0.f);
+            for (size_t i = 0; i < subShapeWeights.size(); i++)
             {
-              for (vtkIdType i = 0; i < outputPoints->GetNumberOfPoints(); i++)
+              if (subShapeIndices[i] < nbSubShapes)
               {
-                if (i < static_cast<vtkIdType>(positions.size()))
-                {
-                  const pxr::GfVec3f& p = positions[i];
-                  outputPoints->SetPoint(i, p[0], p[1], p[2]);
-                }
+                weights[subShapeIndices[i]] += subShapeWeights[i];
               }
             }
+
+            uniforms->SetUniform4fv(
+              "blendShapeWeights", static_cast<int>(weights.size() / 4), weights.data());
           }
         }
       }
@@ -1281,9 +1407,16 @@ public:
 
     this->RootTransform->DeepCopy(rootTransform);
 
+    // decode textures in the background while importing the geometry
+    this->SubmitTextures();
+
+    this->ConvertMeshes(this->CurrentTime * this->Stage->GetTimeCodesPerSecond());
+
     this->ImportNode(renderer, hierarchy, actorCollection, this->Stage->GetPseudoRoot(),
       pxr::SdfPath("/"), rootTransform);
 
+    this->PendingTextures.clear();
+
     this->UpdateSkinningAndMorphing();
 
     if (armature)
@@ -1378,6 +1511,67 @@ public:
     return appendChannels->GetOutput();
   }
 
+  // submit the decoding of all the UsdUVTexture images of the stage in the background
+  void SubmitTextures()
+  {
+    for (const pxr::UsdPrim& prim : this->Stage->Traverse())
+    {
+      if (!prim.IsA<pxr::UsdShadeShader>())
+      {
+        continue;
+      }
+
+      pxr::UsdShadeShader shader(prim);
+      pxr::TfToken idToken;
+      if (shader.GetIdAttr().Get(&idToken) && idToken == pxr::TfToken("UsdUVTexture"))
+      {
+        this->PendingTextures.emplace(prim.GetPath().GetAsString(), this->SubmitTexture(shader));
+      }
+    }
+  }
+
+  // read the file of a texture sampler and submit its decoding in the background
+  F3DTextureCache::Image SubmitTexture(const pxr::UsdShadeShader& samplerPrim)
+  {
+    pxr::SdfAssetPath path;
+    pxr::UsdShadeInput fileInput = samplerPrim.GetInput(pxr::TfToken("file"));
+    if (!fileInput || !fileInput.Get(&path))
+    {
+      return {};
+    }
+
+    const std::string& assetPath = path.GetAssetPath();
+    size_t extPos = assetPath.find_last_of('.');
+    if (extPos == std::string::npos)
+    {
+      vtkErrorWithObjectMacro(nullptr, "Cannot create reader for image: " << assetPath);
+      return {};
+    }
+
+    const std::string& resolvedPath = path.GetResolvedPath();
+    pxr::ArResolverContextBinder binder(this->MemoryResolverContext);
+    auto asset = pxr::ArGetResolver().OpenAsset(pxr::ArResolvedPath(resolvedPath));
+
+    if (!asset)
+    {
+      // cannot get USD asset
+      vtkErrorWithObjectMacro(nullptr, "Cannot recover USD asset");
+      return {};
+    }
+
+    auto buffer = asset->GetBuffer();
+
+    if (!buffer)
+    {
+      // buffer invalid
+      vtkErrorWithObjectMacro(nullptr, "Cannot recover buffer");
+      return {};
+    }
+
+    return F3DTextureCache::DecodeBuffer(
+      buffer.get(), asset->GetSize(), assetPath.substr(extPos));
+  }
+
   // returns the image and the texture coordinate name
   vtkSmartPointer<vtkImageData> GetVTKTexture(
     const pxr::UsdShadeShader& samplerPrim, const pxr::TfToken& token)
@@ -1420,62 +1614,24 @@ public:
       }
     }
 
-    auto& tex = this->TextureMap[samplerPrim.GetPath().GetAsString()];
+    const std::string samplerPath = samplerPrim.GetPath().GetAsString();
+    auto& tex = this->TextureMap[samplerPath];
 
     if (tex == nullptr)
     {
-      pxr::SdfAssetPath path;
-      pxr::UsdShadeInput fileInput = samplerPrim.GetInput(pxr::TfToken("file"));
-      if (fileInput && fileInput.Get(&path))
-      {
-        vtkSmartPointer<vtkImageReader2> reader;
-
-        const std::string& assetPath = path.GetAssetPath();
-        std::string ext = assetPath.substr(assetPath.find_last_of('.'));
-        reader.TakeReference(vtkImageReader2Factory::CreateImageReader2FromExtension(ext.c_str()));
-        if (!reader)
-        {
-          // cannot read the image file
-          vtkErrorWithObjectMacro(nullptr, "Cannot create reader for image: " << assetPath);
-          return nullptr;
-        }
-
-        const std::string& resolvedPath = path.GetResolvedPath();
-        pxr::ArResolverContextBinder binder(this->MemoryResolverContext);
-        auto asset = pxr::ArGetResolver().OpenAsset(pxr::ArResolvedPath(resolvedPath));
-
-        if (!asset)
-        {
-          // cannot get USD asset
-          vtkErrorWithObjectMacro(nullptr, "Cannot recover USD asset");
-          return nullptr;
-        }
-
-        auto buffer = asset->GetBuffer();
-
-        if (!buffer)
-        {
-          // buffer invalid
-          vtkErrorWithObjectMacro(nullptr, "Cannot recover buffer");
-          return nullptr;
-        }
+      auto it = this->PendingTextures.find(samplerPath);
+      F3DTextureCache::Image pending =
+        it != this->PendingTextures.end() ? it->second : this->SubmitTexture(samplerPrim);
 
-#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 5, 20251016)
-        vtkNew<vtkMemoryResourceStream> stream;
-        stream->SetBuffer(buffer.get(), asset->GetSize());
-        reader->SetStream(stream);
-#else
-        reader->SetMemoryBuffer(buffer.get());
-        reader->SetMemoryBufferLength(asset->GetSize());
-#endif
-        reader->Update();
-
-        tex = reader->GetOutput();
-      }
-      else
+      vtkSmartPointer<vtkImageData> image = pending.valid() ? pending.get() : nullptr;
+      if (!image)
       {
         return nullptr;
       }
+
+      // decoded images are shared, copy it before setting the texture coordinates name
+      tex = vtkSmartPointer<vtkImageData>::New();
+      tex->ShallowCopy(image);
     }
 
     tex->GetInformation()->Set(vtkF3DUSDImporter::TCOORDS_NAME(), name);
@@ -1739,11 +1895,123 @@ public:
 private:
   struct MorphingInfo
   {
-    pxr::VtArray<pxr::GfVec3f> BindPositions;
+    size_t NumberOfPoints = 0;
     std::vector<pxr::VtIntArray> BlendShapePointIndices;
     std::vector<pxr::VtVec3fArray> SubShapePointOffsets;
+    std::vector<unsigned int> SubShapeBlendShapes;
+
+    // Sparse offsets in USD point order, see GetBlendShapeOffsets
+    vtkSmartPointer<vtkFloatArray> Offsets;
+    std::vector<size_t> FirstOffsets;
   };
 
+  /**
+   * Get the sparse blend shape offsets of a mesh and add them to the field data of the given
+   * polydata, computing them if needed. Only the non-zero offsets are stored.
+   * The "BlendShapeOffsets" array contains a (sub-shape, x, y, z) tuple for each offset, grouped by
+   * USD point. The "BlendShapeRanges" array contains the (first offset, number of offsets) tuple
+   * of each point of the polydata. Both are uploaded once to the GPU by vtkF3DPolyDataMapper.
+   * Do nothing if there is no blend shape.
+   */
+  void AddBlendShapeOffsets(MorphingInfo& info, vtkPolyData* polydata)
+  {
+    const size_t nbSubShapes = info.SubShapeBlendShapes.size();
+    const vtkIdType nbPoints = polydata->GetNumberOfPoints();
+    if (nbSubShapes == 0 || nbPoints == 0)
+    {
+      return;
+    }
+
+    if (!info.Offsets)
+    {
+      // Gather the non-zero offsets of each USD point
+      std::vector<std::vector<std::pair<size_t, pxr::GfVec3f>>> pointOffsets(info.NumberOfPoints);
+      for (size_t sub = 0; sub < nbSubShapes && sub < info.SubShapePointOffsets.size(); sub++)
+      {
+        const pxr::VtVec3fArray& offsets = info.SubShapePointOffsets[sub];
+        const unsigned int blendShape = info.SubShapeBlendShapes[sub];
+        const pxr::VtIntArray* indices = blendShape < info.BlendShapePointIndices.size()
+          ? &info.BlendShapePointIndices[blendShape]
+          : nullptr;
+
+        // Empty point indices means the blend shape applies to all points
+        const bool sparse = indices && !indices->empty();
+        const size_t nbOffsets =
+          sparse ? std::min(offsets.size(), indices->size()) : offsets.size();
+        for (size_t i = 0; i < nbOffsets; i++)
+        {
+          const size_t pointId = sparse ? static_cast<size_t>((*indices)[i]) : i;
+          if (pointId < info.NumberOfPoints && offsets[i] != pxr::GfVec3f(0.f))
+          {
+            pointOffsets[pointId].emplace_back(sub, offsets[i]);
+          }
+        }
+      }
+
+      info.FirstOffsets.resize(info.NumberOfPoints + 1);
+      info.FirstOffsets[0] = 0;
+      for (size_t i = 0; i < info.NumberOfPoints; i++)
+      {
+        info.FirstOffsets[i + 1] = info.FirstOffsets[i] + pointOffsets[i].size();
+      }
+
+      info.Offsets = vtkSmartPointer<vtkFloatArray>::New();
+      info.Offsets->SetName("BlendShapeOffsets");
+      info.Offsets->SetNumberOfComponents(4);
+      info.Offsets->SetNumberOfTuples(static_cast<vtkIdType>(info.FirstOffsets.back()));
+
+      float* output = info.Offsets->GetPointer(0);
+      vtkSMPTools::For(0, static_cast<vtkIdType>(info.NumberOfPoints),
+        [&](vtkIdType begin, vtkIdType end)
+        {
+          for (vtkIdType i = begin; i < end; i++)
+          {
+            float* offset = output + 4 * info.FirstOffsets[i];
+            for (const auto& [sub, value] : pointOffsets[i])
+            {
+              offset[0] = static_cast<float>(sub);
+              offset[1] = value[0];
+              offset[2] = value[1];
+              offset[3] = value[2];
+              offset += 4;
+            }
+          }
+        });
+    }
+
+    // Remap to output points if face-varying, the offsets of a USD point are shared
+    vtkIdTypeArray* sourceIds =
+      vtkIdTypeArray::SafeDownCast(polydata->GetPointData()->GetArray("SourceIds"));
+
+    vtkNew<vtkFloatArray> ranges;
+    ranges->SetName("BlendShapeRanges");
+    ranges->SetNumberOfComponents(2);
+    ranges->SetNumberOfTuples(nbPoints);
+
+    float* range = ranges->GetPointer(0);
+    vtkSMPTools::For(0, nbPoints,
+      [&](vtkIdType begin, vtkIdType end)
+      {
+        for (vtkIdType i = begin; i < end; i++)
+        {
+          size_t srcIdx = sourceIds ? sourceIds->GetValue(i) : i;
+          if (srcIdx < info.NumberOfPoints)
+          {
+            range[2 * i] = static_cast<float>(info.FirstOffsets[srcIdx]);
+            range[2 * i + 1] =
+              static_cast<float>(info.FirstOffsets[srcIdx + 1] - info.FirstOffsets[srcIdx]);
+          }
+          else
+          {
+            range[2 * i] = range[2 * i + 1] = 0.f;
+          }
+        }
+      });
+
+    polydata->GetFieldData()->AddArray(info.Offsets);
+    polydata->GetFieldData()->AddArray(ranges);
+  }
+
   std::unordered_map<std::string,
     std::pair<vtkSmartPointer<vtkActor>, vtkSmartPointer<vtkPolyData>>>
     ArmatureMap;
@@ -1751,7 +2019,9 @@ private:
   std::unordered_map<std::string, vtkSmartPointer<vtkPolyData>> MeshMap;
   std::unordered_map<std::string, vtkSmartPointer<vtkProperty>> ShaderMap;
   std::unordered_map<std::string, vtkSmartPointer<vtkImageData>> TextureMap;
+  std::unordered_map<std::string, F3DTextureCache::Image> PendingTextures;
   std::unordered_map<std::string, MorphingInfo> MorphingMap;
+  std::mutex MorphingMutex;
 
   pxr::UsdSkelCache SkelCache;
   vtkNew<vtkMatrix4x4> RootTransform;
@@ -1830,12 +2100,12 @@ int vtkF3DUSDImporter::ImportBegin()
         vtkErrorMacro("Cannot determine USD format from stream");
         return 0;
       }
-      this->Internals->ReadScene(stream, hint);
+      this->Internals->ReadScene(stream, hint, this->LoadPayloads);
     }
     else
 #endif
     {
-      this->Internals->ReadScene(this->GetFileName());
+      this->Internals->ReadScene(this->GetFileName(), this->LoadPayloads);
     }
   }
   catch (const std::runtime_error& e)
@@ -1893,6 +2163,7 @@ void vtkF3DUSDImporter::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
   os << indent << "AnimationEnabled: " << std::boolalpha << this->AnimationEnabled << "\n";
+  os << indent << "LoadPayloads: " << std::boolalpha << this->LoadPayloads << "\n";
 }
 
 //------------------------------------------------------------------------------
@@ -108,6 +108,17 @@ public:
    */
   void SetResourcesPath(const std::string& path);
 
+  ///@{
+  /**
+   * Set/Get if payloads are loaded when opening the stage.
+   * When disabled, prims with an unloaded payload are shown as a box using their extents hint
+   * if authored, which is much faster for large stages.
+   * Default is true.
+   */
+  vtkSetMacro(LoadPayloads, bool);
+  vtkGetMacro(LoadPayloads, bool);
+  ///@}
+
 protected:
   vtkF3DUSDImporter();
   ~vtkF3DUSDImporter() override;
@@ -120,6 +131,7 @@ private:
   void operator=(const vtkF3DUSDImporter&) = delete;
 
   bool AnimationEnabled = false;
+  bool LoadPayloads = true;
 
   class vtkInternals;
   std::unique_ptr<vtkInternals> Internals;
@@ -4,5 +4,10 @@ void applyCustomImporter(
 {
   vtkF3DUSDImporter* usdImporter = vtkF3DUSDImporter::SafeDownCast(importer);
   usdImporter->SetResourcesPath(this->ReaderOptions.at("USD.resources_path"));
+
+  std::string optName = "USD.load_payloads";
+  std::string str = this->ReaderOptions.at(optName);
+  bool loadPayloads = (F3DUtils::ParseToDouble(str, 1, optName) != 0);
+  usdImporter->SetLoadPayloads(loadPayloads);
 }
 // clang-format on
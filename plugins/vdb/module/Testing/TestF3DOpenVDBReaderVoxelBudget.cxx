@@ -0,0 +1,46 @@
+#include <vtkNew.h>
+
+#include "vtkF3DOpenVDBReader.h"
+
+#include <cmath>
+#include <iostream>
+
+int TestF3DOpenVDBReaderVoxelBudget(int vtkNotUsed(argc), char* argv[])
+{
+  std::string filename = std::string(argv[1]) + "data/icosahedron.vdb";
+
+  // A large budget reads the grids at full resolution
+  if (vtkF3DOpenVDBReader::ComputeDownsamplingFactor(filename, VTK_ID_MAX) != 1.0)
+  {
+    std::cerr << "A large voxel budget should not downsample\n";
+    return EXIT_FAILURE;
+  }
+
+  double factor = vtkF3DOpenVDBReader::ComputeDownsamplingFactor(filename, 1000);
+  if (factor <= 0 || factor >= 1)
+  {
+    std::cerr << "Unexpected downsampling factor for a small voxel budget: " << factor << "\n";
+    return EXIT_FAILURE;
+  }
+
+  if (vtkF3DOpenVDBReader::ComputeDownsamplingFactor(
+        std::string(argv[1]) + "data/inexistent.vdb", 1000) > 0)
+  {
+    std::cerr << "An invalid file should not provide a downsampling factor\n";
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkF3DOpenVDBReader> reader;
+  reader->SetFileName(filename.c_str());
+  reader->SetDownsamplingFactor(0.5);
+  reader->SetVoxelBudget(1000);
+  reader->Update();
+
+  if (std::abs(reader->GetDownsamplingFactor() - factor) > 1e-6)
+  {
+    std::cerr << "The voxel budget did not replace the downsampling factor\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
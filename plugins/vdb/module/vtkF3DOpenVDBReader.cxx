@@ -0,0 +1,88 @@
+#include "vtkF3DOpenVDBReader.h"
+
+#include <vtkObjectFactory.h>
+
+#include <openvdb/openvdb.h>
+
+#include <algorithm>
+#include <cmath>
+
+//----------------------------------------------------------------------------
+vtkStandardNewMacro(vtkF3DOpenVDBReader);
+
+//----------------------------------------------------------------------------
+void vtkF3DOpenVDBReader::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "VoxelBudget: " << this->VoxelBudget << "\n";
+}
+
+//----------------------------------------------------------------------------
+double vtkF3DOpenVDBReader::ComputeDownsamplingFactor(
+  const std::string& fileName, vtkIdType voxelBudget)
+{
+  if (fileName.empty() || voxelBudget <= 0)
+  {
+    return -1;
+  }
+
+  double nbVoxels = 0;
+  try
+  {
+    openvdb::initialize();
+    openvdb::io::File file(fileName);
+    file.open(false);
+
+    // Only the metadata is read, the grids trees are not loaded
+    openvdb::GridPtrVecPtr grids = file.readAllGridMetadata();
+    file.close();
+
+    // Volumes are densified over the active voxels bounding box of each grid
+    for (const openvdb::GridBase::Ptr& grid : *grids)
+    {
+      const openvdb::Vec3i bboxMin =
+        grid->metaValue<openvdb::Vec3i>(openvdb::GridBase::META_FILE_BBOX_MIN);
+      const openvdb::Vec3i bboxMax =
+        grid->metaValue<openvdb::Vec3i>(openvdb::GridBase::META_FILE_BBOX_MAX);
+      const openvdb::Vec3i dims = bboxMax - bboxMin + openvdb::Vec3i(1);
+      if (dims.x() > 0 && dims.y() > 0 && dims.z() > 0)
+      {
+        nbVoxels += static_cast<double>(dims.x()) * dims.y() * dims.z();
+      }
+    }
+  }
+  catch (const openvdb::Exception&)
+  {
+    return -1;
+  }
+
+  if (nbVoxels <= 0)
+  {
+    return 1;
+  }
+
+  // The downsampling factor applies on each axis
+  return std::min(1.0, std::cbrt(static_cast<double>(voxelBudget) / nbVoxels));
+}
+
+//----------------------------------------------------------------------------
+int vtkF3DOpenVDBReader::RequestInformation(
+  vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  if (this->VoxelBudget > 0 && this->GetFileName())
+  {
+    const double factor =
+      vtkF3DOpenVDBReader::ComputeDownsamplingFactor(this->GetFileName(), this->VoxelBudget);
+    if (factor > 0)
+    {
+      this->SetDownsamplingFactor(factor);
+    }
+    else
+    {
+      vtkWarningMacro("Cannot read the grids bounding boxes of "
+        << this->GetFileName() << ", using the downsampling factor");
+    }
+  }
+
+  return this->Superclass::RequestInformation(request, inputVector, outputVector);
+}
@@ -0,0 +1,62 @@
+/**
+ * @class   vtkF3DOpenVDBReader
+ * @brief   Specialized version of the OpenVDB reader choosing its downsampling factor
+ *
+ * A specialized version of the vtkOpenVDBReader that is able to choose the downsampling factor
+ * so the dense volumes it produces fit in a voxel budget.
+ * The active voxels bounding box of each grid is read from the file metadata,
+ * so the budget is computed without reading the grids.
+ * Grids are still resampled uniformly into dense volumes, they are not traversed sparsely,
+ * so sparse grids with large bounding boxes are downsampled more than their active voxels need.
+ */
+
+#ifndef vtkF3DOpenVDBReader_h
+#define vtkF3DOpenVDBReader_h
+
+#include <vtkOpenVDBReader.h>
+
+#include <string>
+
+class vtkF3DOpenVDBReader : public vtkOpenVDBReader
+{
+public:
+  static vtkF3DOpenVDBReader* New();
+  vtkTypeMacro(vtkF3DOpenVDBReader, vtkOpenVDBReader);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Set/Get the maximum number of voxels of all the volumes read, 0 means no budget.
+   * When positive, the DownsamplingFactor is replaced by the largest factor, up to 1,
+   * that fits the budget. Files read from a stream use the DownsamplingFactor.
+   * Default is 0.
+   */
+  vtkSetMacro(VoxelBudget, vtkIdType);
+  vtkGetMacro(VoxelBudget, vtkIdType);
+  ///@}
+
+  /**
+   * Compute the largest downsampling factor, up to 1, so the dense volumes of the grids
+   * stored in the file fit in the voxel budget.
+   * Return a negative value if the file metadata cannot be read.
+   */
+  static double ComputeDownsamplingFactor(const std::string& fileName, vtkIdType voxelBudget);
+
+protected:
+  vtkF3DOpenVDBReader() = default;
+  ~vtkF3DOpenVDBReader() override = default;
+
+  /**
+   * Update the downsampling factor from the voxel budget if any,
+   * then call request information on the superclass.
+   */
+  int RequestInformation(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+
+private:
+  vtkIdType VoxelBudget = 0;
+
+  vtkF3DOpenVDBReader(const vtkF3DOpenVDBReader&) = delete;
+  void operator=(const vtkF3DOpenVDBReader&) = delete;
+};
+
+#endif
@@ -1,6 +1,6 @@
 void applyCustomReader(vtkAlgorithm* algo, const std::string&, vtkResourceStream*) const override
 {
-  vtkOpenVDBReader* vdbReader = vtkOpenVDBReader::SafeDownCast(algo);
+  vtkF3DOpenVDBReader* vdbReader = vtkF3DOpenVDBReader::SafeDownCast(algo);
 
   // No check needed, we know the option exists
   std::string optName = "VDB.downsampling_factor";
@@ -10,6 +10,12 @@ void applyCustomReader(vtkAlgorithm* algo, const std::string&, vtkResourceStream
   double dsFactor = F3DUtils::ParseToDouble(dsOptStr, 0.1, optName);
   vdbReader->SetDownsamplingFactor(dsFactor);
 
+  // When set, the voxel budget replaces the downsampling factor by the one fitting the budget
+  optName = "VDB.voxel_budget";
+  std::string budgetOptStr = this->ReaderOptions.at(optName);
+  vdbReader->SetVoxelBudget(
+    static_cast<vtkIdType>(F3DUtils::ParseToInt64(budgetOptStr, 0, optName)));
+
   // Merge volumes together
   vdbReader->MergeImageVolumesOn();
 }
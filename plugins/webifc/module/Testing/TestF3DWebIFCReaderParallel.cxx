@@ -0,0 +1,77 @@
+#include <vtkCellArray.h>
+#include <vtkDataArray.h>
+#include <vtkNew.h>
+#include <vtkPolyData.h>
+#include <vtkSMPTools.h>
+#include <vtkSmartPointer.h>
+#include <vtkTestUtilities.h>
+
+#include "vtkF3DWebIFCReader.h"
+
+#include <iostream>
+
+namespace
+{
+vtkSmartPointer<vtkPolyData> Read(const std::string& filename)
+{
+  vtkNew<vtkF3DWebIFCReader> reader;
+  reader->SetFileName(filename);
+  reader->Update();
+
+  vtkSmartPointer<vtkPolyData> output = vtkSmartPointer<vtkPolyData>::New();
+  output->ShallowCopy(reader->GetOutput());
+  return output;
+}
+}
+
+int TestF3DWebIFCReaderParallel(int vtkNotUsed(argc), char* argv[])
+{
+  std::string filename = std::string(argv[1]) + "data/IfcOpenHouse_IFC4.ifc";
+
+  // placements are transformed and triangulated in parallel, the output must not depend on the
+  // number of threads
+  vtkSmartPointer<vtkPolyData> sequential;
+  vtkSMPTools::LocalScope(vtkSMPTools::Config{ 1 }, [&]() { sequential = ::Read(filename); });
+  vtkSmartPointer<vtkPolyData> parallel;
+  vtkSMPTools::LocalScope(vtkSMPTools::Config{ 8 }, [&]() { parallel = ::Read(filename); });
+
+  constexpr vtkIdType expectedPoints = 3218;
+  constexpr vtkIdType expectedCells = 1098;
+
+  for (vtkPolyData* output : { sequential.Get(), parallel.Get() })
+  {
+    if (output->GetNumberOfPoints() != expectedPoints ||
+      output->GetNumberOfCells() != expectedCells)
+    {
+      std::cerr << "Expected " << expectedPoints << " points and " << expectedCells
+                << " cells but got " << output->GetNumberOfPoints() << " points and "
+                << output->GetNumberOfCells() << " cells\n";
+      return EXIT_FAILURE;
+    }
+  }
+
+  for (vtkIdType i = 0; i < expectedPoints; i++)
+  {
+    double p1[3], p2[3];
+    sequential->GetPoint(i, p1);
+    parallel->GetPoint(i, p2);
+    if (p1[0] != p2[0] || p1[1] != p2[1] || p1[2] != p2[2])
+    {
+      std::cerr << "Point " << i << " differs between sequential and parallel reads\n";
+      return EXIT_FAILURE;
+    }
+  }
+
+  vtkDataArray* connectivity1 = sequential->GetPolys()->GetConnectivityArray();
+  vtkDataArray* connectivity2 = parallel->GetPolys()->GetConnectivityArray();
+  for (vtkIdType i = 0; i < connectivity1->GetNumberOfValues(); i++)
+  {
+    if (connectivity1->GetTuple1(i) != connectivity2->GetTuple1(i))
+    {
+      std::cerr << "Connectivity " << i << " differs between sequential and parallel reads\n";
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -4,6 +4,8 @@
 #include <vtkCellData.h>
 #include <vtkDoubleArray.h>
 #include <vtkFileResourceStream.h>
+#include <vtkFloatArray.h>
+#include <vtkIdTypeArray.h>
 #include <vtkInformation.h>
 #include <vtkNew.h>
 #include <vtkObjectFactory.h>
@@ -12,6 +14,7 @@
 #include <vtkPolyData.h>
 #include <vtkResourceParser.h>
 #include <vtkResourceStream.h>
+#include <vtkSMPTools.h>
 #include <vtkUnsignedCharArray.h>
 
 #include <web-ifc/modelmanager/ModelManager.h>
@@ -22,6 +25,7 @@
 #include <array>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 vtkStandardNewMacro(vtkF3DWebIFCReader);
@@ -161,14 +165,23 @@ int vtkF3DWebIFCReader::RequestData(
     const webifc::schema::IfcSchemaManager& schemaManager =
       this->Internals->Manager.GetSchemaManager();
 
-    vtkNew<vtkPoints> allPoints;
-    vtkNew<vtkCellArray> allPolys;
-    vtkNew<vtkDoubleArray> normals;
-    normals->SetNumberOfComponents(3);
-    normals->SetName("Normals");
-    vtkNew<vtkUnsignedCharArray> colors;
-    colors->SetNumberOfComponents(4);
-    colors->SetName("Colors");
+    // Geometry is read from web-ifc serially, as its geometry processor caches intermediate
+    // results and is not thread safe. Mapped items reuse the same geometryExpressID many times,
+    // the geometry is only looked up once for them and only transformed per placement.
+    struct Placement
+    {
+      const webifc::geometry::IfcGeometry* Geometry;
+      std::array<double, 16> Transform;
+      std::array<unsigned char, 4> Color;
+      vtkIdType PointOffset;
+      vtkIdType CellOffset;
+    };
+    std::vector<Placement> placements;
+    std::unordered_map<uint32_t, const webifc::geometry::IfcGeometry*> geometries;
+    vtkIdType nbPoints = 0;
+    vtkIdType nbCells = 0;
+
+    constexpr int vertexSize = 6;
 
     auto processElement = [&](uint32_t expressID)
     {
@@ -176,123 +189,30 @@ int vtkF3DWebIFCReader::RequestData(
 
       for (const auto& placedGeom : mesh.geometries)
       {
-        const auto& geometry = geometryProcessor->GetGeometry(placedGeom.geometryExpressID);
-
-        const auto& vertexData = geometry.vertexData;
-        const auto& indexData = geometry.indexData;
+        const webifc::geometry::IfcGeometry*& geometry = geometries[placedGeom.geometryExpressID];
+        if (!geometry)
+        {
+          geometry = &geometryProcessor->GetGeometry(placedGeom.geometryExpressID);
+        }
 
-        if (vertexData.empty() || indexData.empty())
+        if (geometry->vertexData.empty() || geometry->indexData.empty())
         {
           continue;
         }
 
-        const auto& transform = placedGeom.flatTransformation;
-        std::array<unsigned char, 4> color = { static_cast<unsigned char>(placedGeom.color.r * 255),
+        Placement placement;
+        placement.Geometry = geometry;
+        std::copy_n(placedGeom.flatTransformation.begin(), 16, placement.Transform.begin());
+        placement.Color = { static_cast<unsigned char>(placedGeom.color.r * 255),
           static_cast<unsigned char>(placedGeom.color.g * 255),
           static_cast<unsigned char>(placedGeom.color.b * 255),
           static_cast<unsigned char>(placedGeom.color.a * 255) };
+        placement.PointOffset = nbPoints;
+        placement.CellOffset = nbCells;
+        placements.emplace_back(placement);
 
-        vtkIdType pointOffset = allPoints->GetNumberOfPoints();
-        constexpr int vertexSize = 6;
-
-#ifdef __linux__
-        // WORKAROUND: web-ifc produces inconsistent triangle winding order on Linux.
-        // Vertex normals are correct, so compare with geometric normal to fix winding.
-        // Once https://github.com/ThatOpen/engine_web-ifc/issues/1811 is fixed,
-        // remove this #ifdef __linux__ block and keep only the #else branch.
-        std::vector<std::array<double, 3>> localPositions;
-        std::vector<std::array<double, 3>> localNormals;
-        localPositions.reserve(vertexData.size() / vertexSize);
-        localNormals.reserve(vertexData.size() / vertexSize);
-
-        for (size_t i = 0; i < vertexData.size(); i += vertexSize)
-        {
-          double x = vertexData[i];
-          double y = vertexData[i + 1];
-          double z = vertexData[i + 2];
-          double nx = vertexData[i + 3];
-          double ny = vertexData[i + 4];
-          double nz = vertexData[i + 5];
-
-          double tx = transform[0] * x + transform[4] * y + transform[8] * z + transform[12];
-          double ty = transform[1] * x + transform[5] * y + transform[9] * z + transform[13];
-          double tz = transform[2] * x + transform[6] * y + transform[10] * z + transform[14];
-
-          double tnx = transform[0] * nx + transform[4] * ny + transform[8] * nz;
-          double tny = transform[1] * nx + transform[5] * ny + transform[9] * nz;
-          double tnz = transform[2] * nx + transform[6] * ny + transform[10] * nz;
-
-          localPositions.push_back({ tx, ty, tz });
-          localNormals.push_back({ tnx, tny, tnz });
-          allPoints->InsertNextPoint(tx, ty, tz);
-          normals->InsertNextTuple3(tnx, tny, tnz);
-        }
-
-        for (size_t i = 0; i < indexData.size(); i += 3)
-        {
-          uint32_t i0 = indexData[i];
-          uint32_t i1 = indexData[i + 1];
-          uint32_t i2 = indexData[i + 2];
-
-          const auto& p0 = localPositions[i0];
-          const auto& p1 = localPositions[i1];
-          const auto& p2 = localPositions[i2];
-
-          double e1x = p1[0] - p0[0], e1y = p1[1] - p0[1], e1z = p1[2] - p0[2];
-          double e2x = p2[0] - p0[0], e2y = p2[1] - p0[1], e2z = p2[2] - p0[2];
-          double gnx = e1y * e2z - e1z * e2y;
-          double gny = e1z * e2x - e1x * e2z;
-          double gnz = e1x * e2y - e1y * e2x;
-
-          const auto& n0 = localNormals[i0];
-          const auto& n1 = localNormals[i1];
-          const auto& n2 = localNormals[i2];
-          double avgNx = n0[0] + n1[0] + n2[0];
-          double avgNy = n0[1] + n1[1] + n2[1];
-          double avgNz = n0[2] + n1[2] + n2[2];
-
-          bool windingIsWrong = (gnx * avgNx + gny * avgNy + gnz * avgNz) < 0;
-          if (windingIsWrong)
-          {
-            std::swap(i1, i2);
-          }
-
-          vtkIdType pts[3] = { static_cast<vtkIdType>(i0) + pointOffset,
-            static_cast<vtkIdType>(i1) + pointOffset, static_cast<vtkIdType>(i2) + pointOffset };
-          allPolys->InsertNextCell(3, pts);
-          colors->InsertNextTypedTuple(color.data());
-        }
-#else
-        for (size_t i = 0; i < vertexData.size(); i += vertexSize)
-        {
-          double x = vertexData[i];
-          double y = vertexData[i + 1];
-          double z = vertexData[i + 2];
-          double nx = vertexData[i + 3];
-          double ny = vertexData[i + 4];
-          double nz = vertexData[i + 5];
-
-          double tx = transform[0] * x + transform[4] * y + transform[8] * z + transform[12];
-          double ty = transform[1] * x + transform[5] * y + transform[9] * z + transform[13];
-          double tz = transform[2] * x + transform[6] * y + transform[10] * z + transform[14];
-
-          double tnx = transform[0] * nx + transform[4] * ny + transform[8] * nz;
-          double tny = transform[1] * nx + transform[5] * ny + transform[9] * nz;
-          double tnz = transform[2] * nx + transform[6] * ny + transform[10] * nz;
-
-          allPoints->InsertNextPoint(tx, ty, tz);
-          normals->InsertNextTuple3(tnx, tny, tnz);
-        }
-
-        for (size_t i = 0; i < indexData.size(); i += 3)
-        {
-          vtkIdType pts[3] = { static_cast<vtkIdType>(indexData[i]) + pointOffset,
-            static_cast<vtkIdType>(indexData[i + 1]) + pointOffset,
-            static_cast<vtkIdType>(indexData[i + 2]) + pointOffset };
-          allPolys->InsertNextCell(3, pts);
-          colors->InsertNextTypedTuple(color.data());
-        }
-#endif
+        nbPoints += static_cast<vtkIdType>(geometry->vertexData.size() / vertexSize);
+        nbCells += static_cast<vtkIdType>(geometry->indexData.size() / 3);
       }
     };
 
@@ -318,6 +238,128 @@ int vtkF3DWebIFCReader::RequestData(
       }
     }
 
+    vtkNew<vtkFloatArray> positions;
+    positions->SetNumberOfComponents(3);
+    positions->SetNumberOfTuples(nbPoints);
+    vtkNew<vtkDoubleArray> normals;
+    normals->SetNumberOfComponents(3);
+    normals->SetNumberOfTuples(nbPoints);
+    normals->SetName("Normals");
+    vtkNew<vtkUnsignedCharArray> colors;
+    colors->SetNumberOfComponents(4);
+    colors->SetNumberOfTuples(nbCells);
+    colors->SetName("Colors");
+    vtkNew<vtkIdTypeArray> offsets;
+    offsets->SetNumberOfTuples(nbCells + 1);
+    vtkNew<vtkIdTypeArray> connectivity;
+    connectivity->SetNumberOfTuples(3 * nbCells);
+
+    float* positionsPtr = positions->GetPointer(0);
+    double* normalsPtr = normals->GetPointer(0);
+    unsigned char* colorsPtr = colors->GetPointer(0);
+    vtkIdType* offsetsPtr = offsets->GetPointer(0);
+    vtkIdType* connectivityPtr = connectivity->GetPointer(0);
+    offsetsPtr[nbCells] = 3 * nbCells;
+
+    // Each placement writes its own range of the output arrays, known from the offsets computed
+    // above, so placements are transformed and triangulated in parallel without concatenation.
+    vtkSMPTools::For(0, static_cast<vtkIdType>(placements.size()),
+      [&](vtkIdType begin, vtkIdType end)
+      {
+        for (vtkIdType placementId = begin; placementId < end; placementId++)
+        {
+          const Placement& placement = placements[placementId];
+          const auto& vertexData = placement.Geometry->vertexData;
+          const auto& indexData = placement.Geometry->indexData;
+          const auto& transform = placement.Transform;
+
+          float* pointPtr = positionsPtr + 3 * placement.PointOffset;
+          double* normalPtr = normalsPtr + 3 * placement.PointOffset;
+          for (size_t i = 0; i < vertexData.size(); i += vertexSize)
+          {
+            double x = vertexData[i];
+            double y = vertexData[i + 1];
+            double z = vertexData[i + 2];
+            double nx = vertexData[i + 3];
+            double ny = vertexData[i + 4];
+            double nz = vertexData[i + 5];
+
+            double tx = transform[0] * x + transform[4] * y + transform[8] * z + transform[12];
+            double ty = transform[1] * x + transform[5] * y + transform[9] * z + transform[13];
+            double tz = transform[2] * x + transform[6] * y + transform[10] * z + transform[14];
+
+            *pointPtr++ = static_cast<float>(tx);
+            *pointPtr++ = static_cast<float>(ty);
+            *pointPtr++ = static_cast<float>(tz);
+
+            *normalPtr++ = transform[0] * nx + transform[4] * ny + transform[8] * nz;
+            *normalPtr++ = transform[1] * nx + transform[5] * ny + transform[9] * nz;
+            *normalPtr++ = transform[2] * nx + transform[6] * ny + transform[10] * nz;
+          }
+
+          vtkIdType cellId = placement.CellOffset;
+          for (size_t i = 0; i < indexData.size(); i += 3, cellId++)
+          {
+            vtkIdType i0 = static_cast<vtkIdType>(indexData[i]) + placement.PointOffset;
+            vtkIdType i1 = static_cast<vtkIdType>(indexData[i + 1]) + placement.PointOffset;
+            vtkIdType i2 = static_cast<vtkIdType>(indexData[i + 2]) + placement.PointOffset;
+
+#ifdef __linux__
+            // WORKAROUND: web-ifc produces inconsistent triangle winding order on Linux.
+            // Vertex normals are correct, so compare with geometric normal to fix winding.
+            // The geometric normal is computed in double precision from the transformed local
+            // vertices, as float positions are not precise enough for small triangles far from
+            // the origin.
+            // Once https://github.com/ThatOpen/engine_web-ifc/issues/1811 is fixed,
+            // remove this #ifdef __linux__ block.
+            auto transformVertex = [&](vtkIdType index, std::array<double, 3>& point)
+            {
+              const double* v = vertexData.data() + (index - placement.PointOffset) * vertexSize;
+              for (int c = 0; c < 3; c++)
+              {
+                point[c] = transform[c] * v[0] + transform[4 + c] * v[1] +
+                  transform[8 + c] * v[2] + transform[12 + c];
+              }
+            };
+            std::array<double, 3> p0, p1, p2;
+            transformVertex(i0, p0);
+            transformVertex(i1, p1);
+            transformVertex(i2, p2);
+
+            double e1x = p1[0] - p0[0], e1y = p1[1] - p0[1], e1z = p1[2] - p0[2];
+            double e2x = p2[0] - p0[0], e2y = p2[1] - p0[1], e2z = p2[2] - p0[2];
+            double gnx = e1y * e2z - e1z * e2y;
+            double gny = e1z * e2x - e1x * e2z;
+            double gnz = e1x * e2y - e1y * e2x;
+
+            const double* n0 = normalsPtr + 3 * i0;
+            const double* n1 = normalsPtr + 3 * i1;
+            const double* n2 = normalsPtr + 3 * i2;
+            double avgNx = n0[0] + n1[0] + n2[0];
+            double avgNy = n0[1] + n1[1] + n2[1];
+            double avgNz = n0[2] + n1[2] + n2[2];
+
+            bool windingIsWrong = (gnx * avgNx + gny * avgNy + gnz * avgNz) < 0;
+            if (windingIsWrong)
+            {
+              std::swap(i1, i2);
+            }
+#endif
+
+            offsetsPtr[cellId] = 3 * cellId;
+            connectivityPtr[3 * cellId] = i0;
+            connectivityPtr[3 * cellId + 1] = i1;
+            connectivityPtr[3 * cellId + 2] = i2;
+            std::copy(placement.Color.begin(), placement.Color.end(), colorsPtr + 4 * cellId);
+          }
+        }
+      });
+
+    vtkNew<vtkPoints> allPoints;
+    allPoints->SetData(positions);
+    vtkNew<vtkCellArray> allPolys;
+    allPolys->SetData(offsets, connectivity);
+
     output->SetPoints(allPoints);
     output->SetPolys(allPolys);
     output->GetPointData()->SetNormals(normals);
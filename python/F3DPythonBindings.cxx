@@ -142,12 +142,25 @@ std::pair<size_t, f3d::mesh_view::data_array_t> fromBuffer(py::buffer buf)
   return { info.shape[0], std::move(dataArray) };
 }
 
+// Owner of an encoded file buffer, exposed through the buffer protocol to avoid copies
+struct file_buffer_t
+{
+  std::vector<unsigned char> data;
+};
+
 PYBIND11_MODULE(pyf3d, module)
 {
   module.doc() = "f3d library bindings";
 
+  py::class_<file_buffer_t>(module, "_FileBuffer", py::buffer_protocol())
+    .def_buffer(
+      [](file_buffer_t& buf)
+      {
+        return py::buffer_info(buf.data.data(), static_cast<py::ssize_t>(buf.data.size()), true);
+      });
+
   // f3d::image
-  py::class_<f3d::image> image(module, "Image");
+  py::class_<f3d::image> image(module, "Image", py::buffer_protocol());
 
   py::enum_<f3d::image::SaveFormat>(image, "SaveFormat")
     .value("PNG", f3d::image::SaveFormat::PNG)
@@ -181,15 +194,45 @@ PYBIND11_MODULE(pyf3d, module)
     return py::bytes(static_cast<char*>(img.getContent()), expectedSize);
   };
 
-  auto getFileBytes = [](const f3d::image& img, f3d::image::SaveFormat format)
+  auto getFileBuffer = [](const f3d::image& img, f3d::image::SaveFormat format)
+  {
+    file_buffer_t buffer;
+    {
+      py::gil_scoped_release release;
+      buffer.data = img.saveBuffer(format);
+    }
+    return py::memoryview(py::cast(std::move(buffer)));
+  };
+
+  auto getImageBuffer = [](f3d::image& img)
   {
-    std::vector<unsigned char> result = img.saveBuffer(format);
-    return py::bytes(reinterpret_cast<char*>(result.data()), result.size());
+    const py::ssize_t channelSize = img.getChannelTypeSize();
+    const py::ssize_t channelCount = img.getChannelCount();
+    const py::ssize_t width = img.getWidth();
+    const py::ssize_t height = img.getHeight();
+
+    std::string format;
+    switch (img.getChannelType())
+    {
+      case f3d::image::ChannelType::BYTE:
+        format = py::format_descriptor<uint8_t>::format();
+        break;
+      case f3d::image::ChannelType::SHORT:
+        format = py::format_descriptor<uint16_t>::format();
+        break;
+      case f3d::image::ChannelType::FLOAT:
+        format = py::format_descriptor<float>::format();
+        break;
+    }
+
+    return py::buffer_info(img.getContent(), channelSize, format, 3,
+      { height, width, channelCount },
+      { width * channelCount * channelSize, channelCount * channelSize, channelSize });
   };
 
   image //
     .def(py::init<>())
-    .def(py::init<const std::filesystem::path&>())
+    .def(py::init<const std::filesystem::path&>(), py::call_guard<py::gil_scoped_release>())
     .def(py::init<unsigned int, unsigned int, unsigned int, f3d::image::ChannelType>())
     .def(py::self == py::self)
     .def(py::self != py::self)
@@ -200,12 +243,17 @@ PYBIND11_MODULE(pyf3d, module)
     .def_property_readonly("channel_type", &f3d::image::getChannelType)
     .def_property_readonly("channel_type_size", &f3d::image::getChannelTypeSize)
     .def_property("content", getImageBytes, setImageBytes)
-    .def("compare", &f3d::image::compare)
-    .def(
-      "save", &f3d::image::save, py::arg("path"), py::arg("format") = f3d::image::SaveFormat::PNG)
-    .def("save_buffer", getFileBytes, py::arg("format") = f3d::image::SaveFormat::PNG)
+    .def_buffer(getImageBuffer)
+    .def("compare", &f3d::image::compare, py::call_guard<py::gil_scoped_release>())
+    .def("save", &f3d::image::save, py::arg("path"),
+      py::arg("format") = f3d::image::SaveFormat::PNG, py::call_guard<py::gil_scoped_release>())
+    .def("save_buffer", getFileBuffer, py::arg("format") = f3d::image::SaveFormat::PNG)
     .def("_repr_png_",
-      [&](const f3d::image& img) { return getFileBytes(img, f3d::image::SaveFormat::PNG); })
+      [](const f3d::image& img)
+      {
+        std::vector<unsigned char> result = img.saveBuffer(f3d::image::SaveFormat::PNG);
+        return py::bytes(reinterpret_cast<char*>(result.data()), result.size());
+      })
     .def("to_terminal_text", [](const f3d::image& img) { return img.toTerminalText(); })
     .def("set_metadata", &f3d::image::setMetadata)
     .def("get_metadata",
@@ -448,9 +496,13 @@ PYBIND11_MODULE(pyf3d, module)
           return;
         }
 
+        // the callback may be called from start, which releases the GIL
         auto cb = [=](const std::string& desc, const std::string& value, const std::string& bind,
                     double duration) -> bool
-        { return py::bool_(callback(desc, value, bind, duration)); };
+        {
+          py::gil_scoped_acquire gil;
+          return py::bool_(callback(desc, value, bind, duration));
+        };
 
         interactor.setNotificationCallback(cb);
       },
@@ -465,10 +517,12 @@ PYBIND11_MODULE(pyf3d, module)
       "Trigger a text character input")
     .def(
       "trigger_event_loop", &f3d::interactor::triggerEventLoop, "Manually trigger the event loop.")
-    .def("play_interaction", &f3d::interactor::playInteraction, "Play an interaction file")
-    .def("record_interaction", &f3d::interactor::recordInteraction, "Record an interaction file")
+    .def("play_interaction", &f3d::interactor::playInteraction, "Play an interaction file",
+      py::call_guard<py::gil_scoped_release>())
+    .def("record_interaction", &f3d::interactor::recordInteraction, "Record an interaction file",
+      py::call_guard<py::gil_scoped_release>())
     .def("start", &f3d::interactor::start, "Start the interactor and the event loop",
-      py::arg("delta_time") = 1.0 / 30)
+      py::arg("delta_time") = 1.0 / 30, py::call_guard<py::gil_scoped_release>())
     .def("stop", &f3d::interactor::stop, "Stop the interactor and the event loop")
     .def(
       "request_render", &f3d::interactor::requestRender, "Request a render on the next event loop")
@@ -540,6 +594,9 @@ PYBIND11_MODULE(pyf3d, module)
     .def_property("points_time_dependent", nullptr,
       [](f3d::mesh_view::memory_view_t& self, bool timeDependent)
       { self.points.timeDependent = timeDependent; })
+    .def_property("points_dirty_ranges", nullptr,
+      [](f3d::mesh_view::memory_view_t& self, std::vector<std::pair<size_t, size_t>> ranges)
+      { self.points.dirtyRanges = std::move(ranges); })
     .def_property("normals", nullptr,
       [](f3d::mesh_view::memory_view_t& self, py::buffer b)
       {
@@ -557,6 +614,9 @@ PYBIND11_MODULE(pyf3d, module)
     .def_property("normals_time_dependent", nullptr,
       [](f3d::mesh_view::memory_view_t& self, bool timeDependent)
       { self.normals.timeDependent = timeDependent; })
+    .def_property("normals_dirty_ranges", nullptr,
+      [](f3d::mesh_view::memory_view_t& self, std::vector<std::pair<size_t, size_t>> ranges)
+      { self.normals.dirtyRanges = std::move(ranges); })
     .def_property("texture_coordinates", nullptr,
       [](f3d::mesh_view::memory_view_t& self, py::buffer b)
       {
@@ -574,6 +634,9 @@ PYBIND11_MODULE(pyf3d, module)
     .def_property("texture_coordinates_time_dependent", nullptr,
       [](f3d::mesh_view::memory_view_t& self, bool timeDependent)
       { self.textureCoordinates.timeDependent = timeDependent; })
+    .def_property("texture_coordinates_dirty_ranges", nullptr,
+      [](f3d::mesh_view::memory_view_t& self, std::vector<std::pair<size_t, size_t>> ranges)
+      { self.textureCoordinates.dirtyRanges = std::move(ranges); })
     .def_property("vertices_offsets", nullptr,
       [](f3d::mesh_view::memory_view_t& self, py::buffer b)
       {
@@ -799,15 +862,19 @@ PYBIND11_MODULE(pyf3d, module)
     .def("get_added_files", &f3d::scene::getAddedFiles,
       "Return the list of files currently added to the scene")
     .def("add", py::overload_cast<const std::filesystem::path&>(&f3d::scene::add),
-      "Add a file the scene", py::arg("file_path"))
+      "Add a file the scene", py::arg("file_path"), py::call_guard<py::gil_scoped_release>())
     .def("add", py::overload_cast<const std::vector<std::filesystem::path>&>(&f3d::scene::add),
-      "Add multiple filepaths to the scene", py::arg("file_path_vector"))
+      "Add multiple filepaths to the scene", py::arg("file_path_vector"),
+      py::call_guard<py::gil_scoped_release>())
     .def("add", py::overload_cast<const std::vector<std::string>&>(&f3d::scene::add),
-      "Add multiple filenames to the scene", py::arg("file_name_vector"))
+      "Add multiple filenames to the scene", py::arg("file_name_vector"),
+      py::call_guard<py::gil_scoped_release>())
     .def("add", py::overload_cast<const f3d::mesh_t&>(&f3d::scene::add),
-      "Add a surfacic mesh from memory into the scene", py::arg("mesh"))
+      "Add a surfacic mesh from memory into the scene", py::arg("mesh"),
+      py::call_guard<py::gil_scoped_release>())
     .def("add", py::overload_cast<std::shared_ptr<f3d::mesh_view>>(&f3d::scene::add),
-      "Add a surfacic mesh view from memory into the scene", py::arg("mesh"))
+      "Add a surfacic mesh view from memory into the scene", py::arg("mesh"),
+      py::call_guard<py::gil_scoped_release>())
     .def(
       "add",
       [](f3d::scene& scene, py::bytes buffer, std::size_t size)
@@ -815,6 +882,7 @@ PYBIND11_MODULE(pyf3d, module)
         PyErr_WarnEx(
           PyExc_DeprecationWarning, "add(buffer, size) is deprecated, use add(buffer) instead.", 1);
         std::string_view sv(buffer);
+        py::gil_scoped_release release;
         scene.add(reinterpret_cast<const std::byte*>(sv.data()), size);
       },
       "Add a memory buffer containing a file the scene", py::arg("buffer"), py::arg("size"))
@@ -822,11 +890,14 @@ PYBIND11_MODULE(pyf3d, module)
       "add",
       [](f3d::scene& scene, py::bytes buffer)
       {
+        // buffer is kept alive by the caller frame, its memory can be read without the GIL
         std::string_view sv(buffer);
+        py::gil_scoped_release release;
         scene.add(reinterpret_cast<const std::byte*>(sv.data()), sv.size());
       },
       "Add a memory buffer containing a file the scene", py::arg("buffer"), py::prepend())
-    .def("load_animation_time", &f3d::scene::loadAnimationTime)
+    .def("load_animation_time", &f3d::scene::loadAnimationTime,
+      py::call_guard<py::gil_scoped_release>())
     .def("animation_time_range", &f3d::scene::animationTimeRange)
     .def("get_animation_keyframes", &f3d::scene::getAnimationKeyFrames)
     .def("available_animations", &f3d::scene::availableAnimations)
@@ -840,7 +911,16 @@ PYBIND11_MODULE(pyf3d, module)
       py::arg("light_state"))
     .def("get_light", &f3d::scene::getLight, "Get a light from the scene", py::arg("index"))
     .def("get_light_count", &f3d::scene::getLightCount, "Get the number of lights in the scene")
-    .def("remove_all_lights", &f3d::scene::removeAllLights, "Remove all lights from the scene");
+    .def("remove_all_lights", &f3d::scene::removeAllLights, "Remove all lights from the scene")
+    .def("set_collect_load_statistics", &f3d::scene::setCollectLoadStatistics,
+      "Enable or disable the collection of statistics for each load")
+    .def("get_load_statistics", &f3d::scene::getLoadStatistics,
+      "Get the statistics of the loads done since their collection was enabled");
+
+  py::class_<f3d::scene::load_statistics_t>(scene, "LoadStatistics")
+    .def_readonly("reader_time", &f3d::scene::load_statistics_t::readerTime)
+    .def_readonly("post_process_time", &f3d::scene::load_statistics_t::postProcessTime)
+    .def_readonly("coloring_info_time", &f3d::scene::load_statistics_t::coloringInfoTime);
 
   // f3d::camera_state_t
   py::class_<f3d::camera_state_t>(module, "CameraState")
@@ -907,9 +987,13 @@ PYBIND11_MODULE(pyf3d, module)
       [](f3d::window& win, int w) { win.setSize(w, win.getHeight()); })
     .def_property("height", &f3d::window::getHeight,
       [](f3d::window& win, int h) { win.setSize(win.getWidth(), h); })
-    .def("render", &f3d::window::render, "Render the window")
+    .def("render", &f3d::window::render, "Render the window",
+      py::call_guard<py::gil_scoped_release>())
     .def("render_to_image", &f3d::window::renderToImage, "Render the window to an image",
-      py::arg("no_background") = false)
+      py::arg("no_background") = false, py::call_guard<py::gil_scoped_release>())
+    .def("render_views", &f3d::window::renderViews,
+      "Render the window once for each camera state and return the images", py::arg("views"),
+      py::arg("no_background") = false, py::call_guard<py::gil_scoped_release>())
     .def("set_position", &f3d::window::setPosition)
     .def("set_icon", &f3d::window::setIcon,
       "Set the icon of the window using a memory buffer representing a PNG file")
@@ -917,7 +1001,24 @@ PYBIND11_MODULE(pyf3d, module)
     .def("get_world_from_display", &f3d::window::getWorldFromDisplay,
       "Get world coordinate point from display coordinate")
     .def("get_display_from_world", &f3d::window::getDisplayFromWorld,
-      "Get display coordinate point from world coordinate");
+      "Get display coordinate point from world coordinate")
+    .def("set_collect_frame_statistics", &f3d::window::setCollectFrameStatistics,
+      "Enable or disable the collection of statistics for each rendered frame")
+    .def("get_frame_statistics", &f3d::window::getFrameStatistics,
+      "Get the statistics of the frames rendered since their collection was enabled");
+
+  py::class_<f3d::window::frame_statistics_t>(window, "FrameStatistics")
+    .def_readonly("cpu_time", &f3d::window::frame_statistics_t::cpuTime)
+    .def_readonly("gpu_time", &f3d::window::frame_statistics_t::gpuTime)
+    .def_readonly("pass_times", &f3d::window::frame_statistics_t::passTimes)
+    .def_readonly("gpu_memory", &f3d::window::frame_statistics_t::gpuMemory)
+    .def_readonly("frustum_culled_actors", &f3d::window::frame_statistics_t::frustumCulledActors)
+    .def_readonly(
+      "occlusion_culled_actors", &f3d::window::frame_statistics_t::occlusionCulledActors)
+    .def_readonly("interactive_effects_disabled",
+      &f3d::window::frame_statistics_t::interactiveEffectsDisabled)
+    .def_readonly(
+      "interactive_proxy_actors", &f3d::window::frame_statistics_t::interactiveProxyActors);
 
   // libInformation
   py::class_<f3d::engine::libInformation>(module, "LibInformation")
@@ -1002,7 +1103,7 @@ PYBIND11_MODULE(pyf3d, module)
       "interactor", &f3d::engine::getInteractor, py::return_value_policy::reference)
     .def("dump", &f3d::engine::dump, "Capture the engine state into a State")
     .def("load", &f3d::engine::load, "Restore the engine from a State", py::arg("state"),
-      py::return_value_policy::reference)
+      py::return_value_policy::reference, py::call_guard<py::gil_scoped_release>())
     .def_static("load_plugin", &f3d::engine::loadPlugin, "Load a plugin")
     .def_static(
       "autoload_plugins", &f3d::engine::autoloadPlugins, "Automatically load internal plugins")
@@ -38,6 +38,22 @@ def test_render_rgba(f3d_engine: f3d.Engine):
     assert len(data) == img.channel_count * img.width * img.height
 
 
+def test_render_views(f3d_engine: f3d.Engine):
+    window = f3d_engine.window
+    initial_state = window.camera.state
+
+    views = [f3d.CameraState(), f3d.CameraState(position=(1, 0, 0))]
+    imgs = window.render_views(views)
+    assert len(imgs) == len(views)
+    for img in imgs:
+        assert img.width == window.width
+        assert img.height == window.height
+        assert img.channel_count == 3
+
+    assert window.camera.state.position == initial_state.position
+    assert window.render_views([]) == []
+
+
 def test_set_data(f3d_engine: f3d.Engine):
     img = f3d_engine.window.render_to_image()
     data = img.content[:]
@@ -62,8 +78,27 @@ def test_save(f3d_engine: f3d.Engine):
 def test_save_buffer(f3d_engine: f3d.Engine):
     img = f3d_engine.window.render_to_image(True)
     buffer = img.save_buffer(f3d.Image.SaveFormat.PNG)
-    assert buffer.startswith(b"\x89PNG")
-    assert img._repr_png_() == buffer
+    assert isinstance(buffer, memoryview)
+    assert buffer.readonly
+    assert bytes(buffer[:4]) == b"\x89PNG"
+    assert img._repr_png_() == bytes(buffer)
+
+
+def test_buffer_protocol(f3d_engine: f3d.Engine):
+    img = f3d_engine.window.render_to_image(True)
+    view = memoryview(img)
+    assert view.shape == (img.height, img.width, img.channel_count)
+    assert view.format == "B"
+    assert view.tobytes() == img.content
+
+    img = f3d.Image(4, 2, 3, f3d.Image.ChannelType.FLOAT)
+    view = memoryview(img)
+    assert view.shape == (2, 4, 3)
+    assert view.format == "f"
+    assert view.itemsize == 4
+
+    view[0, 0, 0] = 0.5
+    assert img.normalized_pixel((0, 0))[0] == 0.5
 
 
 def test_formats(f3d_engine: f3d.Engine):
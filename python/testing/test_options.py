@@ -235,7 +235,7 @@ def test_get_domain_style():
 def test_get_enum_domain():
     options = f3d.Options()
     enum = options.get_enum_domain("render.effect.blending.mode")
-    assert len(enum) == 5
+    assert len(enum) == 6
 
 
 def test_get_range_domain():
@@ -0,0 +1,646 @@
+/**
+ * f3d_benchmark: measure the time needed to load and render files with libf3d.
+ *
+ * By default, each file is loaded several times in a scene of an engine without a window and
+ * the wall time, the time spent in each loading stage (reader, post-process, coloring
+ * information), the number of allocations and the process peak resident set size are reported.
+ *
+ * When an interaction recording is provided, each file is loaded once in an offscreen engine
+ * and the recording is replayed until the requested number of frames have been rendered.
+ * The CPU and GPU frame times, the GPU time of each render pass and the GPU memory in use are
+ * reported.
+ *
+ * Reports are written as JSON. A previous report can be provided as a baseline to detect
+ * regressions.
+ */
+
+#include <camera.h>
+#include <engine.h>
+#include <interactor.h>
+#include <log.h>
+#include <options.h>
+#include <scene.h>
+#include <window.h>
+
+#include <cxxopts.hpp>
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <new>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <Windows.h>
+// Windows.h must be included before psapi.h
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace fs = std::filesystem;
+
+//----------------------------------------------------------------------------
+// Count all allocations made through the global operator new, including the ones made by
+// libf3d and VTK when they share the global allocator with this executable.
+namespace
+{
+std::atomic<std::size_t> AllocationCount = 0;
+
+void* CountedAllocation(std::size_t size)
+{
+  AllocationCount.fetch_add(1, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size == 0 ? 1 : size))
+  {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+}
+
+void* operator new(std::size_t size)
+{
+  return ::CountedAllocation(size);
+}
+
+void* operator new[](std::size_t size)
+{
+  return ::CountedAllocation(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+namespace
+{
+//----------------------------------------------------------------------------
+struct FileResult
+{
+  std::string File;
+  std::vector<double> WallTimes;
+  std::vector<f3d::scene::load_statistics_t> Stages;
+  std::vector<double> Allocations;
+  std::size_t PeakRSS = 0;
+};
+
+//----------------------------------------------------------------------------
+/**
+ * Process peak resident set size in KiB
+ */
+std::size_t GetPeakRSS()
+{
+#ifdef _WIN32
+  PROCESS_MEMORY_COUNTERS counters;
+  if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+  {
+    return counters.PeakWorkingSetSize / 1024;
+  }
+  return 0;
+#else
+  rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
+  {
+    return 0;
+  }
+#ifdef __APPLE__
+  // ru_maxrss is in bytes on macOS and in KiB elsewhere
+  return static_cast<std::size_t>(usage.ru_maxrss) / 1024;
+#else
+  return static_cast<std::size_t>(usage.ru_maxrss);
+#endif
+#endif
+}
+
+//----------------------------------------------------------------------------
+double Median(std::vector<double> values)
+{
+  if (values.empty())
+  {
+    return 0;
+  }
+  const auto middle = values.begin() + values.size() / 2;
+  std::nth_element(values.begin(), middle, values.end());
+  return *middle;
+}
+
+//----------------------------------------------------------------------------
+/**
+ * Nearest-rank percentile, ratio is between 0 and 1
+ */
+double Percentile(std::vector<double> values, double ratio)
+{
+  if (values.empty())
+  {
+    return 0;
+  }
+  const auto rank = static_cast<size_t>(std::ceil(ratio * values.size()));
+  const auto nth = values.begin() + std::clamp<size_t>(rank, 1, values.size()) - 1;
+  std::nth_element(values.begin(), nth, values.end());
+  return *nth;
+}
+
+//----------------------------------------------------------------------------
+nlohmann::ordered_json Distribution(const std::vector<double>& values)
+{
+  return {
+    { "min", *std::ranges::min_element(values) },
+    { "median", ::Median(values) },
+    { "p99", ::Percentile(values, 0.99) },
+  };
+}
+
+//----------------------------------------------------------------------------
+/**
+ * Read a list of files, one per line, ignoring empty lines and lines starting with #
+ */
+std::vector<std::string> ReadFileList(const fs::path& listPath)
+{
+  std::vector<std::string> files;
+  std::ifstream list(listPath);
+  if (!list)
+  {
+    f3d::log::error("Cannot read file list ", listPath);
+    return files;
+  }
+
+  std::string line;
+  while (std::getline(list, line))
+  {
+    line.erase(line.find_last_not_of(" \t\r") + 1);
+    if (!line.empty() && line[0] != '#')
+    {
+      files.emplace_back(line);
+    }
+  }
+  return files;
+}
+
+//----------------------------------------------------------------------------
+bool Benchmark(
+  f3d::scene& scene, const fs::path& path, int iterations, int warmup, FileResult& result)
+{
+  for (int i = 0; i < warmup + iterations; i++)
+  {
+    scene.clear();
+    scene.setCollectLoadStatistics(true);
+
+    const std::size_t allocationsStart = AllocationCount.load();
+    const auto start = std::chrono::steady_clock::now();
+    try
+    {
+      scene.add(path);
+    }
+    catch (const f3d::scene::load_failure_exception& ex)
+    {
+      f3d::log::error("Cannot load ", path, ": ", ex.what());
+      return false;
+    }
+    const auto end = std::chrono::steady_clock::now();
+    const std::size_t allocations = AllocationCount.load() - allocationsStart;
+
+    if (i >= warmup)
+    {
+      result.WallTimes.emplace_back(std::chrono::duration<double, std::milli>(end - start).count());
+      const std::vector<f3d::scene::load_statistics_t> statistics = scene.getLoadStatistics();
+      result.Stages.emplace_back(
+        statistics.empty() ? f3d::scene::load_statistics_t() : statistics.back());
+      result.Allocations.emplace_back(static_cast<double>(allocations));
+    }
+  }
+  scene.clear();
+  result.PeakRSS = ::GetPeakRSS();
+  return true;
+}
+
+//----------------------------------------------------------------------------
+nlohmann::ordered_json ToJSON(const FileResult& result)
+{
+  std::vector<double> reader;
+  std::vector<double> postProcess;
+  std::vector<double> coloringInfo;
+  for (const f3d::scene::load_statistics_t& stages : result.Stages)
+  {
+    reader.emplace_back(stages.readerTime);
+    postProcess.emplace_back(stages.postProcessTime);
+    coloringInfo.emplace_back(stages.coloringInfoTime);
+  }
+
+  nlohmann::ordered_json json;
+  json["file"] = result.File;
+  json["wall_time_ms"] = {
+    { "min", *std::ranges::min_element(result.WallTimes) },
+    { "median", ::Median(result.WallTimes) },
+    { "max", *std::ranges::max_element(result.WallTimes) },
+  };
+  json["stages_ms"] = {
+    { "reader", ::Median(reader) },
+    { "post_process", ::Median(postProcess) },
+    { "coloring_info", ::Median(coloringInfo) },
+  };
+  json["allocations"] = static_cast<std::size_t>(::Median(result.Allocations));
+  json["peak_rss_kib"] = result.PeakRSS;
+  return json;
+}
+
+//----------------------------------------------------------------------------
+/**
+ * Replay the recording on the loaded file until the requested number of frames have been
+ * rendered and report the frame statistics. Returns an empty object on failure.
+ */
+nlohmann::ordered_json BenchmarkRender(f3d::engine& engine, const std::string& file,
+  const fs::path& path, const fs::path& recording, int frames, int warmup)
+{
+  f3d::scene& scene = engine.getScene();
+  f3d::window& window = engine.getWindow();
+  f3d::interactor& interactor = engine.getInteractor();
+
+  try
+  {
+    scene.clear();
+    scene.add(path);
+  }
+  catch (const f3d::scene::load_failure_exception& ex)
+  {
+    f3d::log::error("Cannot load ", path, ": ", ex.what());
+    return {};
+  }
+
+  // Replay the recording from the same camera each time
+  window.render();
+  const f3d::camera_state_t initialCamera = window.getCamera().getState();
+
+  std::vector<f3d::window::frame_statistics_t> statistics;
+  while (statistics.size() < static_cast<size_t>(warmup + frames))
+  {
+    window.getCamera().setState(initialCamera);
+    window.setCollectFrameStatistics(true);
+    if (!interactor.playInteraction(recording))
+    {
+      window.setCollectFrameStatistics(false);
+      return {};
+    }
+
+    const std::vector<f3d::window::frame_statistics_t> replayed = window.getFrameStatistics();
+    window.setCollectFrameStatistics(false);
+    if (replayed.empty())
+    {
+      f3d::log::error("The recording ", recording, " does not render any frame");
+      return {};
+    }
+    statistics.insert(statistics.end(), replayed.begin(), replayed.end());
+  }
+  statistics.erase(statistics.begin(), statistics.begin() + warmup);
+  statistics.resize(frames);
+
+  std::vector<double> cpuTimes;
+  std::vector<double> gpuTimes;
+  std::vector<std::string> passNames;
+  std::map<std::string, std::vector<double>> passTimes;
+  double gpuMemory = -1.0;
+  for (const f3d::window::frame_statistics_t& frame : statistics)
+  {
+    cpuTimes.emplace_back(frame.cpuTime);
+    if (frame.gpuTime >= 0)
+    {
+      gpuTimes.emplace_back(frame.gpuTime);
+    }
+    for (const auto& [name, time] : frame.passTimes)
+    {
+      if (passTimes.find(name) == passTimes.end())
+      {
+        passNames.emplace_back(name);
+      }
+      passTimes[name].emplace_back(time);
+    }
+    gpuMemory = std::max(gpuMemory, frame.gpuMemory);
+  }
+
+  nlohmann::ordered_json json;
+  json["file"] = file;
+  json["frames"] = frames;
+  json["cpu_frame_time_ms"] = ::Distribution(cpuTimes);
+  if (!gpuTimes.empty())
+  {
+    json["gpu_frame_time_ms"] = ::Distribution(gpuTimes);
+  }
+  if (!passNames.empty())
+  {
+    nlohmann::ordered_json passes;
+    for (const std::string& name : passNames)
+    {
+      passes[name] = ::Median(passTimes[name]);
+    }
+    json["passes_ms"] = passes;
+  }
+  if (gpuMemory >= 0)
+  {
+    json["gpu_memory_mib"] = gpuMemory;
+  }
+  return json;
+}
+
+//----------------------------------------------------------------------------
+/**
+ * Compare the median times and the allocation count of each file with the baseline,
+ * report the differences and return false if any of them is above the tolerance, in percent
+ */
+bool CompareWithBaseline(
+  const nlohmann::ordered_json& report, const nlohmann::json& baseline, double tolerance)
+{
+  bool passed = true;
+  for (const auto& current : report.at("files"))
+  {
+    const std::string file = current.at("file");
+    const nlohmann::json& baselineFiles = baseline.at("files");
+    const auto reference = std::find_if(baselineFiles.begin(), baselineFiles.end(),
+      [&](const nlohmann::json& entry) { return entry.at("file") == file; });
+    if (reference == baselineFiles.end())
+    {
+      f3d::log::warn(file, ": not in baseline");
+      continue;
+    }
+
+    auto compare = [&](const std::string& name, double value, double referenceValue)
+    {
+      const double change =
+        referenceValue > 0 ? (value - referenceValue) / referenceValue * 100.0 : 0.0;
+      const bool regressed = change > tolerance;
+      passed = passed && !regressed;
+      f3d::log::print(regressed ? f3d::log::VerboseLevel::ERROR : f3d::log::VerboseLevel::INFO,
+        file, ": ", name, " ", value, " (baseline ", referenceValue, ", ", change >= 0 ? "+" : "",
+        change, "%)", regressed ? " REGRESSION" : "");
+    };
+
+    // Only the metrics present in both reports are compared
+    const std::vector<std::pair<std::string, std::string>> metrics = {
+      { "median wall time (ms)", "/wall_time_ms/median" },
+      { "allocations", "/allocations" },
+      { "median CPU frame time (ms)", "/cpu_frame_time_ms/median" },
+      { "median GPU frame time (ms)", "/gpu_frame_time_ms/median" },
+    };
+    for (const auto& [name, pointer] : metrics)
+    {
+      const nlohmann::ordered_json::json_pointer currentPointer(pointer);
+      const nlohmann::json::json_pointer referencePointer(pointer);
+      if (current.contains(currentPointer) && reference->contains(referencePointer))
+      {
+        compare(name, current.at(currentPointer), reference->at(referencePointer));
+      }
+    }
+  }
+  return passed;
+}
+
+//----------------------------------------------------------------------------
+using PathResolver = std::function<fs::path(const std::string&)>;
+
+//----------------------------------------------------------------------------
+nlohmann::ordered_json RunLoadBenchmark(const std::vector<std::string>& files,
+  const PathResolver& resolvePath, int iterations, int warmup, bool& succeeded)
+{
+  f3d::engine engine = f3d::engine::createNone();
+  f3d::scene& scene = engine.getScene();
+
+  nlohmann::ordered_json report;
+  report["mode"] = "load";
+  report["iterations"] = iterations;
+  report["warmup"] = warmup;
+  report["files"] = nlohmann::ordered_json::array();
+  for (const std::string& file : files)
+  {
+    const fs::path path = resolvePath(file);
+    if (!scene.supports(path))
+    {
+      f3d::log::warn(file, ": no reader available, skipping");
+      continue;
+    }
+
+    FileResult result;
+    result.File = file;
+    if (!::Benchmark(scene, path, iterations, warmup, result))
+    {
+      succeeded = false;
+      continue;
+    }
+    report["files"].emplace_back(::ToJSON(result));
+  }
+  return report;
+}
+
+//----------------------------------------------------------------------------
+nlohmann::ordered_json RunRenderBenchmark(const cxxopts::ParseResult& args,
+  const std::vector<std::string>& files, const PathResolver& resolvePath, int frames, int warmup,
+  bool& succeeded)
+{
+  const std::string backend = args["backend"].as<std::string>();
+  const std::string resolution = args["resolution"].as<std::string>();
+  int width = 0;
+  int height = 0;
+  if (std::sscanf(resolution.c_str(), "%d,%d", &width, &height) != 2 || width <= 0 ||
+    height <= 0)
+  {
+    f3d::log::error("Invalid resolution: ", resolution);
+    return {};
+  }
+
+  try
+  {
+    // Offscreen windows are not synchronized with the display refresh rate
+    f3d::engine engine = backend == "egl" ? f3d::engine::createEGL()
+      : backend == "osmesa"               ? f3d::engine::createOSMesa()
+                                          : f3d::engine::create(true);
+    engine.getWindow().setSize(width, height);
+
+    f3d::options& options = engine.getOptions();
+    if (args.count("option"))
+    {
+      for (const std::string& option : args["option"].as<std::vector<std::string>>())
+      {
+        const size_t separator = option.find('=');
+        if (separator == std::string::npos)
+        {
+          f3d::log::error("Invalid option, expected name=value: ", option);
+          return {};
+        }
+        options.setAsString(option.substr(0, separator), option.substr(separator + 1));
+      }
+    }
+
+    const fs::path recording = resolvePath(args["recording"].as<std::string>());
+
+    nlohmann::ordered_json report;
+    report["mode"] = "render";
+    report["frames"] = frames;
+    report["warmup"] = warmup;
+    report["resolution"] = { width, height };
+    report["files"] = nlohmann::ordered_json::array();
+    for (const std::string& file : files)
+    {
+      const fs::path path = resolvePath(file);
+      if (!engine.getScene().supports(path))
+      {
+        f3d::log::warn(file, ": no reader available, skipping");
+        continue;
+      }
+
+      nlohmann::ordered_json result =
+        ::BenchmarkRender(engine, file, path, recording, frames, warmup);
+      if (result.empty())
+      {
+        succeeded = false;
+        continue;
+      }
+      report["files"].emplace_back(std::move(result));
+    }
+    return report;
+  }
+  catch (const f3d::exception& ex)
+  {
+    // Backend loading, window creation and option errors
+    f3d::log::error("Cannot run the render benchmark: ", ex.what());
+  }
+  return {};
+}
+}
+
+//----------------------------------------------------------------------------
+int main(int argc, char** argv)
+{
+  cxxopts::Options cxxOptions(
+    "f3d_benchmark", "Measure the time needed to load and render files with libf3d");
+  // clang-format off
+  cxxOptions.add_options()
+    ("i,iterations", "Number of measured loads per file", cxxopts::value<int>()->default_value("10"))
+    ("w,warmup", "Number of unmeasured loads or frames per file", cxxopts::value<int>()->default_value("1"))
+    ("r,recording", "Interaction recording to replay, measure rendering instead of loading", cxxopts::value<std::string>())
+    ("f,frames", "Number of measured frames per file when replaying a recording", cxxopts::value<int>()->default_value("100"))
+    ("backend", "Offscreen rendering backend when replaying a recording: auto, egl or osmesa", cxxopts::value<std::string>()->default_value("auto"))
+    ("resolution", "Resolution of the rendering when replaying a recording", cxxopts::value<std::string>()->default_value("1000,600"))
+    ("option", "libf3d option to set when replaying a recording, as name=value, can be repeated", cxxopts::value<std::vector<std::string>>())
+    ("d,data-dir", "Directory relative file paths are resolved from", cxxopts::value<std::string>()->default_value(""))
+    ("l,list", "File containing the files to load, one per line", cxxopts::value<std::string>())
+    ("o,output", "JSON report file, standard output if not set", cxxopts::value<std::string>())
+    ("b,baseline", "JSON report to compare with", cxxopts::value<std::string>())
+    ("t,tolerance", "Allowed increase over the baseline, in percent", cxxopts::value<double>()->default_value("10"))
+    ("files", "Files to load", cxxopts::value<std::vector<std::string>>())
+    ("h,help", "Print help");
+  // clang-format on
+  cxxOptions.parse_positional({ "files" });
+  cxxOptions.positional_help("[files...]");
+
+  cxxopts::ParseResult args;
+  try
+  {
+    args = cxxOptions.parse(argc, argv);
+  }
+  catch (const cxxopts::exceptions::exception& ex)
+  {
+    f3d::log::error(ex.what());
+    return EXIT_FAILURE;
+  }
+
+  if (args.count("help"))
+  {
+    std::cout << cxxOptions.help() << std::endl;
+    return EXIT_SUCCESS;
+  }
+
+  std::vector<std::string> files;
+  if (args.count("list"))
+  {
+    files = ::ReadFileList(args["list"].as<std::string>());
+  }
+  if (args.count("files"))
+  {
+    const auto& positional = args["files"].as<std::vector<std::string>>();
+    files.insert(files.end(), positional.begin(), positional.end());
+  }
+
+  const int iterations = args["iterations"].as<int>();
+  const int warmup = args["warmup"].as<int>();
+  const int frames = args["frames"].as<int>();
+  if (files.empty() || iterations < 1 || warmup < 0 || frames < 1)
+  {
+    std::cerr << cxxOptions.help() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  f3d::log::setVerboseLevel(f3d::log::VerboseLevel::WARN);
+  f3d::engine::autoloadPlugins();
+
+  const fs::path dataDir = args["data-dir"].as<std::string>();
+  auto resolvePath = [&](const std::string& file)
+  { return fs::path(file).is_absolute() ? fs::path(file) : dataDir / file; };
+
+  nlohmann::ordered_json report;
+  bool succeeded = true;
+  if (args.count("recording"))
+  {
+    report = ::RunRenderBenchmark(args, files, resolvePath, frames, warmup, succeeded);
+  }
+  else
+  {
+    report = ::RunLoadBenchmark(files, resolvePath, iterations, warmup, succeeded);
+  }
+  if (report.is_null())
+  {
+    return EXIT_FAILURE;
+  }
+
+  if (args.count("output"))
+  {
+    std::ofstream(args["output"].as<std::string>()) << report.dump(2) << std::endl;
+  }
+  else
+  {
+    std::cout << report.dump(2) << std::endl;
+  }
+
+  if (args.count("baseline"))
+  {
+    f3d::log::setVerboseLevel(f3d::log::VerboseLevel::INFO, true);
+    try
+    {
+      const nlohmann::json baseline =
+        nlohmann::json::parse(std::ifstream(args["baseline"].as<std::string>()));
+      if (!::CompareWithBaseline(report, baseline, args["tolerance"].as<double>()))
+      {
+        return EXIT_FAILURE;
+      }
+    }
+    catch (const nlohmann::json::exception& ex)
+    {
+      f3d::log::error("Cannot read baseline: ", ex.what());
+      return EXIT_FAILURE;
+    }
+  }
+
+  return succeeded ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,136 @@
+#include <vtkFieldData.h>
+#include <vtkImageData.h>
+#include <vtkMemoryResourceStream.h>
+#include <vtkNew.h>
+#include <vtkPointData.h>
+#include <vtkVersion.h>
+
+#include "vtkF3DKTXReader.h"
+
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace
+{
+bool CheckImage(vtkImageData* img)
+{
+  const int* dims = img->GetDimensions();
+  if (dims[0] != 2 || dims[1] != 2 || img->GetNumberOfScalarComponents() != 4)
+  {
+    std::cerr << "Incorrect KTX2 image size " << dims[0] << ":" << dims[1] << "\n";
+    return false;
+  }
+
+  // VTK images start with the bottom row
+  if (img->GetScalarComponentAsDouble(0, 0, 0, 2) != 255 ||
+    img->GetScalarComponentAsDouble(0, 1, 0, 0) != 255)
+  {
+    std::cerr << "Incorrect KTX2 image orientation\n";
+    return false;
+  }
+
+  return true;
+}
+}
+
+int TestF3DKTXReader(int argc, char* argv[])
+{
+  // uncompressed 2x2 R8G8B8A8_UNORM texture with a red top row and a blue bottom row
+  std::string filename = std::string(argv[1]) + "data/TestF3DKTXReader.ktx2";
+
+  vtkNew<vtkF3DKTXReader> reader;
+  if (reader->CanReadFile(filename.c_str()) == 0)
+  {
+    std::cerr << "Unexpected CanReadFile failure.\n";
+    return EXIT_FAILURE;
+  }
+
+  reader->SetFileName(filename.c_str());
+  reader->Update();
+
+  std::cout << "Reader Name: " << reader->GetDescriptiveName() << '\n';
+
+  if (!::CheckImage(reader->GetOutput()))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // read from memory
+  std::ifstream file(filename, std::ios::binary);
+  const std::vector<char> buff(
+    (std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+  vtkNew<vtkF3DKTXReader> memReader;
+#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 5, 20251016)
+  vtkNew<vtkMemoryResourceStream> stream;
+  stream->SetBuffer(buff.data(), buff.size());
+  memReader->SetStream(stream);
+#else
+  memReader->SetMemoryBuffer(buff.data());
+  memReader->SetMemoryBufferLength(buff.size());
+#endif
+  memReader->Update();
+
+  if (!::CheckImage(memReader->GetOutput()))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // UASTC texture stored from bottom to top, transcoded to RGBA
+  filename = std::string(argv[1]) + "data/checker_uastc.ktx2";
+  vtkNew<vtkF3DKTXReader> uastcReader;
+  uastcReader->SetFileName(filename.c_str());
+  uastcReader->DeferTranscodingOff();
+  uastcReader->Update();
+  vtkImageData* uastc = uastcReader->GetOutput();
+  const int* dims = uastc->GetDimensions();
+  if (dims[0] != 8 || dims[1] != 8 || uastc->GetScalarComponentAsDouble(0, 0, 0, 2) != 255 ||
+    uastc->GetScalarComponentAsDouble(0, 7, 0, 0) != 255)
+  {
+    std::cerr << "Incorrect UASTC image\n";
+    return EXIT_FAILURE;
+  }
+  if (!uastc->GetFieldData()->GetAbstractArray("KTX2"))
+  {
+    std::cerr << "KTX2 content is not provided\n";
+    return EXIT_FAILURE;
+  }
+
+  // Same texture stored from top to bottom, transcoded when needed
+  filename = std::string(argv[1]) + "data/checker_uastc_ydown.ktx2";
+  vtkNew<vtkF3DKTXReader> deferredReader;
+  deferredReader->SetFileName(filename.c_str());
+  deferredReader->Update();
+  vtkImageData* deferred = deferredReader->GetOutput();
+  if (std::string(deferred->GetPointData()->GetScalars()->GetName()) != "KTX2Deferred")
+  {
+    std::cerr << "UASTC transcoding is not deferred\n";
+    return EXIT_FAILURE;
+  }
+  if (!vtkF3DKTXReader::TranscodeDeferred(deferred) ||
+    deferred->GetScalarComponentAsDouble(0, 7, 0, 2) != 255 ||
+    deferred->GetScalarComponentAsDouble(0, 0, 0, 0) != 255)
+  {
+    std::cerr << "Incorrect deferred UASTC image\n";
+    return EXIT_FAILURE;
+  }
+
+  // check failures
+  filename = std::string(argv[1]) + "data/invalid.png";
+  if (reader->CanReadFile(filename.c_str()) != 0)
+  {
+    std::cerr << "Unexpected CanReadFile success.\n";
+    return EXIT_FAILURE;
+  }
+  reader->SetFileName(filename.c_str());
+  reader->Update();
+
+  // Do not create a dummy.ktx2
+  filename = std::string(argv[1]) + "data/dummy.ktx2";
+  reader->CanReadFile(filename.c_str());
+
+  return EXIT_SUCCESS;
+}
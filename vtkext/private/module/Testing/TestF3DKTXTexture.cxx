@@ -0,0 +1,147 @@
+#include <vtkActor.h>
+#include <vtkCamera.h>
+#include <vtkImageData.h>
+#include <vtkNew.h>
+#include <vtkPNGReader.h>
+#include <vtkPlaneSource.h>
+#include <vtkProperty.h>
+#include <vtkRenderWindow.h>
+#include <vtkRenderer.h>
+#include <vtkWindowToImageFilter.h>
+#include <vtksys/Directory.hxx>
+#include <vtksys/SystemTools.hxx>
+
+#include "vtkF3DKTXReader.h"
+#include "vtkF3DKTXTexture.h"
+#include "vtkF3DPolyDataMapper.h"
+#include "vtkF3DRenderer.h"
+
+#include <iostream>
+#include <string>
+
+namespace
+{
+/**
+ * Render a plane textured with the given image and return the color at the given height
+ */
+bool CheckColor(vtkImageData* image, int y, int component)
+{
+  vtkNew<vtkF3DKTXTexture> texture;
+  texture->SetInputData(image);
+  texture->InterpolateOff();
+
+  vtkNew<vtkPlaneSource> plane;
+  vtkNew<vtkF3DPolyDataMapper> mapper;
+  mapper->SetInputConnection(plane->GetOutputPort());
+
+  vtkNew<vtkActor> actor;
+  actor->SetMapper(mapper);
+  actor->SetTexture(texture);
+  actor->GetProperty()->LightingOff();
+
+  vtkNew<vtkRenderer> renderer;
+  renderer->AddActor(actor);
+  vtkCamera* camera = renderer->GetActiveCamera();
+  camera->ParallelProjectionOn();
+  camera->SetParallelScale(0.5);
+  camera->SetFocalPoint(0.0, 0.0, 0.0);
+  camera->SetPosition(0.0, 0.0, 1.0);
+
+  vtkNew<vtkRenderWindow> renWin;
+  renWin->SetSize(100, 100);
+  renWin->OffScreenRenderingOn();
+  renWin->AddRenderer(renderer);
+  renWin->Render();
+
+  std::cout << "Compressed upload: " << texture->IsCompressed() << "\n";
+
+  vtkNew<vtkWindowToImageFilter> w2i;
+  w2i->SetInput(renWin);
+  w2i->Update();
+
+  const unsigned char* pixel =
+    static_cast<unsigned char*>(w2i->GetOutput()->GetScalarPointer(50, y, 0));
+  if (pixel[component] < 200)
+  {
+    std::cerr << "Unexpected color at height " << y << "\n";
+    return false;
+  }
+  return true;
+}
+}
+
+int TestF3DKTXTexture(int, char* argv[])
+{
+  // UASTC texture with levels, blue at the bottom and red at the top
+  vtkNew<vtkF3DKTXReader> reader;
+  reader->SetFileName((std::string(argv[1]) + "data/checker_uastc.ktx2").c_str());
+  reader->Update();
+  if (!::CheckColor(reader->GetOutput(), 25, 2) || !::CheckColor(reader->GetOutput(), 75, 0))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Same texture stored from top to bottom, uploaded as is and sampled upside down
+  vtkNew<vtkF3DKTXReader> upsideDownReader;
+  upsideDownReader->SetFileName((std::string(argv[1]) + "data/checker_uastc_ydown.ktx2").c_str());
+  upsideDownReader->Update();
+  if (!::CheckColor(upsideDownReader->GetOutput(), 75, 2) ||
+    !::CheckColor(upsideDownReader->GetOutput(), 25, 0))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Other images are encoded in the texture cache
+  const std::string cachePath = std::string(argv[2]) + "/TestF3DKTXTextureCache";
+  vtksys::SystemTools::RemoveADirectory(cachePath);
+
+  vtkNew<vtkPNGReader> pngReader;
+  pngReader->SetFileName((std::string(argv[1]) + "data/TestF3DImageImporterTiled.png").c_str());
+  pngReader->Update();
+
+  vtkNew<vtkF3DRenderer> renderer;
+  renderer->SetCachePath(cachePath);
+  renderer->SetUseTextureCache(true);
+
+  vtkNew<vtkRenderWindow> renWin;
+  renWin->SetSize(10, 10);
+  renWin->OffScreenRenderingOn();
+  renWin->AddRenderer(renderer);
+  renWin->Initialize();
+  renWin->MakeCurrent();
+
+  // The image is uploaded uncompressed while being encoded in the background
+  vtkNew<vtkF3DKTXTexture> texture;
+  texture->SetInputData(pngReader->GetOutput());
+  texture->Load(renderer);
+  texture->PostRender(renderer);
+  if (texture->IsCompressed())
+  {
+    std::cerr << "The texture was uploaded compressed before being encoded\n";
+    return EXIT_FAILURE;
+  }
+  texture->WaitForCacheEncoding();
+
+  vtksys::Directory directory;
+  if (!directory.Load(cachePath + "/textures") || directory.GetNumberOfFiles() != 3)
+  {
+    std::cerr << "The texture was not stored in the cache\n";
+    return EXIT_FAILURE;
+  }
+
+  // The encoded texture is uploaded on next load
+  texture->Load(renderer);
+  texture->PostRender(renderer);
+  std::cout << "Compressed upload once encoded: " << texture->IsCompressed() << "\n";
+
+  // The cached texture is read back by another texture
+  vtkNew<vtkF3DKTXTexture> cachedTexture;
+  cachedTexture->SetInputData(pngReader->GetOutput());
+  cachedTexture->Load(renderer);
+  cachedTexture->PostRender(renderer);
+  std::cout << "Compressed upload from the cache: " << cachedTexture->IsCompressed() << "\n";
+
+  texture->ReleaseGraphicsResources(renWin);
+  cachedTexture->ReleaseGraphicsResources(renWin);
+  return EXIT_SUCCESS;
+}
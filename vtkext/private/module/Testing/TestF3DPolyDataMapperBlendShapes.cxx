@@ -0,0 +1,149 @@
+#include <vtkActor.h>
+#include <vtkCamera.h>
+#include <vtkCellArray.h>
+#include <vtkFieldData.h>
+#include <vtkFloatArray.h>
+#include <vtkImageData.h>
+#include <vtkNew.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+#include <vtkProperty.h>
+#include <vtkRenderWindow.h>
+#include <vtkRenderer.h>
+#include <vtkShaderProperty.h>
+#include <vtkUniforms.h>
+#include <vtkWindowToImageFilter.h>
+
+#include "vtkF3DPolyDataMapper.h"
+#include "vtkF3DRenderPass.h"
+
+#include <iostream>
+#include <vector>
+
+namespace
+{
+constexpr int NB_SUB_SHAPES = 300;
+
+/**
+ * Create a unit quad with many sparse blend shapes, the last one moves the quad by 10 along X
+ */
+vtkSmartPointer<vtkPolyData> CreateQuad()
+{
+  vtkNew<vtkPoints> points;
+  points->InsertNextPoint(0.0, 0.0, 0.0);
+  points->InsertNextPoint(1.0, 0.0, 0.0);
+  points->InsertNextPoint(1.0, 1.0, 0.0);
+  points->InsertNextPoint(0.0, 1.0, 0.0);
+
+  vtkNew<vtkCellArray> polys;
+  vtkIdType quad[4] = { 0, 1, 2, 3 };
+  polys->InsertNextCell(4, quad);
+
+  vtkNew<vtkFloatArray> offsets;
+  offsets->SetName("BlendShapeOffsets");
+  offsets->SetNumberOfComponents(4);
+
+  vtkNew<vtkFloatArray> ranges;
+  ranges->SetName("BlendShapeRanges");
+  ranges->SetNumberOfComponents(2);
+
+  // each point is moved along Z by a quarter of the sub-shapes
+  for (int point = 0; point < 4; point++)
+  {
+    const float first = static_cast<float>(offsets->GetNumberOfTuples());
+    for (int sub = point; sub < NB_SUB_SHAPES - 1; sub += 4)
+    {
+      offsets->InsertNextTuple4(sub, 0.f, 0.f, 1e-3f);
+    }
+    offsets->InsertNextTuple4(NB_SUB_SHAPES - 1, 10.f, 0.f, 0.f);
+    ranges->InsertNextTuple2(first, offsets->GetNumberOfTuples() - first);
+  }
+
+  vtkNew<vtkPolyData> polyData;
+  polyData->SetPoints(points);
+  polyData->SetPolys(polys);
+  polyData->GetFieldData()->AddArray(offsets);
+  polyData->GetFieldData()->AddArray(ranges);
+  return polyData;
+}
+
+/**
+ * Render the quad looking at where the last blend shape moves it and check it is visible
+ */
+bool CheckMovedQuad(vtkIdType maximumSize)
+{
+  vtkSmartPointer<vtkPolyData> polyData = ::CreateQuad();
+
+  vtkNew<vtkF3DPolyDataMapper> mapper;
+  mapper->SetInputData(polyData);
+  mapper->SetMaximumBlendShapeOffsetsSize(maximumSize);
+
+  vtkNew<vtkActor> actor;
+  actor->SetMapper(mapper);
+  actor->GetProperty()->LightingOff();
+  actor->GetProperty()->SetColor(1.0, 1.0, 1.0);
+
+  std::vector<float> weights(NB_SUB_SHAPES, 1.f);
+  actor->GetShaderProperty()->GetVertexCustomUniforms()->SetUniform4fv(
+    "blendShapeWeights", NB_SUB_SHAPES / 4, weights.data());
+
+  vtkNew<vtkF3DRenderPass> pass;
+  vtkNew<vtkRenderer> renderer;
+  renderer->SetPass(pass);
+  renderer->AddActor(actor);
+
+  vtkCamera* camera = renderer->GetActiveCamera();
+  camera->ParallelProjectionOn();
+  camera->SetParallelScale(1.0);
+  camera->SetFocalPoint(10.5, 0.5, 0.0);
+  camera->SetPosition(10.5, 0.5, 10.0);
+  camera->SetClippingRange(1.0, 100.0);
+
+  vtkNew<vtkRenderWindow> renWin;
+  renWin->SetSize(100, 100);
+  renWin->OffScreenRenderingOn();
+  renWin->AddRenderer(renderer);
+  renWin->Render();
+
+  vtkNew<vtkWindowToImageFilter> w2i;
+  w2i->SetInput(renWin);
+  w2i->Update();
+
+  const unsigned char* center =
+    static_cast<unsigned char*>(w2i->GetOutput()->GetScalarPointer(50, 50, 0));
+  if (center[0] < 128)
+  {
+    std::cerr << "The quad is not moved by the blend shapes, maximum size " << maximumSize
+              << "\n";
+    return false;
+  }
+
+  // the input is never modified
+  double point[3];
+  polyData->GetPoint(0, point);
+  if (point[0] != 0.0 || point[2] != 0.0)
+  {
+    std::cerr << "The input points are modified\n";
+    return false;
+  }
+
+  return true;
+}
+}
+
+int TestF3DPolyDataMapperBlendShapes(int, char*[])
+{
+  // offsets stored in a texture buffer
+  if (!::CheckMovedQuad(0))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // offsets larger than the texture buffer, applied on the CPU
+  if (!::CheckMovedQuad(16))
+  {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
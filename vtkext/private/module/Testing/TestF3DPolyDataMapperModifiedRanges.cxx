@@ -0,0 +1,167 @@
+#include <vtkActor.h>
+#include <vtkCamera.h>
+#include <vtkCellArray.h>
+#include <vtkFloatArray.h>
+#include <vtkImageData.h>
+#include <vtkNew.h>
+#include <vtkObjectFactory.h>
+#include <vtkPoints.h>
+#include <vtkPolyData.h>
+#include <vtkProperty.h>
+#include <vtkRenderWindow.h>
+#include <vtkRenderer.h>
+#include <vtkWindowToImageFilter.h>
+
+#include "vtkF3DMemoryMesh.h"
+#include "vtkF3DPolyDataMapper.h"
+
+#include <iostream>
+
+namespace
+{
+/**
+ * Mapper counting the full builds of the buffer objects
+ */
+class vtkCountingMapper : public vtkF3DPolyDataMapper
+{
+public:
+  static vtkCountingMapper* New();
+  vtkTypeMacro(vtkCountingMapper, vtkF3DPolyDataMapper);
+
+  int NumberOfBuilds = 0;
+
+protected:
+  void BuildBufferObjects(vtkRenderer* ren, vtkActor* act) override
+  {
+    this->NumberOfBuilds++;
+    this->Superclass::BuildBufferObjects(ren, act);
+  }
+};
+vtkStandardNewMacro(vtkCountingMapper);
+
+/**
+ * Check if the pixel at the given position is covered by the white quads
+ */
+bool IsCovered(vtkRenderWindow* renWin, int x)
+{
+  vtkNew<vtkWindowToImageFilter> w2i;
+  w2i->SetInput(renWin);
+  w2i->Update();
+
+  const unsigned char* pixel =
+    static_cast<unsigned char*>(w2i->GetOutput()->GetScalarPointer(x, 50, 0));
+  return pixel[0] > 128;
+}
+
+/**
+ * Move the right quad along Y in place
+ */
+void MoveRightQuad(vtkFloatArray* points, float y)
+{
+  for (vtkIdType i = 4; i < 8; i++)
+  {
+    points->SetTypedComponent(i, 1, points->GetTypedComponent(i, 1) + y);
+  }
+}
+}
+
+int TestF3DPolyDataMapperModifiedRanges(int, char*[])
+{
+  // two quads side by side
+  vtkNew<vtkFloatArray> pointsArray;
+  pointsArray->SetNumberOfComponents(3);
+  for (float x : { -1.f, 0.1f })
+  {
+    pointsArray->InsertNextTuple3(x, -0.5f, 0.f);
+    pointsArray->InsertNextTuple3(x + 0.9f, -0.5f, 0.f);
+    pointsArray->InsertNextTuple3(x + 0.9f, 0.5f, 0.f);
+    pointsArray->InsertNextTuple3(x, 0.5f, 0.f);
+  }
+  vtkNew<vtkPoints> points;
+  points->SetData(pointsArray);
+
+  vtkNew<vtkCellArray> polys;
+  vtkIdType left[4] = { 0, 1, 2, 3 };
+  vtkIdType right[4] = { 4, 5, 6, 7 };
+  polys->InsertNextCell(4, left);
+  polys->InsertNextCell(4, right);
+
+  vtkNew<vtkPolyData> polyData;
+  polyData->SetPoints(points);
+  polyData->SetPolys(polys);
+
+  vtkNew<vtkCountingMapper> mapper;
+  mapper->SetInputData(polyData);
+
+  vtkNew<vtkActor> actor;
+  actor->SetMapper(mapper);
+  actor->GetProperty()->LightingOff();
+  actor->GetProperty()->SetColor(1.0, 1.0, 1.0);
+
+  vtkNew<vtkRenderer> renderer;
+  renderer->AddActor(actor);
+  vtkCamera* camera = renderer->GetActiveCamera();
+  camera->ParallelProjectionOn();
+  camera->SetParallelScale(1.0);
+  camera->SetFocalPoint(0.0, 0.0, 0.0);
+  camera->SetPosition(0.0, 0.0, 10.0);
+  camera->SetClippingRange(1.0, 100.0);
+  renderer->ResetCameraClippingRangeOff();
+
+  vtkNew<vtkRenderWindow> renWin;
+  renWin->SetSize(100, 100);
+  renWin->OffScreenRenderingOn();
+  renWin->AddRenderer(renderer);
+  renWin->Render();
+
+  if (mapper->NumberOfBuilds != 1 || !::IsCovered(renWin, 25) || !::IsCovered(renWin, 75))
+  {
+    std::cerr << "Unexpected initial rendering\n";
+    return EXIT_FAILURE;
+  }
+
+  // only the logged range of the right quad is uploaded
+  ::MoveRightQuad(pointsArray, 10.f);
+  vtkF3DMemoryMesh::MarkModifiedRanges(pointsArray, { { 4, 8 } });
+  renWin->Render();
+
+  if (mapper->NumberOfBuilds != 1)
+  {
+    std::cerr << "The buffer objects were rebuilt for a modified range\n";
+    return EXIT_FAILURE;
+  }
+  if (!::IsCovered(renWin, 25) || ::IsCovered(renWin, 75))
+  {
+    std::cerr << "The modified range is not rendered\n";
+    return EXIT_FAILURE;
+  }
+
+  // an array modified without logging the ranges falls back to a full build
+  ::MoveRightQuad(pointsArray, -10.f);
+  pointsArray->Modified();
+  renWin->Render();
+
+  if (mapper->NumberOfBuilds != 2)
+  {
+    std::cerr << "The buffer objects were not rebuilt for an unlogged modification\n";
+    return EXIT_FAILURE;
+  }
+  if (!::IsCovered(renWin, 25) || !::IsCovered(renWin, 75))
+  {
+    std::cerr << "The full rebuild is not rendered\n";
+    return EXIT_FAILURE;
+  }
+
+  // most of the array being modified also falls back to a full build
+  ::MoveRightQuad(pointsArray, 10.f);
+  vtkF3DMemoryMesh::MarkModifiedRanges(pointsArray, { { 0, 8 } });
+  renWin->Render();
+
+  if (mapper->NumberOfBuilds != 3 || !::IsCovered(renWin, 25) || ::IsCovered(renWin, 75))
+  {
+    std::cerr << "The whole modified array is not rebuilt\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -3,6 +3,7 @@
 #include <vtkRenderer.h>
 #include <vtkTestUtilities.h>
 
+#include "vtkF3DCullingPass.h"
 #include "vtkF3DHexagonalBokehBlurPass.h"
 #include "vtkF3DRenderPass.h"
 #include "vtkF3DTAAPass.h"
@@ -13,8 +14,12 @@
 int TestF3DRenderPass(int argc, char* argv[])
 {
   vtkNew<vtkF3DRenderPass> pass;
+  pass->SetUseCulling(true);
   pass->Print(std::cout);
 
+  vtkNew<vtkF3DCullingPass> culling;
+  culling->Print(std::cout);
+
   vtkNew<vtkF3DTAAPass> taaP;
   taaP->SetDelegatePass(pass);
   taaP->Print(std::cout);
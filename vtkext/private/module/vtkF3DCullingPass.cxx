@@ -0,0 +1,375 @@
+#include "vtkF3DCullingPass.h"
+
+#include "vtkF3DOpenGLGridMapper.h"
+#include "vtkF3DPointSplatMapper.h"
+
+#include <vtkActor.h>
+#include <vtkBoundingBox.h>
+#include <vtkCamera.h>
+#include <vtkMatrix3x3.h>
+#include <vtkMatrix4x4.h>
+#include <vtkObjectFactory.h>
+#include <vtkOpenGLCamera.h>
+#include <vtkOpenGLRenderWindow.h>
+#include <vtkOpenGLRenderer.h>
+#include <vtkOpenGLShaderCache.h>
+#include <vtkOpenGLState.h>
+#include <vtkPolyDataMapper.h>
+#include <vtkPropCollection.h>
+#include <vtkProperty.h>
+#include <vtkRenderState.h>
+#include <vtkShaderProgram.h>
+#include <vtkShaderProperty.h>
+#include <vtkUniforms.h>
+#include <vtk_glad.h>
+
+#include <string>
+#include <unordered_set>
+
+vtkStandardNewMacro(vtkF3DCullingPass);
+
+namespace
+{
+//----------------------------------------------------------------------------
+// Get the bounds of a prop which can be culled, slightly inflated so flat props are not hidden
+// by their own geometry. Return false if the prop is not culled.
+bool GetCullingBounds(vtkProp* prop, vtkBoundingBox& bbox)
+{
+  vtkActor* actor = vtkActor::SafeDownCast(prop);
+  if (!actor || vtkF3DOpenGLGridMapper::SafeDownCast(actor->GetMapper()))
+  {
+    return false;
+  }
+
+  // skinning and morphing move the points outside of the bounds
+  vtkUniforms* uniforms = actor->GetShaderProperty()->GetVertexCustomUniforms();
+  for (const char* name : { "jointMatrices", "morphWeights", "blendShapeWeights" })
+  {
+    if (uniforms->GetUniformTupleType(name) != vtkUniforms::TupleTypeInvalid)
+    {
+      return false;
+    }
+  }
+
+  const double* bounds = actor->GetBounds();
+  if (!bounds)
+  {
+    return false;
+  }
+
+  bbox.SetBounds(bounds);
+  if (!bbox.IsValid() || bbox.GetDiagonalLength() <= 0.0)
+  {
+    return false;
+  }
+
+  bbox.Inflate(0.01 * bbox.GetDiagonalLength());
+  return true;
+}
+
+//----------------------------------------------------------------------------
+// Test if the box is on the inner side of the plane, fully or partially
+bool IsInside(const double plane[4], const double bounds[6], bool fully)
+{
+  // use the corner the farthest from the plane on the outer side to test if fully inside,
+  // the farthest on the inner side otherwise
+  double distance = plane[3];
+  for (int i = 0; i < 3; i++)
+  {
+    const bool max = (plane[i] > 0) != fully;
+    distance += plane[i] * bounds[2 * i + (max ? 1 : 0)];
+  }
+  return distance >= 0;
+}
+
+//----------------------------------------------------------------------------
+// Triangles of a box indexed by corner, the corner bits being the min/max of x, y and z
+constexpr unsigned int BoxTriangles[36] = { 0, 2, 6, 0, 6, 4, 1, 5, 7, 1, 7, 3, 0, 4, 5, 0, 5, 1,
+  2, 3, 7, 2, 7, 6, 0, 1, 3, 0, 3, 2, 4, 6, 7, 4, 7, 5 };
+}
+
+//----------------------------------------------------------------------------
+vtkF3DCullingPass::vtkF3DCullingPass() = default;
+
+//----------------------------------------------------------------------------
+vtkF3DCullingPass::~vtkF3DCullingPass() = default;
+
+//----------------------------------------------------------------------------
+void vtkF3DCullingPass::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfFrustumCulledProps: " << this->NumberOfFrustumCulledProps << "\n";
+  os << indent << "NumberOfOcclusionCulledProps: " << this->NumberOfOcclusionCulledProps << "\n";
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DCullingPass::ReleaseGraphicsResources(vtkWindow* w)
+{
+  this->Superclass::ReleaseGraphicsResources(w);
+
+#if !defined(__ANDROID__) && !defined(__EMSCRIPTEN__)
+  if (!this->Queries.empty())
+  {
+    glDeleteQueries(static_cast<GLsizei>(this->Queries.size()), this->Queries.data());
+    this->Queries.clear();
+  }
+#endif
+  this->QueriedProps.clear();
+  this->QueriedPropsCulled.clear();
+  this->OcclusionCandidates.clear();
+  this->OcclusionCandidatesCulled.clear();
+
+  this->BoxesBuffer->ReleaseGraphicsResources();
+  this->IndicesBuffer->ReleaseGraphicsResources();
+  this->VAO->ReleaseGraphicsResources();
+  this->Program = nullptr;
+  this->NumberOfIndexedBoxes = 0;
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DCullingPass::Cull(
+  vtkRenderer* ren, const std::vector<vtkProp*>& props, std::vector<vtkProp*>& visibleProps)
+{
+  visibleProps.clear();
+  this->NumberOfFrustumCulledProps = 0;
+  this->NumberOfOcclusionCulledProps = 0;
+  this->OcclusionCandidates.clear();
+  this->OcclusionBoxes.clear();
+  this->OcclusionCandidatesCulled.clear();
+
+  // props added or removed since the previous frame invalidate its queries,
+  // as a new prop can be allocated at the address of a removed one
+  const vtkMTimeType viewPropsMTime = ren->GetViewProps()->GetMTime();
+  if (viewPropsMTime != this->ViewPropsMTime)
+  {
+    this->QueriedProps.clear();
+    this->ViewPropsMTime = viewPropsMTime;
+  }
+
+  // recover the props hidden during the previous frame, without waiting for the GPU
+  std::unordered_set<vtkProp*> occludedProps;
+#if !defined(__ANDROID__) && !defined(__EMSCRIPTEN__)
+  for (size_t i = 0; i < this->QueriedProps.size(); i++)
+  {
+    GLuint available = GL_FALSE;
+    glGetQueryObjectuiv(this->Queries[i], GL_QUERY_RESULT_AVAILABLE, &available);
+    if (available)
+    {
+      GLuint samples = 0;
+      glGetQueryObjectuiv(this->Queries[i], GL_QUERY_RESULT, &samples);
+      if (samples == 0)
+      {
+        occludedProps.insert(this->QueriedProps[i]);
+      }
+    }
+  }
+#endif
+  this->QueriedProps.clear();
+  this->QueriedPropsCulled.clear();
+
+  // planes are ordered left, right, bottom, top, near, far with inward normals
+  double planes[24];
+  ren->GetActiveCamera()->GetFrustumPlanes(ren->GetTiledAspectRatio(), planes);
+
+  for (vtkProp* prop : props)
+  {
+    vtkBoundingBox bbox;
+    if (!::GetCullingBounds(prop, bbox))
+    {
+      visibleProps.emplace_back(prop);
+      continue;
+    }
+
+    double bounds[6];
+    bbox.GetBounds(bounds);
+
+    bool inFrustum = true;
+    for (int i = 0; i < 6 && inFrustum; i++)
+    {
+      inFrustum = ::IsInside(planes + 4 * i, bounds, false);
+    }
+    if (!inFrustum)
+    {
+      this->NumberOfFrustumCulledProps++;
+      continue;
+    }
+
+    // a box crossing the near plane may have no fragment left while the prop is visible,
+    // and only surfaces are known to be inside their bounds on screen
+    vtkActor* actor = vtkActor::SafeDownCast(prop);
+    if (!::IsInside(planes + 16, bounds, true) ||
+      actor->GetProperty()->GetRepresentation() != VTK_SURFACE ||
+      !vtkPolyDataMapper::SafeDownCast(actor->GetMapper()) ||
+      vtkF3DPointSplatMapper::SafeDownCast(actor->GetMapper()))
+    {
+      visibleProps.emplace_back(prop);
+      continue;
+    }
+
+    // occluded props are still tested to know when they are visible again
+    this->OcclusionCandidates.emplace_back(prop);
+    for (int corner = 0; corner < 8; corner++)
+    {
+      this->OcclusionBoxes.emplace_back(static_cast<float>(bounds[corner & 1]));
+      this->OcclusionBoxes.emplace_back(static_cast<float>(bounds[2 + ((corner >> 1) & 1)]));
+      this->OcclusionBoxes.emplace_back(static_cast<float>(bounds[4 + ((corner >> 2) & 1)]));
+    }
+
+    const bool culled = occludedProps.count(prop) > 0;
+    this->OcclusionCandidatesCulled.emplace_back(culled);
+    if (culled)
+    {
+      this->NumberOfOcclusionCulledProps++;
+    }
+    else
+    {
+      visibleProps.emplace_back(prop);
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DCullingPass::HasDisoccludedProps([[maybe_unused]] bool wait)
+{
+#if !defined(__ANDROID__) && !defined(__EMSCRIPTEN__)
+  for (size_t i = 0; i < this->QueriedProps.size(); i++)
+  {
+    if (!this->QueriedPropsCulled[i])
+    {
+      continue;
+    }
+
+    if (!wait)
+    {
+      GLuint available = GL_FALSE;
+      glGetQueryObjectuiv(this->Queries[i], GL_QUERY_RESULT_AVAILABLE, &available);
+      if (!available)
+      {
+        continue;
+      }
+    }
+
+    GLuint samples = 0;
+    glGetQueryObjectuiv(this->Queries[i], GL_QUERY_RESULT, &samples);
+    if (samples > 0)
+    {
+      return true;
+    }
+  }
+#endif
+  return false;
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DCullingPass::Render([[maybe_unused]] const vtkRenderState* s)
+{
+  this->NumberOfRenderedProps = 0;
+
+#if !defined(__ANDROID__) && !defined(__EMSCRIPTEN__)
+  if (this->OcclusionCandidates.empty())
+  {
+    return;
+  }
+
+  vtkOpenGLRenderer* ren = vtkOpenGLRenderer::SafeDownCast(s->GetRenderer());
+  vtkOpenGLRenderWindow* renWin = vtkOpenGLRenderWindow::SafeDownCast(ren->GetRenderWindow());
+  vtkOpenGLState* ostate = renWin->GetState();
+
+  if (!this->Program)
+  {
+    const std::string vertexShader = "//VTK::System::Dec\n"
+                                     "in vec4 vertexWC;\n"
+                                     "uniform mat4 WCDCMatrix;\n"
+                                     "void main()\n"
+                                     "{\n"
+                                     "  gl_Position = WCDCMatrix * vertexWC;\n"
+                                     "}\n";
+
+    const std::string fragmentShader = "//VTK::System::Dec\n"
+                                       "//VTK::Output::Dec\n"
+                                       "void main()\n"
+                                       "{\n"
+                                       "  gl_FragData[0] = vec4(1.0);\n"
+                                       "}\n";
+
+    this->Program = renWin->GetShaderCache()->ReadyShaderProgram(
+      vertexShader.c_str(), fragmentShader.c_str(), "");
+  }
+  else
+  {
+    renWin->GetShaderCache()->ReadyShaderProgram(this->Program);
+  }
+
+  if (!this->Program || !this->Program->GetCompiled())
+  {
+    vtkErrorMacro("Couldn't build the occlusion culling shader program.");
+    return;
+  }
+
+  // all the boxes are uploaded at once, indices only when more boxes are needed
+  const size_t nbBoxes = this->OcclusionCandidates.size();
+  this->BoxesBuffer->Upload(this->OcclusionBoxes, vtkOpenGLBufferObject::ArrayBuffer);
+
+  if (nbBoxes > this->NumberOfIndexedBoxes)
+  {
+    std::vector<unsigned int> indices(36 * nbBoxes);
+    for (size_t i = 0; i < indices.size(); i++)
+    {
+      indices[i] = static_cast<unsigned int>(8 * (i / 36)) + ::BoxTriangles[i % 36];
+    }
+    this->IndicesBuffer->Upload(indices, vtkOpenGLBufferObject::ElementArrayBuffer);
+    this->NumberOfIndexedBoxes = nbBoxes;
+  }
+
+  if (this->Queries.size() < nbBoxes)
+  {
+    const size_t first = this->Queries.size();
+    this->Queries.resize(nbBoxes);
+    glGenQueries(static_cast<GLsizei>(nbBoxes - first), this->Queries.data() + first);
+  }
+
+  this->VAO->Bind();
+  this->VAO->AddAttributeArray(
+    this->Program, this->BoxesBuffer, "vertexWC", 0, 3 * sizeof(float), VTK_FLOAT, 3, false);
+  this->IndicesBuffer->Bind();
+
+  vtkMatrix4x4* wcvc;
+  vtkMatrix3x3* norms;
+  vtkMatrix4x4* vcdc;
+  vtkMatrix4x4* wcdc;
+  vtkOpenGLCamera::SafeDownCast(ren->GetActiveCamera())
+    ->GetKeyMatrices(ren, wcvc, norms, vcdc, wcdc);
+  this->Program->SetUniformMatrix("WCDCMatrix", wcdc);
+
+  // test the boxes against the opaque depth without modifying any buffer
+  vtkOpenGLState::ScopedglEnableDisable bsaver(ostate, GL_BLEND);
+  vtkOpenGLState::ScopedglEnableDisable dsaver(ostate, GL_DEPTH_TEST);
+  vtkOpenGLState::ScopedglEnableDisable csaver(ostate, GL_CULL_FACE);
+  vtkOpenGLState::ScopedglColorMask colorMaskSaver(ostate);
+  vtkOpenGLState::ScopedglDepthMask depthMaskSaver(ostate);
+  vtkOpenGLState::ScopedglDepthFunc depthFuncSaver(ostate);
+
+  ostate->vtkglDisable(GL_BLEND);
+  ostate->vtkglDisable(GL_CULL_FACE);
+  ostate->vtkglEnable(GL_DEPTH_TEST);
+  ostate->vtkglDepthFunc(GL_LEQUAL);
+  ostate->vtkglColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+  ostate->vtkglDepthMask(GL_FALSE);
+
+  for (size_t i = 0; i < nbBoxes; i++)
+  {
+    glBeginQuery(GL_SAMPLES_PASSED, this->Queries[i]);
+    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT,
+      reinterpret_cast<const GLvoid*>(36 * i * sizeof(unsigned int)));
+    glEndQuery(GL_SAMPLES_PASSED);
+  }
+
+  this->IndicesBuffer->Release();
+  this->VAO->Release();
+
+  this->QueriedProps.swap(this->OcclusionCandidates);
+  this->QueriedPropsCulled.swap(this->OcclusionCandidatesCulled);
+  this->OcclusionCandidates.clear();
+  this->OcclusionCandidatesCulled.clear();
+#endif
+}
@@ -0,0 +1,98 @@
+/**
+ * @class   vtkF3DCullingPass
+ * @brief   Frustum and occlusion culling of the props of a render pass
+ *
+ * Cull removes from a list of props the ones whose bounds are outside the camera frustum
+ * and the ones whose bounds were hidden by the opaque geometry of the previous frame.
+ * Render is meant to be inserted right after the opaque pass. It uploads the bounds of the props
+ * inside the frustum to a single vertex buffer and draws each box in an occlusion query, without
+ * writing color or depth. The query results are read by the next Cull without waiting for the GPU,
+ * so a prop which becomes visible again is rendered one frame later, HasDisoccludedProps tells
+ * when the last frame misses such a prop so another one can be rendered.
+ * The query results are discarded when props are added to or removed from the renderer.
+ * Props deformed on the GPU (skinning, morphing) and props with invalid bounds are never culled.
+ * Occlusion culling is not supported on Android and Emscripten.
+ */
+
+#ifndef vtkF3DCullingPass_h
+#define vtkF3DCullingPass_h
+
+#include <vtkNew.h>
+#include <vtkOpenGLBufferObject.h>
+#include <vtkOpenGLRenderPass.h>
+#include <vtkOpenGLVertexArrayObject.h>
+
+#include <vector>
+
+class vtkRenderer;
+class vtkShaderProgram;
+
+class vtkF3DCullingPass : public vtkOpenGLRenderPass
+{
+public:
+  static vtkF3DCullingPass* New();
+  vtkTypeMacro(vtkF3DCullingPass, vtkOpenGLRenderPass);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Fill visibleProps with the props which are not culled, in the same order.
+   * The props inside the frustum are the ones tested by the next Render.
+   */
+  void Cull(vtkRenderer* ren, const std::vector<vtkProp*>& props,
+    std::vector<vtkProp*>& visibleProps);
+
+  /**
+   * Issue the occlusion queries of the props tested by the last Cull against the current depth
+   * buffer. Does nothing when called again without a Cull, like when baking reflections.
+   */
+  void Render(const vtkRenderState* s) override;
+
+  /**
+   * Return true if a prop occlusion culled by the last Cull is visible according to the query
+   * issued by the last Render, meaning the last frame misses it.
+   * When wait is false, only the query results already available are used.
+   */
+  bool HasDisoccludedProps(bool wait);
+
+  void ReleaseGraphicsResources(vtkWindow* w) override;
+
+  ///@{
+  /**
+   * Get the number of props culled by the last Cull because they were outside the frustum
+   * or occluded
+   */
+  vtkGetMacro(NumberOfFrustumCulledProps, int);
+  vtkGetMacro(NumberOfOcclusionCulledProps, int);
+  ///@}
+
+protected:
+  vtkF3DCullingPass();
+  ~vtkF3DCullingPass() override;
+
+private:
+  vtkF3DCullingPass(const vtkF3DCullingPass&) = delete;
+  void operator=(const vtkF3DCullingPass&) = delete;
+
+  int NumberOfFrustumCulledProps = 0;
+  int NumberOfOcclusionCulledProps = 0;
+
+  // props to query at the next Render with their inflated bounds, and if they are culled
+  std::vector<vtkProp*> OcclusionCandidates;
+  std::vector<float> OcclusionBoxes;
+  std::vector<bool> OcclusionCandidatesCulled;
+
+  // props queried by the last Render, with their queries and if they were culled,
+  // only valid while the props of the renderer are unchanged
+  std::vector<vtkProp*> QueriedProps;
+  std::vector<unsigned int> Queries;
+  std::vector<bool> QueriedPropsCulled;
+  vtkMTimeType ViewPropsMTime = 0;
+
+  vtkNew<vtkOpenGLBufferObject> BoxesBuffer;
+  vtkNew<vtkOpenGLBufferObject> IndicesBuffer;
+  vtkNew<vtkOpenGLVertexArrayObject> VAO;
+  vtkShaderProgram* Program = nullptr;
+  size_t NumberOfIndexedBoxes = 0;
+};
+
+#endif
@@ -1,6 +1,7 @@
 #include "vtkF3DGenericImporter.h"
 
 #include "F3DLog.h"
+#include "vtkF3DMemoryMesh.h"
 #include "vtkF3DPostProcessFilter.h"
 
 #include <vtkActor.h>
@@ -21,6 +22,7 @@
 #include <vtkSmartPointer.h>
 #include <vtkStreamingDemandDrivenPipeline.h>
 #include <vtkVersion.h>
+#include <vtkWeakPointer.h>
 
 #include <cassert>
 #include <numeric>
@@ -46,6 +48,11 @@ struct vtkF3DGenericImporter::Internals
   bool AnimationEnabled = false;
   std::array<double, 2> TimeRange;
   vtkNew<vtkDoubleArray> TimeSteps;
+  double TimeValue = 0.0;
+
+  // Memory meshes with a frame counter are updated before a render when the counter changed
+  vtkWeakPointer<vtkRenderer> Renderer;
+  unsigned long RendererObserverTag = 0;
 
   void UpdateBlock(BlockData& bd, vtkDataSet* dataset)
   {
@@ -65,6 +72,15 @@ vtkF3DGenericImporter::vtkF3DGenericImporter()
 {
 }
 
+//----------------------------------------------------------------------------
+vtkF3DGenericImporter::~vtkF3DGenericImporter()
+{
+  if (this->Pimpl->Renderer)
+  {
+    this->Pimpl->Renderer->RemoveObserver(this->Pimpl->RendererObserverTag);
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkF3DGenericImporter::UpdateTemporalInformation()
 {
@@ -218,6 +234,19 @@ void vtkF3DGenericImporter::ImportActors(vtkRenderer* ren)
     return;
   }
 
+  if (this->Pimpl->Renderer)
+  {
+    this->Pimpl->Renderer->RemoveObserver(this->Pimpl->RendererObserverTag);
+    this->Pimpl->Renderer = nullptr;
+  }
+  vtkF3DMemoryMesh* memoryMesh = vtkF3DMemoryMesh::SafeDownCast(this->Pimpl->Reader);
+  if (memoryMesh && memoryMesh->HasFrameCounter())
+  {
+    this->Pimpl->Renderer = ren;
+    this->Pimpl->RendererObserverTag =
+      ren->AddObserver(vtkCommand::StartEvent, this, &vtkF3DGenericImporter::OnRendererStart);
+  }
+
   this->Pimpl->OutputDescription = this->GetDataObjectDescription(output);
 
   vtkMultiBlockDataSet* mb = vtkMultiBlockDataSet::SafeDownCast(output);
@@ -374,10 +403,30 @@ bool vtkF3DGenericImporter::UpdateAtTimeValue(double timeValue)
     return true;
   }
 
+  this->Pimpl->TimeValue = timeValue;
+  return this->UpdateReader();
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DGenericImporter::OnRendererStart(vtkObject*, unsigned long, void*)
+{
+  vtkF3DMemoryMesh* memoryMesh = vtkF3DMemoryMesh::SafeDownCast(this->Pimpl->Reader);
+  if (memoryMesh && memoryMesh->UpdateFrameCounter())
+  {
+    this->UpdateReader();
+  }
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DGenericImporter::UpdateReader()
+{
   assert(this->Pimpl->Reader);
 
-  vtkInformation* info = this->Pimpl->Reader->GetOutputInformation(0);
-  info->Set(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP(), timeValue);
+  if (this->Pimpl->AnimationEnabled)
+  {
+    vtkInformation* info = this->Pimpl->Reader->GetOutputInformation(0);
+    info->Set(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP(), this->Pimpl->TimeValue);
+  }
   bool status = this->Pimpl->Reader->GetExecutive()->Update();
 
   vtkDataObject* output = this->Pimpl->Reader->GetOutputDataObject(0);
@@ -109,7 +109,7 @@ public:
 
 protected:
   vtkF3DGenericImporter();
-  ~vtkF3DGenericImporter() override = default;
+  ~vtkF3DGenericImporter() override;
 
   /*
    * Import surface from the internal reader output as actors
@@ -152,6 +152,16 @@ private:
   void ImportPartitionedDataSet(
     vtkPartitionedDataSet* pds, vtkRenderer* ren, const std::string& pdsName = "");
 
+  /**
+   * Update the reader at the current time and the blocks from its output
+   */
+  bool UpdateReader();
+
+  /**
+   * Update the memory mesh reader when its frame counter changed, called before each render
+   */
+  void OnRendererStart(vtkObject*, unsigned long, void*);
+
   struct Internals;
   std::unique_ptr<Internals> Pimpl;
 };
@@ -1171,6 +1171,10 @@ void vtkF3DImguiActor::RenderFpsCounter()
 
   std::string fpsString = std::to_string(this->FpsValue);
   fpsString += " fps";
+  if (this->CulledPropsValue >= 0)
+  {
+    fpsString += "\n" + std::to_string(this->CulledPropsValue) + " culled";
+  }
 
   ImVec2 winSize = ImGui::CalcTextSize(fpsString.c_str());
   winSize.x += 2.f * ImGui::GetStyle().WindowPadding.x;
@@ -127,6 +127,70 @@ void vtkF3DInteractorStyle::OnKeyPress()
   this->InvokeEvent(vtkF3DUserEvents::KeyPressEvent, nullptr);
 }
 
+//------------------------------------------------------------------------------
+void vtkF3DInteractorStyle::StartState(int newstate)
+{
+  vtkF3DRenderer* ren = vtkF3DRenderer::SafeDownCast(this->CurrentRenderer);
+  if (ren && ren->GetInteractiveTargetFrameTime().has_value())
+  {
+    const double targetFrameTime = std::max(ren->GetInteractiveTargetFrameTime().value(), 1.0);
+    if (!this->SavedDesiredUpdateRate.has_value())
+    {
+      this->SavedDesiredUpdateRate = this->Interactor->GetDesiredUpdateRate();
+    }
+    this->Interactor->SetDesiredUpdateRate(1000.0 / targetFrameTime);
+    ren->SetInteractiveRendering(true);
+    this->RefinePending = false;
+  }
+
+  this->Superclass::StartState(newstate);
+}
+
+//------------------------------------------------------------------------------
+void vtkF3DInteractorStyle::StopState()
+{
+  if (this->SavedDesiredUpdateRate.has_value())
+  {
+    this->Interactor->SetDesiredUpdateRate(this->SavedDesiredUpdateRate.value());
+    this->SavedDesiredUpdateRate.reset();
+  }
+
+  vtkF3DRenderer* ren = vtkF3DRenderer::SafeDownCast(this->CurrentRenderer);
+  if (ren && ren->GetInteractiveRendering())
+  {
+    // full quality is restored later by RefineRendering
+    this->RefinePending = true;
+    this->InteractionEndTime = std::chrono::steady_clock::now();
+  }
+
+  this->Superclass::StopState();
+}
+
+//------------------------------------------------------------------------------
+bool vtkF3DInteractorStyle::RefineRendering(bool force)
+{
+  if (!this->RefinePending || this->State != VTKIS_NONE)
+  {
+    return false;
+  }
+
+  const std::chrono::duration<double, std::milli> elapsed =
+    std::chrono::steady_clock::now() - this->InteractionEndTime;
+  if (!force && elapsed.count() < this->RefineDelay)
+  {
+    return false;
+  }
+
+  this->RefinePending = false;
+  vtkF3DRenderer* ren = vtkF3DRenderer::SafeDownCast(this->CurrentRenderer);
+  if (!ren || !ren->GetInteractiveRendering())
+  {
+    return false;
+  }
+  ren->SetInteractiveRendering(false);
+  return true;
+}
+
 //------------------------------------------------------------------------------
 void vtkF3DInteractorStyle::Rotate()
 {
@@ -9,6 +9,9 @@
 #include <vtkCommand.h>
 #include <vtkInteractorStyleTrackballCamera.h>
 
+#include <chrono>
+#include <optional>
+
 class vtkF3DInteractorStyle : public vtkInteractorStyleTrackballCamera
 {
 public:
@@ -104,6 +107,33 @@ public:
    */
   void UpdateRendererAfterInteraction();
 
+  ///@{
+  /**
+   * Overridden to switch the renderer to interactive rendering while the camera moves,
+   * when it has an interactive target frame time. The interactor desired update rate
+   * is set from this target so volume mappers adjust their sample distances accordingly,
+   * and restored when the interaction stops.
+   */
+  void StartState(int newstate) override;
+  void StopState() override;
+  ///@}
+
+  /**
+   * Restore full quality rendering once no interaction occurred for RefineDelay milliseconds,
+   * or immediately if force is true.
+   * Return true if full quality rendering has been restored and a render is needed.
+   */
+  bool RefineRendering(bool force = false);
+
+  ///@{
+  /**
+   * Set/Get the delay in milliseconds without interaction before restoring full quality
+   * rendering, so that successive interactions like mouse wheel steps stay interactive.
+   */
+  vtkSetMacro(RefineDelay, double);
+  vtkGetMacro(RefineDelay, double);
+  ///@}
+
   /**
    * Reimplemented to always return the first
    * renderer as this is the only one used
@@ -147,6 +177,11 @@ private:
 
   int InteractionMode = DEFAULT;
   bool CameraMovementDisabled = false;
+
+  double RefineDelay = 200.0;
+  bool RefinePending = false;
+  std::chrono::steady_clock::time_point InteractionEndTime;
+  std::optional<double> SavedDesiredUpdateRate;
 };
 
 #endif
@@ -0,0 +1,305 @@
+#include "vtkF3DKTXReader.h"
+
+#include <vtkFieldData.h>
+#include <vtkFileResourceStream.h>
+#include <vtkImageData.h>
+#include <vtkMemoryResourceStream.h>
+#include <vtkNew.h>
+#include <vtkObjectFactory.h>
+#include <vtkPointData.h>
+#include <vtkUnsignedCharArray.h>
+#include <vtkVersion.h>
+
+#include <ktx.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <string_view>
+
+vtkStandardNewMacro(vtkF3DKTXReader);
+
+namespace
+{
+constexpr std::string_view KTX2_IDENTIFIER = "\xABKTX 20\xBB\r\n\x1A\n";
+
+// Vulkan formats of the supported uncompressed textures
+constexpr ktx_uint32_t FORMAT_R8G8B8_UNORM = 23;
+constexpr ktx_uint32_t FORMAT_R8G8B8_SRGB = 29;
+constexpr ktx_uint32_t FORMAT_R8G8B8A8_UNORM = 37;
+constexpr ktx_uint32_t FORMAT_R8G8B8A8_SRGB = 43;
+
+struct TextureDeleter
+{
+  void operator()(ktxTexture2* texture) const
+  {
+    ktxTexture2_Destroy(texture);
+  }
+};
+using TexturePointer = std::unique_ptr<ktxTexture2, TextureDeleter>;
+
+//------------------------------------------------------------------------------
+// Number of components once decoded, 0 if the texture format is not supported
+int GetNumberOfComponents(ktxTexture2* texture)
+{
+  if (ktxTexture2_NeedsTranscoding(texture))
+  {
+    return 4;
+  }
+
+  switch (texture->vkFormat)
+  {
+    case FORMAT_R8G8B8_UNORM:
+    case FORMAT_R8G8B8_SRGB:
+      return 3;
+    case FORMAT_R8G8B8A8_UNORM:
+    case FORMAT_R8G8B8A8_SRGB:
+      return 4;
+    default:
+      return 0;
+  }
+}
+
+//------------------------------------------------------------------------------
+// Decode the base level of a KTX2 content to the scalars, an error is set on failure
+bool DecodeBaseLevel(
+  vtkUnsignedCharArray* content, vtkUnsignedCharArray* scalars, std::string& error)
+{
+  ktxTexture2* rawTexture = nullptr;
+  KTX_error_code result = ktxTexture2_CreateFromMemory(content->GetPointer(0),
+    static_cast<ktx_size_t>(content->GetNumberOfValues()), KTX_TEXTURE_CREATE_LOAD_IMAGE_DATA_BIT,
+    &rawTexture);
+  if (result != KTX_SUCCESS)
+  {
+    error = std::string("Could not load KTX2 image data: ") + ktxErrorString(result);
+    return false;
+  }
+  ::TexturePointer texture(rawTexture);
+
+  if (ktxTexture2_NeedsTranscoding(texture.get()))
+  {
+    result = ktxTexture2_TranscodeBasis(texture.get(), KTX_TTF_RGBA32, 0);
+    if (result != KTX_SUCCESS)
+    {
+      error = std::string("Could not transcode KTX2 texture: ") + ktxErrorString(result);
+      return false;
+    }
+  }
+
+  ktx_size_t offset = 0;
+  ktxTexture* baseTexture = reinterpret_cast<ktxTexture*>(texture.get());
+  if (ktxTexture_GetImageOffset(baseTexture, 0, 0, 0, &offset) != KTX_SUCCESS)
+  {
+    error = "Could not find KTX2 base level";
+    return false;
+  }
+
+  // KTX2 rows are stored from top to bottom by default while VTK images start at the bottom
+  const ktx_uint8_t* pixels = ktxTexture_GetData(baseTexture) + offset;
+  const size_t rowSize = static_cast<size_t>(texture->baseWidth) * scalars->GetNumberOfComponents();
+  if (static_cast<size_t>(scalars->GetNumberOfValues()) != rowSize * texture->baseHeight)
+  {
+    error = "Unexpected KTX2 base level size";
+    return false;
+  }
+
+  const bool flip = texture->orientation.y == KTX_ORIENT_Y_DOWN;
+  for (ktx_uint32_t row = 0; row < texture->baseHeight; row++)
+  {
+    const ktx_uint32_t srcRow = flip ? texture->baseHeight - 1 - row : row;
+    std::copy_n(pixels + srcRow * rowSize, rowSize, scalars->GetPointer(row * rowSize));
+  }
+  return true;
+}
+}
+
+//------------------------------------------------------------------------------
+vtkF3DKTXReader::vtkF3DKTXReader() = default;
+
+//------------------------------------------------------------------------------
+vtkF3DKTXReader::~vtkF3DKTXReader() = default;
+
+//------------------------------------------------------------------------------
+void vtkF3DKTXReader::ExecuteInformation()
+{
+  // XXX: Needed because of VTK initialize file pattern in the constructor for some reasons
+  delete[] this->FilePattern;
+  this->FilePattern = nullptr;
+
+  // Setup filename to read the header
+  this->ComputeInternalFileName(this->DataExtent[4]);
+  if ((this->InternalFileName == nullptr || this->InternalFileName[0] == '\0'))
+  {
+#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 5, 20251016)
+    if (!this->GetStream())
+#else
+    if (!this->GetMemoryBuffer())
+#endif
+    {
+      return;
+    }
+  }
+
+  vtkResourceStream* stream;
+  vtkNew<vtkFileResourceStream> fileStream;
+
+#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 5, 20251016)
+  if (this->GetStream())
+  {
+    stream = this->GetStream();
+  }
+#else
+  vtkNew<vtkMemoryResourceStream> memStream;
+  if (this->GetMemoryBuffer())
+  {
+    memStream->SetBuffer(this->GetMemoryBuffer(), this->GetMemoryBufferLength());
+    stream = memStream;
+  }
+#endif
+  else
+  {
+    fileStream->Open(this->InternalFileName);
+    stream = fileStream;
+  }
+
+  // A new array each time, the previous one may still be referenced by a previous output
+  stream->Seek(0, vtkResourceStream::SeekDirection::End);
+  this->Content = vtkSmartPointer<vtkUnsignedCharArray>::New();
+  this->Content->SetName("KTX2");
+  this->Content->SetNumberOfValues(static_cast<vtkIdType>(stream->Tell()));
+
+  stream->Seek(0, vtkResourceStream::SeekDirection::Begin);
+  stream->Read(this->Content->GetPointer(0), this->Content->GetNumberOfValues());
+
+  // Only parse the header here, image data is loaded when executing
+  ktxTexture2* rawTexture = nullptr;
+  KTX_error_code result = ktxTexture2_CreateFromMemory(this->Content->GetPointer(0),
+    static_cast<ktx_size_t>(this->Content->GetNumberOfValues()), KTX_TEXTURE_CREATE_NO_FLAGS,
+    &rawTexture);
+  if (result != KTX_SUCCESS)
+  {
+    vtkErrorMacro(<< "Could not get KTX2 infos: " << ktxErrorString(result));
+    return;
+  }
+  ::TexturePointer texture(rawTexture);
+
+  int nbComponents = ::GetNumberOfComponents(texture.get());
+  if (nbComponents == 0)
+  {
+    vtkErrorMacro(<< "Unsupported KTX2 format " << texture->vkFormat
+                  << ", only Basis Universal and uncompressed 8 bits RGB(A) textures are supported");
+    return;
+  }
+
+  this->DataExtent[0] = 0;
+  this->DataExtent[1] = static_cast<int>(texture->baseWidth) - 1;
+  this->DataExtent[2] = 0;
+  this->DataExtent[3] = static_cast<int>(texture->baseHeight) - 1;
+
+  this->SetNumberOfScalarComponents(nbComponents);
+  this->SetDataScalarTypeToUnsignedChar();
+
+  this->vtkImageReader::ExecuteInformation();
+}
+
+//------------------------------------------------------------------------------
+int vtkF3DKTXReader::CanReadFile(const char* fname)
+{
+  vtkNew<vtkFileResourceStream> fileStream;
+  if (!fileStream->Open(fname))
+  {
+    vtkErrorMacro(<< "Could not open file " << fname);
+    return 0;
+  }
+  return this->CanReadFile(fileStream);
+}
+
+//------------------------------------------------------------------------------
+int vtkF3DKTXReader::CanReadFile(vtkResourceStream* stream)
+{
+  if (!stream)
+  {
+    return 0;
+  }
+
+  stream->Seek(0, vtkResourceStream::SeekDirection::Begin);
+
+  char header[12];
+  if (stream->Read(header, 12) != 12)
+  {
+    return 0;
+  }
+
+  return std::string_view(header, 12) == ::KTX2_IDENTIFIER;
+}
+
+//------------------------------------------------------------------------------
+void vtkF3DKTXReader::ExecuteDataWithInformation(vtkDataObject* output, vtkInformation* outInfo)
+{
+  vtkImageData* data = this->AllocateOutputData(output, outInfo);
+
+  vtkUnsignedCharArray* scalars =
+    vtkUnsignedCharArray::SafeDownCast(data->GetPointData()->GetScalars());
+  if (!scalars)
+  {
+    vtkErrorMacro(<< "Could not find expected scalar array");
+    return;
+  }
+
+  if (!this->Content)
+  {
+    vtkErrorMacro(<< "Could not find KTX2 content");
+    return;
+  }
+
+  // Share the file content so textures can upload its levels without decoding them
+  data->GetFieldData()->AddArray(this->Content);
+
+  ktxTexture2* rawTexture = nullptr;
+  KTX_error_code result = ktxTexture2_CreateFromMemory(this->Content->GetPointer(0),
+    static_cast<ktx_size_t>(this->Content->GetNumberOfValues()), KTX_TEXTURE_CREATE_NO_FLAGS,
+    &rawTexture);
+  if (result != KTX_SUCCESS)
+  {
+    vtkErrorMacro(<< "Could not get KTX2 infos: " << ktxErrorString(result));
+    return;
+  }
+  ::TexturePointer texture(rawTexture);
+
+  if (ktxTexture2_NeedsTranscoding(texture.get()) && this->DeferTranscoding)
+  {
+    scalars->SetName("KTX2Deferred");
+    return;
+  }
+
+  scalars->SetName("Pixels");
+  std::string error;
+  if (!::DecodeBaseLevel(this->Content, scalars, error))
+  {
+    vtkErrorMacro(<< error);
+  }
+}
+
+//------------------------------------------------------------------------------
+bool vtkF3DKTXReader::TranscodeDeferred(vtkImageData* image)
+{
+  vtkUnsignedCharArray* scalars =
+    image ? vtkUnsignedCharArray::SafeDownCast(image->GetPointData()->GetScalars()) : nullptr;
+  if (!scalars || !scalars->GetName() || std::string_view(scalars->GetName()) != "KTX2Deferred")
+  {
+    return true;
+  }
+
+  vtkUnsignedCharArray* content =
+    vtkUnsignedCharArray::SafeDownCast(image->GetFieldData()->GetAbstractArray("KTX2"));
+  std::string error = "Could not find KTX2 content";
+  if (!content || !::DecodeBaseLevel(content, scalars, error))
+  {
+    vtkErrorWithObjectMacro(nullptr, << error);
+    return false;
+  }
+
+  scalars->SetName("Pixels");
+  scalars->Modified();
+  return true;
+}
@@ -0,0 +1,95 @@
+/**
+ * @class   vtkF3DKTXReader
+ * @brief   Read a KTX2 texture file
+ *
+ * Basis Universal supercompressed textures are transcoded to RGBA,
+ * other textures must use an uncompressed 8 bits RGB or RGBA format.
+ * Only the base mipmap level of the first layer and face is decoded.
+ * The content of the file is stored in a "KTX2" field data array of the output, without copy,
+ * so vtkF3DKTXTexture can upload the GPU compressed mipmap levels instead of the decoded image.
+ * Since textures only need the decoded image when the compressed upload is not possible,
+ * the transcoding of Basis Universal textures is deferred by default, see DeferTranscoding.
+ */
+#ifndef vtkF3DKTXReader_h
+#define vtkF3DKTXReader_h
+
+#include "vtkImageReader.h"
+#include "vtkSmartPointer.h"
+#include "vtkVersion.h"
+
+class vtkImageData;
+class vtkResourceStream;
+class vtkUnsignedCharArray;
+
+class vtkF3DKTXReader : public vtkImageReader
+{
+public:
+  static vtkF3DKTXReader* New();
+  vtkTypeMacro(vtkF3DKTXReader, vtkImageReader);
+
+  ///@{
+  /**
+   * Return 1 if, after a quick check of file header, it looks like the provided stream
+   * can be read. Return 0 if it is sure it cannot be read as a stream.
+   *
+   * Only check the header starts with the KTX2 identifier
+   */
+  int CanReadFile(const char* fname) override;
+#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 6, 20260106)
+  int CanReadFile(vtkResourceStream* stream) override;
+#else
+  int CanReadFile(vtkResourceStream* stream);
+#endif
+  ///@}
+
+  /**
+   * List of extensions supported by this reader
+   */
+  const char* GetFileExtensions() override
+  {
+    return ".ktx2";
+  }
+
+  /**
+   * Descriptive name of the reader
+   */
+  const char* GetDescriptiveName() override
+  {
+    return "KTX2";
+  }
+
+  ///@{
+  /**
+   * Set/Get if the transcoding of Basis Universal textures is deferred.
+   * When enabled, the scalars of the output are allocated but not filled, they are named
+   * "KTX2Deferred" until TranscodeDeferred is called on the output.
+   * Disable it when the output is used as an image rather than a texture.
+   * Default is true.
+   */
+  vtkSetMacro(DeferTranscoding, bool);
+  vtkGetMacro(DeferTranscoding, bool);
+  vtkBooleanMacro(DeferTranscoding, bool);
+  ///@}
+
+  /**
+   * Transcode the scalars of an image whose transcoding was deferred, in place.
+   * Do nothing and return true if the image is not deferred.
+   */
+  static bool TranscodeDeferred(vtkImageData* image);
+
+protected:
+  vtkF3DKTXReader();
+  ~vtkF3DKTXReader() override;
+
+  void ExecuteInformation() override;
+  void ExecuteDataWithInformation(vtkDataObject* out, vtkInformation* outInfo) override;
+
+private:
+  vtkF3DKTXReader(const vtkF3DKTXReader&) = delete;
+  void operator=(const vtkF3DKTXReader&) = delete;
+
+  vtkSmartPointer<vtkUnsignedCharArray> Content;
+  bool DeferTranscoding = true;
+};
+
+#endif
@@ -0,0 +1,467 @@
+#include "vtkF3DKTXTexture.h"
+
+#include "F3DLog.h"
+#include "F3DTextureCache.h"
+#include "vtkF3DKTXReader.h"
+#include "vtkF3DRenderer.h"
+
+#include <vtkFieldData.h>
+#include <vtkImageData.h>
+#include <vtkObjectFactory.h>
+#include <vtkOpenGLRenderWindow.h>
+#include <vtkOpenGLState.h>
+#include <vtkPointData.h>
+#include <vtkTextureObject.h>
+#include <vtkUnsignedCharArray.h>
+#include <vtk_glad.h>
+#include <vtksys/FStream.hxx>
+#include <vtksys/SystemTools.hxx>
+
+#include <ktx.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string_view>
+#include <thread>
+
+vtkStandardNewMacro(vtkF3DKTXTexture);
+
+namespace
+{
+// Compressed formats targeted by the Basis Universal transcoding, linear and sRGB
+constexpr GLenum COMPRESSED_RGBA_BPTC_UNORM = 0x8E8C;
+constexpr GLenum COMPRESSED_SRGB_ALPHA_BPTC_UNORM = 0x8E8D;
+constexpr GLenum COMPRESSED_RGBA_ASTC_4x4 = 0x93B0;
+constexpr GLenum COMPRESSED_SRGB8_ALPHA8_ASTC_4x4 = 0x93D0;
+constexpr GLenum COMPRESSED_RGBA8_ETC2_EAC = 0x9278;
+constexpr GLenum COMPRESSED_SRGB8_ALPHA8_ETC2_EAC = 0x9279;
+
+// Vulkan formats of the supported uncompressed textures
+constexpr ktx_uint32_t FORMAT_R8G8B8A8_UNORM = 37;
+constexpr ktx_uint32_t FORMAT_R8G8B8A8_SRGB = 43;
+
+struct TextureDeleter
+{
+  void operator()(ktxTexture2* texture) const
+  {
+    ktxTexture2_Destroy(texture);
+  }
+};
+using TexturePointer = std::unique_ptr<ktxTexture2, TextureDeleter>;
+
+struct Target
+{
+  ktx_transcode_fmt_e TranscodeFormat;
+  GLenum LinearFormat;
+  GLenum SRGBFormat;
+};
+
+// BC7 is preferred as ASTC and ETC2 are often decompressed by desktop drivers
+constexpr Target TARGETS[] = {
+  { KTX_TTF_BC7_RGBA, COMPRESSED_RGBA_BPTC_UNORM, COMPRESSED_SRGB_ALPHA_BPTC_UNORM },
+  { KTX_TTF_ASTC_4x4_RGBA, COMPRESSED_RGBA_ASTC_4x4, COMPRESSED_SRGB8_ALPHA8_ASTC_4x4 },
+  { KTX_TTF_ETC2_RGBA, COMPRESSED_RGBA8_ETC2_EAC, COMPRESSED_SRGB8_ALPHA8_ETC2_EAC },
+};
+
+//------------------------------------------------------------------------------
+// Find the first target supported by the current context, nullptr if none
+const Target* FindTarget(bool srgb)
+{
+  GLint nbFormats = 0;
+  glGetIntegerv(GL_NUM_COMPRESSED_TEXTURE_FORMATS, &nbFormats);
+  std::vector<GLint> formats(static_cast<size_t>(std::max(nbFormats, 0)));
+  if (!formats.empty())
+  {
+    glGetIntegerv(GL_COMPRESSED_TEXTURE_FORMATS, formats.data());
+  }
+
+  for (const Target& target : TARGETS)
+  {
+    const GLint format = static_cast<GLint>(srgb ? target.SRGBFormat : target.LinearFormat);
+    if (std::find(formats.begin(), formats.end(), format) != formats.end())
+    {
+      return &target;
+    }
+  }
+  return nullptr;
+}
+
+//------------------------------------------------------------------------------
+// Average 2x2 blocks of an RGBA image, odd sizes repeat their last row or column
+std::vector<unsigned char> Downsample(const std::vector<unsigned char>& src, int width, int height)
+{
+  const int dstWidth = std::max(width / 2, 1);
+  const int dstHeight = std::max(height / 2, 1);
+  std::vector<unsigned char> dst(static_cast<size_t>(dstWidth) * dstHeight * 4);
+  for (int y = 0; y < dstHeight; y++)
+  {
+    const int y0 = std::min(2 * y, height - 1);
+    const int y1 = std::min(2 * y + 1, height - 1);
+    for (int x = 0; x < dstWidth; x++)
+    {
+      const int x0 = std::min(2 * x, width - 1);
+      const int x1 = std::min(2 * x + 1, width - 1);
+      for (int c = 0; c < 4; c++)
+      {
+        const int sum = src[(static_cast<size_t>(y0) * width + x0) * 4 + c] +
+          src[(static_cast<size_t>(y0) * width + x1) * 4 + c] +
+          src[(static_cast<size_t>(y1) * width + x0) * 4 + c] +
+          src[(static_cast<size_t>(y1) * width + x1) * 4 + c];
+        dst[(static_cast<size_t>(y) * dstWidth + x) * 4 + c] =
+          static_cast<unsigned char>(sum / 4);
+      }
+    }
+  }
+  return dst;
+}
+
+//------------------------------------------------------------------------------
+// Encode an 8 bits RGB(A) image and its mipmap levels to a UASTC KTX2 content,
+// rows are kept in the VTK order, from bottom to top
+bool EncodeUASTC(vtkImageData* image, vtkUnsignedCharArray* scalars, bool srgb,
+  std::vector<unsigned char>& content)
+{
+  const int* dims = image->GetDimensions();
+  int width = dims[0];
+  int height = dims[1];
+  const int nbComponents = scalars->GetNumberOfComponents();
+
+  ktxTextureCreateInfo createInfo{};
+  createInfo.vkFormat = srgb ? FORMAT_R8G8B8A8_SRGB : FORMAT_R8G8B8A8_UNORM;
+  createInfo.baseWidth = static_cast<ktx_uint32_t>(width);
+  createInfo.baseHeight = static_cast<ktx_uint32_t>(height);
+  createInfo.baseDepth = 1;
+  createInfo.numDimensions = 2;
+  createInfo.numLevels = 1;
+  while ((std::max(width, height) >> createInfo.numLevels) > 0)
+  {
+    createInfo.numLevels++;
+  }
+  createInfo.numLayers = 1;
+  createInfo.numFaces = 1;
+  createInfo.isArray = KTX_FALSE;
+  createInfo.generateMipmaps = KTX_FALSE;
+
+  ktxTexture2* rawTexture = nullptr;
+  if (ktxTexture2_Create(&createInfo, KTX_TEXTURE_CREATE_ALLOC_STORAGE, &rawTexture) !=
+    KTX_SUCCESS)
+  {
+    return false;
+  }
+  ::TexturePointer texture(rawTexture);
+  ktxTexture* baseTexture = reinterpret_cast<ktxTexture*>(texture.get());
+
+  std::vector<unsigned char> level(static_cast<size_t>(width) * height * 4, 255);
+  const unsigned char* pixels = scalars->GetPointer(0);
+  for (size_t i = 0; i < static_cast<size_t>(width) * height; i++)
+  {
+    std::copy_n(pixels + i * nbComponents, std::min(nbComponents, 4), level.data() + i * 4);
+  }
+
+  for (ktx_uint32_t l = 0; l < createInfo.numLevels; l++)
+  {
+    if (ktxTexture_SetImageFromMemory(baseTexture, l, 0, 0, level.data(), level.size()) !=
+      KTX_SUCCESS)
+    {
+      return false;
+    }
+    level = ::Downsample(level, width, height);
+    width = std::max(width / 2, 1);
+    height = std::max(height / 2, 1);
+  }
+
+  const char orientation[] = "ru";
+  ktxHashList_AddKVPair(
+    &texture->kvDataHead, KTX_ORIENTATION_KEY, sizeof(orientation), orientation);
+
+  ktxBasisParams params{};
+  params.structSize = sizeof(params);
+  params.uastc = KTX_TRUE;
+  params.threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+  if (ktxTexture2_CompressBasisEx(texture.get(), &params) != KTX_SUCCESS)
+  {
+    return false;
+  }
+
+  ktx_uint8_t* bytes = nullptr;
+  ktx_size_t size = 0;
+  if (ktxTexture_WriteToMemory(baseTexture, &bytes, &size) != KTX_SUCCESS)
+  {
+    return false;
+  }
+  content.assign(bytes, bytes + size);
+  std::free(bytes);
+  return true;
+}
+}
+
+//------------------------------------------------------------------------------
+vtkF3DKTXTexture::~vtkF3DKTXTexture()
+{
+  if (this->CompressedHandle)
+  {
+    this->ReleaseGraphicsResources(this->RenderWindow);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkF3DKTXTexture::Load(vtkRenderer* ren)
+{
+  vtkOpenGLRenderWindow* renWin = vtkOpenGLRenderWindow::SafeDownCast(ren->GetRenderWindow());
+  vtkImageData* input = this->GetInput();
+  if (!renWin || !input || this->CubeMap || this->PremultipliedAlpha)
+  {
+    if (this->CompressedHandle)
+    {
+      this->ReleaseGraphicsResources(this->RenderWindow);
+    }
+    vtkF3DKTXReader::TranscodeDeferred(input);
+    this->Superclass::Load(ren);
+    return;
+  }
+
+  // Upload the compressed levels once the background encoding is done
+  bool encoded = false;
+  if (this->Encoding.valid() &&
+    this->Encoding.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+  {
+    try
+    {
+      encoded = this->Encoding.get();
+    }
+    catch (const std::future_error&)
+    {
+      // the encoding was dropped
+    }
+    if (!encoded)
+    {
+      F3DLog::Print(F3DLog::Severity::Warning,
+        "Could not encode texture to the cache: " + this->EncodingPath);
+    }
+  }
+
+  const bool needLoad = this->GetMTime() > this->LoadTime.GetMTime() ||
+    input->GetMTime() > this->LoadTime.GetMTime() || renWin != this->RenderWindow ||
+    renWin->GetContextCreationTime() > this->LoadTime.GetMTime() || encoded;
+  if (!needLoad)
+  {
+    if (this->CompressedHandle)
+    {
+      this->TextureObject->Activate();
+    }
+    else
+    {
+      this->Superclass::Load(ren);
+    }
+    return;
+  }
+
+  if (this->CompressedHandle)
+  {
+    this->ReleaseGraphicsResources(this->RenderWindow);
+  }
+
+  std::vector<unsigned char> content;
+  if (this->GetContent(ren, content) && this->Upload(renWin, content))
+  {
+    this->RenderWindow = renWin;
+    this->LoadTime.Modified();
+    this->TextureObject->Activate();
+    return;
+  }
+
+  // Transcoding modifies the input so the superclass uploads it
+  vtkF3DKTXReader::TranscodeDeferred(input);
+  this->Superclass::Load(ren);
+}
+
+//------------------------------------------------------------------------------
+void vtkF3DKTXTexture::WaitForCacheEncoding()
+{
+  if (this->Encoding.valid())
+  {
+    this->Encoding.wait();
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkF3DKTXTexture::ReleaseGraphicsResources(vtkWindow* win)
+{
+  vtkOpenGLRenderWindow* renWin = vtkOpenGLRenderWindow::SafeDownCast(win);
+  if (this->CompressedHandle && renWin)
+  {
+    // The texture object does not own the compressed texture
+    glDeleteTextures(1, &this->CompressedHandle);
+  }
+  this->CompressedHandle = 0;
+
+  this->Superclass::ReleaseGraphicsResources(win);
+}
+
+//------------------------------------------------------------------------------
+bool vtkF3DKTXTexture::GetContent(vtkRenderer* ren, std::vector<unsigned char>& content)
+{
+  vtkImageData* input = this->GetInput();
+  vtkUnsignedCharArray* ktx2 =
+    vtkUnsignedCharArray::SafeDownCast(input->GetFieldData()->GetAbstractArray("KTX2"));
+  if (ktx2)
+  {
+    content.assign(ktx2->GetPointer(0), ktx2->GetPointer(0) + ktx2->GetNumberOfValues());
+    return true;
+  }
+
+  vtkF3DRenderer* renderer = vtkF3DRenderer::SafeDownCast(ren);
+  vtkUnsignedCharArray* scalars =
+    vtkUnsignedCharArray::SafeDownCast(input->GetPointData()->GetScalars());
+  const int* dims = input->GetDimensions();
+  if (!renderer || !renderer->GetUseTextureCache() || renderer->GetCachePath().empty() ||
+    !scalars || scalars->GetNumberOfComponents() < 3 || dims[2] != 1)
+  {
+    return false;
+  }
+
+  // The cache is keyed by the decoded image, so any encoded format benefits from it
+  const std::string_view pixels(reinterpret_cast<const char*>(scalars->GetPointer(0)),
+    static_cast<size_t>(scalars->GetNumberOfValues()));
+  std::ostringstream name;
+  name << std::hex << std::setfill('0') << std::setw(16) << std::hash<std::string_view>()(pixels)
+       << "_" << std::dec << dims[0] << "x" << dims[1] << "x" << scalars->GetNumberOfComponents()
+       << (this->UseSRGBColorSpace ? "_srgb" : "") << ".ktx2";
+  const std::string directory = renderer->GetCachePath() + "/textures";
+  const std::string path = directory + "/" + name.str();
+
+  if (vtksys::SystemTools::FileExists(path, true))
+  {
+    vtksys::ifstream file(path.c_str(), std::ios::binary);
+    content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    if (!content.empty())
+    {
+      return true;
+    }
+  }
+
+  if (path == this->EncodingPath)
+  {
+    // already encoded, or being encoded, without success so far
+    return false;
+  }
+
+  // Encoding is slow, the input is uploaded uncompressed meanwhile
+  F3DLog::Print(F3DLog::Severity::Debug, "Encoding texture to the cache: " + path);
+  auto promise = std::make_shared<std::promise<bool>>();
+  this->Encoding = promise->get_future();
+  this->EncodingPath = path;
+  F3DTextureCache::Run(
+    [promise, image = vtkSmartPointer<vtkImageData>(input),
+      scalars = vtkSmartPointer<vtkUnsignedCharArray>(scalars), srgb = this->UseSRGBColorSpace,
+      directory, path]()
+    {
+      std::vector<unsigned char> encoded;
+      if (!::EncodeUASTC(image, scalars, srgb, encoded))
+      {
+        promise->set_value(false);
+        return;
+      }
+
+      vtksys::SystemTools::MakeDirectory(directory);
+      vtksys::ofstream file(path.c_str(), std::ios::binary);
+      file.write(reinterpret_cast<const char*>(encoded.data()), encoded.size());
+      promise->set_value(static_cast<bool>(file));
+    });
+  return false;
+}
+
+//------------------------------------------------------------------------------
+bool vtkF3DKTXTexture::Upload(
+  vtkOpenGLRenderWindow* renWin, const std::vector<unsigned char>& content)
+{
+  ktxTexture2* rawTexture = nullptr;
+  if (ktxTexture2_CreateFromMemory(content.data(), content.size(),
+        KTX_TEXTURE_CREATE_LOAD_IMAGE_DATA_BIT, &rawTexture) != KTX_SUCCESS)
+  {
+    return false;
+  }
+  ::TexturePointer texture(rawTexture);
+  ktxTexture* baseTexture = reinterpret_cast<ktxTexture*>(texture.get());
+
+  if (texture->numDimensions != 2 || texture->numFaces != 1 || texture->numLayers > 1)
+  {
+    return false;
+  }
+
+  GLenum internalFormat = 0;
+  if (ktxTexture2_NeedsTranscoding(texture.get()))
+  {
+    const ::Target* target = ::FindTarget(this->UseSRGBColorSpace);
+    if (!target ||
+      ktxTexture2_TranscodeBasis(texture.get(), target->TranscodeFormat, 0) != KTX_SUCCESS)
+    {
+      return false;
+    }
+    internalFormat = this->UseSRGBColorSpace ? target->SRGBFormat : target->LinearFormat;
+  }
+  else if (texture->numLevels <= 1 ||
+    (texture->vkFormat != FORMAT_R8G8B8A8_UNORM && texture->vkFormat != FORMAT_R8G8B8A8_SRGB))
+  {
+    // Only pre-built levels of uncompressed textures are worth uploading here
+    return false;
+  }
+
+  if (!this->TextureObject)
+  {
+    this->TextureObject = vtkTextureObject::New();
+  }
+  this->TextureObject->SetContext(renWin);
+
+  glGenTextures(1, &this->CompressedHandle);
+  this->TextureObject->AssignToExistingTexture(this->CompressedHandle, GL_TEXTURE_2D);
+  this->TextureObject->SetWrapS(this->Wrap);
+  this->TextureObject->SetWrapT(this->Wrap);
+  this->TextureObject->SetMinificationFilter(this->Interpolate
+      ? vtkTextureObject::LinearMipmapLinear
+      : vtkTextureObject::NearestMipmapNearest);
+  this->TextureObject->SetMagnificationFilter(
+    this->Interpolate ? vtkTextureObject::Linear : vtkTextureObject::Nearest);
+  this->TextureObject->SetMaxLevel(static_cast<int>(texture->numLevels) - 1);
+  this->TextureObject->SetMaximumAnisotropicFiltering(this->MaximumAnisotropicFiltering);
+  this->TextureObject->Activate();
+
+  renWin->GetState()->vtkglPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+  for (ktx_uint32_t level = 0; level < texture->numLevels; level++)
+  {
+    ktx_size_t offset = 0;
+    ktxTexture_GetImageOffset(baseTexture, level, 0, 0, &offset);
+    const ktx_uint8_t* data = ktxTexture_GetData(baseTexture) + offset;
+    const GLsizei width = static_cast<GLsizei>(std::max(texture->baseWidth >> level, 1u));
+    const GLsizei height = static_cast<GLsizei>(std::max(texture->baseHeight >> level, 1u));
+    if (internalFormat)
+    {
+      glCompressedTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(level), internalFormat, width,
+        height, 0, static_cast<GLsizei>(ktxTexture_GetImageSize(baseTexture, level)), data);
+    }
+    else
+    {
+      glTexImage2D(GL_TEXTURE_2D, static_cast<GLint>(level),
+        this->UseSRGBColorSpace ? GL_SRGB8_ALPHA8 : GL_RGBA8, width, height, 0, GL_RGBA,
+        GL_UNSIGNED_BYTE, data);
+    }
+  }
+  this->TextureObject->Deactivate();
+
+  if (glGetError() != GL_NO_ERROR)
+  {
+    this->ReleaseGraphicsResources(renWin);
+    return false;
+  }
+
+  // VTK textures start with the bottom row, compressed blocks cannot be flipped so the
+  // texture coordinates are flipped instead
+  this->UpsideDown = texture->orientation.y == KTX_ORIENT_Y_DOWN;
+  return true;
+}
@@ -0,0 +1,94 @@
+/**
+ * @class   vtkF3DKTXTexture
+ * @brief   Texture uploading GPU compressed KTX2 mipmap levels
+ *
+ * Override of vtkOpenGLTexture used for all the textures of the scene.
+ * When its input carries the "KTX2" field data array produced by vtkF3DKTXReader, Basis Universal
+ * levels are transcoded to the best compressed format supported by the context, among ASTC 4x4,
+ * BC7 and ETC2, and all the levels are uploaded directly, without generating mipmaps.
+ * When the texture cache is enabled on the vtkF3DRenderer, other 8 bits RGB(A) 2D inputs are
+ * encoded to UASTC once by the F3DTextureCache workers and stored in the "textures" directory of
+ * the cache path, the input is uploaded uncompressed until the encoding is done.
+ * Compressed levels stored from top to bottom cannot be flipped, they are uploaded as is and
+ * vtkF3DPolyDataMapper flips the V texture coordinate when sampling them, see IsUpsideDown.
+ * Contexts without any of these formats fall back to the uncompressed upload of the input,
+ * transcoding it first if its transcoding was deferred by vtkF3DKTXReader.
+ */
+
+#ifndef vtkF3DKTXTexture_h
+#define vtkF3DKTXTexture_h
+
+#include <vtkOpenGLTexture.h>
+
+#include <future>
+#include <string>
+#include <vector>
+
+class vtkF3DKTXTexture : public vtkOpenGLTexture
+{
+public:
+  static vtkF3DKTXTexture* New();
+  vtkTypeMacro(vtkF3DKTXTexture, vtkOpenGLTexture);
+
+  /**
+   * Upload the compressed levels if possible, call the superclass otherwise
+   */
+  void Load(vtkRenderer*) override;
+
+  /**
+   * Release the compressed texture
+   */
+  void ReleaseGraphicsResources(vtkWindow*) override;
+
+  /**
+   * Return true if the last Load uploaded compressed levels
+   */
+  bool IsCompressed() const
+  {
+    return this->CompressedHandle != 0;
+  }
+
+  /**
+   * Return true if the last Load uploaded compressed levels starting with the top row,
+   * the V texture coordinate must then be flipped when sampling this texture
+   */
+  bool IsUpsideDown() const
+  {
+    return this->CompressedHandle != 0 && this->UpsideDown;
+  }
+
+  /**
+   * Wait for the texture cache encoding started by a previous Load, if any.
+   * The compressed levels are uploaded by the next Load.
+   */
+  void WaitForCacheEncoding();
+
+protected:
+  vtkF3DKTXTexture() = default;
+  ~vtkF3DKTXTexture() override;
+
+private:
+  vtkF3DKTXTexture(const vtkF3DKTXTexture&) = delete;
+  void operator=(const vtkF3DKTXTexture&) = delete;
+
+  /**
+   * Get the KTX2 content to upload, from the input or from the texture cache.
+   * Start encoding the input in the background if it is not in the texture cache yet.
+   * Returns false if the input cannot be uploaded compressed now.
+   */
+  bool GetContent(vtkRenderer* ren, std::vector<unsigned char>& content);
+
+  /**
+   * Transcode and upload the levels of a KTX2 content, returns false if not possible
+   */
+  bool Upload(vtkOpenGLRenderWindow* renWin, const std::vector<unsigned char>& content);
+
+  unsigned int CompressedHandle = 0;
+  bool UpsideDown = false;
+
+  // Background encoding of the input to the texture cache, true if the file was written
+  std::future<bool> Encoding;
+  std::string EncodingPath;
+};
+
+#endif
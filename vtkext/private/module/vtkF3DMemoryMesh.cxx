@@ -1,11 +1,26 @@
 #include "vtkF3DMemoryMesh.h"
 
+#include "vtkDataArray.h"
+#include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
+#include "vtkInformationObjectBaseKey.h"
 #include "vtkInformationVector.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
+#include <algorithm>
+#include <array>
+#include <cassert>
+
+namespace
+{
+// Maximum number of ranges kept in the modified ranges log, older ones are dropped first
+constexpr vtkIdType MaxLoggedRanges = 64;
+}
+
 vtkStandardNewMacro(vtkF3DMemoryMesh);
+vtkInformationKeyMacro(vtkF3DMemoryMesh, MODIFIED_RANGES, ObjectBase);
 
 //------------------------------------------------------------------------------
 vtkF3DMemoryMesh::vtkF3DMemoryMesh()
@@ -29,6 +44,38 @@ void vtkF3DMemoryMesh::SetUpdateFunction(std::function<void(double, vtkPolyData*
   this->UpdateFunction = std::move(updateFunction);
 }
 
+//------------------------------------------------------------------------------
+void vtkF3DMemoryMesh::SetFrameCounterFunction(std::function<uint64_t()> frameCounterFunction)
+{
+  this->FrameCounterFunction = std::move(frameCounterFunction);
+  this->FrameCounter = this->FrameCounterFunction ? this->FrameCounterFunction() : 0;
+}
+
+//------------------------------------------------------------------------------
+bool vtkF3DMemoryMesh::HasFrameCounter() const
+{
+  return static_cast<bool>(this->FrameCounterFunction);
+}
+
+//------------------------------------------------------------------------------
+bool vtkF3DMemoryMesh::UpdateFrameCounter()
+{
+  if (!this->FrameCounterFunction)
+  {
+    return false;
+  }
+
+  const uint64_t frameCounter = this->FrameCounterFunction();
+  if (frameCounter == this->FrameCounter)
+  {
+    return false;
+  }
+
+  this->FrameCounter = frameCounter;
+  this->Modified();
+  return true;
+}
+
 //------------------------------------------------------------------------------
 int vtkF3DMemoryMesh::RequestInformation(vtkInformation* vtkNotUsed(request),
   vtkInformationVector** vtkNotUsed(inputVector), vtkInformationVector* outputVector)
@@ -61,3 +108,90 @@ int vtkF3DMemoryMesh::RequestData(vtkInformation* vtkNotUsed(request),
 
   return 1;
 }
+
+//------------------------------------------------------------------------------
+void vtkF3DMemoryMesh::MarkModifiedRanges(
+  vtkDataArray* array, const std::vector<std::pair<size_t, size_t>>& ranges)
+{
+  assert(array);
+
+  vtkInformation* info = array->GetInformation();
+  vtkIdTypeArray* log = vtkIdTypeArray::SafeDownCast(info->Get(MODIFIED_RANGES()));
+
+  vtkNew<vtkIdTypeArray> newLog;
+  newLog->SetNumberOfComponents(3);
+
+  // keep the previous entries that are not older than the maximum log size
+  vtkIdType baseMTime = static_cast<vtkIdType>(array->GetMTime());
+  vtkIdType first = 1;
+  if (log && log->GetNumberOfTuples() > 0)
+  {
+    const vtkIdType nbEntries = log->GetNumberOfTuples() - 1;
+    baseMTime = log->GetTypedComponent(0, 0);
+    if (nbEntries + static_cast<vtkIdType>(ranges.size()) > MaxLoggedRanges)
+    {
+      first = std::min(nbEntries + 1,
+        1 + nbEntries + static_cast<vtkIdType>(ranges.size()) - MaxLoggedRanges);
+      baseMTime = log->GetTypedComponent(first - 1, 0);
+    }
+  }
+
+  array->Modified();
+  const vtkIdType mtime = static_cast<vtkIdType>(array->GetMTime());
+
+  std::array<vtkIdType, 3> entry = { baseMTime, 0, 0 };
+  newLog->InsertNextTypedTuple(entry.data());
+  if (log)
+  {
+    for (vtkIdType i = first; i < log->GetNumberOfTuples(); i++)
+    {
+      log->GetTypedTuple(i, entry.data());
+      newLog->InsertNextTypedTuple(entry.data());
+    }
+  }
+  for (const auto& [begin, end] : ranges)
+  {
+    entry = { mtime, static_cast<vtkIdType>(begin), static_cast<vtkIdType>(end) };
+    newLog->InsertNextTypedTuple(entry.data());
+  }
+
+  info->Set(MODIFIED_RANGES(), newLog);
+}
+
+//------------------------------------------------------------------------------
+bool vtkF3DMemoryMesh::GetModifiedRanges(
+  vtkDataArray* array, vtkMTimeType since, std::vector<std::pair<vtkIdType, vtkIdType>>& ranges)
+{
+  ranges.clear();
+
+  if (!array || !array->GetInformation()->Has(MODIFIED_RANGES()))
+  {
+    return false;
+  }
+
+  vtkIdTypeArray* log =
+    vtkIdTypeArray::SafeDownCast(array->GetInformation()->Get(MODIFIED_RANGES()));
+  if (!log || log->GetNumberOfTuples() == 0 ||
+    static_cast<vtkMTimeType>(log->GetTypedComponent(0, 0)) > since)
+  {
+    return false;
+  }
+
+  // the array was modified without logging the ranges
+  const vtkIdType last = log->GetNumberOfTuples() - 1;
+  if (last == 0 || array->GetMTime() > static_cast<vtkMTimeType>(log->GetTypedComponent(last, 0)))
+  {
+    return false;
+  }
+
+  for (vtkIdType i = 1; i < log->GetNumberOfTuples(); i++)
+  {
+    std::array<vtkIdType, 3> entry;
+    log->GetTypedTuple(i, entry.data());
+    if (static_cast<vtkMTimeType>(entry[0]) > since)
+    {
+      ranges.emplace_back(entry[1], entry[2]);
+    }
+  }
+  return true;
+}
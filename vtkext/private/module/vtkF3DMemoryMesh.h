@@ -12,6 +12,14 @@
 
 #include "vtkPolyDataAlgorithm.h"
 
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+class vtkDataArray;
+class vtkInformationObjectBaseKey;
+
 class vtkF3DMemoryMesh : public vtkPolyDataAlgorithm
 {
 public:
@@ -35,6 +43,50 @@ public:
    */
   void SetUpdateFunction(std::function<void(double, vtkPolyData*)> updateFunction);
 
+  /**
+   * Set a function returning a counter which changes each time a new version of the mesh is
+   * available independently of the time. The counter is polled by UpdateFrameCounter.
+   */
+  void SetFrameCounterFunction(std::function<uint64_t()> frameCounterFunction);
+
+  /**
+   * Return true if a frame counter function is set
+   */
+  bool HasFrameCounter() const;
+
+  /**
+   * Poll the frame counter and mark the algorithm as modified if it changed,
+   * so the update function is called again by the next update.
+   * Returns true if the counter changed.
+   */
+  bool UpdateFrameCounter();
+
+  /**
+   * Information key set on a data array to log the tuple ranges modified in place.
+   * The stored object is a 3 components vtkIdTypeArray. The first tuple is
+   * (baseMTime, 0, 0), meaning the log is complete for any consumer that uploaded the array
+   * after baseMTime. Each next tuple is (mtime, begin, end), with `begin` included and `end`
+   * excluded, recorded when the array reached `mtime`.
+   */
+  static vtkInformationObjectBaseKey* MODIFIED_RANGES();
+
+  /**
+   * Mark the provided tuple ranges of an array as modified in place and call Modified() on it.
+   * Ranges are appended to the MODIFIED_RANGES log, older entries are dropped when the log grows
+   * beyond a fixed size.
+   */
+  static void MarkModifiedRanges(
+    vtkDataArray* array, const std::vector<std::pair<size_t, size_t>>& ranges);
+
+  /**
+   * Get the tuple ranges modified in place since the given time.
+   * Returns false if the array has no log, if the log does not go back far enough or if the array
+   * was modified since the last logged ranges, in which case the whole array must be considered
+   * modified.
+   */
+  static bool GetModifiedRanges(
+    vtkDataArray* array, vtkMTimeType since, std::vector<std::pair<vtkIdType, vtkIdType>>& ranges);
+
 protected:
   vtkF3DMemoryMesh();
   ~vtkF3DMemoryMesh() override;
@@ -49,6 +101,8 @@ private:
 
   double TimeRange[2] = { 0.0, 0.0 };
   std::function<void(double, vtkPolyData*)> UpdateFunction;
+  std::function<uint64_t()> FrameCounterFunction;
+  uint64_t FrameCounter = 0;
   vtkNew<vtkPolyData> CachedPolyData;
 };
 
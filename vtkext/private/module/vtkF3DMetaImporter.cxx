@@ -1,6 +1,7 @@
 #include "vtkF3DMetaImporter.h"
 
 #include "F3DLog.h"
+#include "F3DTextureCache.h"
 #include "vtkF3DGenericImporter.h"
 #include "vtkF3DImporter.h"
 
@@ -22,6 +23,7 @@
 #include <vtkVersion.h>
 
 #include <cassert>
+#include <chrono>
 #include <iostream>
 #include <numeric>
 #include <vector>
@@ -116,12 +118,14 @@ struct vtkF3DMetaImporter::Internals
   std::vector<vtkF3DMetaImporter::NormalGlyphsStruct> NormalGlyphsActorsAndMappers;
   std::vector<vtkF3DMetaImporter::PointSpritesStruct> PointSpritesActorsAndMappers;
   std::vector<vtkF3DMetaImporter::VolumeStruct> VolumePropsAndMappers;
+  std::vector<vtkSmartPointer<vtkActor>> InstancedActors;
 
   std::vector<vtkF3DMetaImporter::ImporterInfo> Importers;
   std::optional<vtkIdType> CameraIndex;
   vtkBoundingBox GeometryBoundingBox;
   vtkTimeStamp ColoringInfoTime;
   vtkTimeStamp UpdateTime;
+  double ImportersUpdateDuration = 0;
 
   F3DColoringInfoHandler ColoringInfoHandler;
 };
@@ -144,6 +148,9 @@ vtkF3DMetaImporter::~vtkF3DMetaImporter()
   // XXX by doing this we ensure ~vtkImporter does not delete it
   // As we have our own way of handling renderer lifetime
   this->Renderer = nullptr;
+
+  // Release the decoded textures shared between importers
+  F3DTextureCache::Clear();
 }
 
 //----------------------------------------------------------------------------
@@ -155,7 +162,9 @@ void vtkF3DMetaImporter::Clear()
   this->Pimpl->ColoringActorsAndMappers.clear();
   this->Pimpl->PointSpritesActorsAndMappers.clear();
   this->Pimpl->VolumePropsAndMappers.clear();
+  this->Pimpl->InstancedActors.clear();
   this->Pimpl->ColoringInfoHandler.ClearColoringInfo();
+  F3DTextureCache::Clear();
   this->Modified();
 }
 
@@ -245,6 +254,7 @@ bool vtkF3DMetaImporter::Update()
   vtkIdType localCameraIndex = -1;
 
   this->Pimpl->UpdateTime.Modified();
+  this->Pimpl->ImportersUpdateDuration = 0;
 
   if (this->Pimpl->CameraIndex.has_value())
   {
@@ -277,7 +287,11 @@ bool vtkF3DMetaImporter::Update()
       importer->SetCamera(localCameraIndex);
     }
 
-    if (!importer->Update())
+    const auto updateStart = std::chrono::steady_clock::now();
+    const bool updated = importer->Update();
+    this->Pimpl->ImportersUpdateDuration +=
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - updateStart).count();
+    if (!updated)
     {
       return false;
     }
@@ -324,6 +338,15 @@ bool vtkF3DMetaImporter::Update()
     actorCollection->InitTraversal(ait);
     while (vtkActor* actor = actorCollection->GetNextActor(ait))
     {
+      // Instanced actors are rendered as imported, they only contribute to the bounding box
+      vtkGlyph3DMapper* glyphMapper = vtkGlyph3DMapper::SafeDownCast(actor->GetMapper());
+      if (glyphMapper != nullptr)
+      {
+        this->Pimpl->GeometryBoundingBox.AddBounds(glyphMapper->GetBounds());
+        this->Pimpl->InstancedActors.emplace_back(actor);
+        continue;
+      }
+
       // Check for actor's poly data mapper, skip if none exists
       vtkPolyDataMapper* pdMapper = vtkPolyDataMapper::SafeDownCast(actor->GetMapper());
       if (pdMapper == nullptr)
@@ -466,8 +489,10 @@ std::string vtkF3DMetaImporter::GetOutputsDescription()
 {
   std::string description =
     "Number of files: " + std::to_string(this->Pimpl->Importers.size()) + "\n";
-  description +=
-    "Number of actors: " + std::to_string(this->ActorCollection->GetNumberOfItems()) + "\n";
+  description += "Number of actors: " +
+    std::to_string(
+      this->ActorCollection->GetNumberOfItems() + this->Pimpl->InstancedActors.size()) +
+    "\n";
   description += std::accumulate(this->Pimpl->Importers.begin(), this->Pimpl->Importers.end(),
     std::string(), [](const std::string& a, const auto& importerInfo)
     { return a + "----------\n" + importerInfo.Importer->GetOutputsDescription(); });
@@ -770,6 +795,12 @@ void vtkF3DMetaImporter::UpdateInfoForColoring()
       actorCollection->InitTraversal(ait);
       while (auto* actor = actorCollection->GetNextActor(ait))
       {
+        if (vtkGlyph3DMapper::SafeDownCast(actor->GetMapper()))
+        {
+          // Instanced actors are not colored
+          continue;
+        }
+
         vtkPolyDataMapper* pdMapper = vtkPolyDataMapper::SafeDownCast(actor->GetMapper());
         // Check for actor's poly data mapper, skip if none exists
         if (pdMapper == nullptr)
@@ -815,7 +846,8 @@ std::string vtkF3DMetaImporter::GetMetaDataDescription() const
   }
 
   description += "Number of actors: ";
-  description += std::to_string(this->ActorCollection->GetNumberOfItems());
+  description += std::to_string(
+    this->ActorCollection->GetNumberOfItems() + this->Pimpl->InstancedActors.size());
   description += "\n";
 
   vtkIdType nPoints = 0;
@@ -829,6 +861,25 @@ std::string vtkF3DMetaImporter::GetMetaDataDescription() const
     nCells += surface->GetNumberOfCells();
   }
 
+  // Instanced actors count once per instance
+  vtkIdType nInstances = 0;
+  for (vtkActor* actor : this->Pimpl->InstancedActors)
+  {
+    vtkGlyph3DMapper* glyphMapper = vtkGlyph3DMapper::SafeDownCast(actor->GetMapper());
+    vtkPolyData* source = glyphMapper->GetSource();
+    const vtkIdType count = glyphMapper->GetInputAsDataSet()->GetNumberOfPoints();
+    nPoints += source->GetNumberOfPoints() * count;
+    nCells += source->GetNumberOfCells() * count;
+    nInstances += count;
+  }
+
+  if (nInstances > 0)
+  {
+    description += "Number of instances: ";
+    description += std::to_string(nInstances);
+    description += "\n";
+  }
+
   description += "Number of points: ";
   description += std::to_string(nPoints);
   description += "\n";
@@ -849,3 +900,9 @@ vtkMTimeType vtkF3DMetaImporter::GetUpdateMTime()
 {
   return this->Pimpl->UpdateTime.GetMTime();
 }
+
+//----------------------------------------------------------------------------
+double vtkF3DMetaImporter::GetImportersUpdateDuration()
+{
+  return this->Pimpl->ImportersUpdateDuration;
+}
@@ -205,6 +205,12 @@ public:
    */
   vtkMTimeType GetUpdateMTime();
 
+  /**
+   * Get the time spent, in seconds, in the Update of the individual importers
+   * during the last call to Update
+   */
+  double GetImportersUpdateDuration();
+
 protected:
   vtkF3DMetaImporter();
   ~vtkF3DMetaImporter() override;
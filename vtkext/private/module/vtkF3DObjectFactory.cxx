@@ -11,6 +11,10 @@
 #include <vtkF3DConsoleOutputWindow.h>
 #endif
 
+#if F3D_MODULE_KTX
+#include "vtkF3DKTXTexture.h"
+#endif
+
 #if F3D_MODULE_UI
 #include "vtkF3DImguiActor.h"
 #include "vtkF3DImguiConsole.h"
@@ -38,6 +42,11 @@ vtkF3DObjectFactory::vtkF3DObjectFactory()
   this->RegisterOverride("vtkPointGaussianMapper", "vtkF3DPointSplatMapper",
     "vtkPointGaussianMapper override for F3D", 1, ::Factory<vtkF3DPointSplatMapper>);
 
+#if F3D_MODULE_KTX
+  this->RegisterOverride("vtkTexture", "vtkF3DKTXTexture", "vtkTexture override for F3D", 1,
+    ::Factory<vtkF3DKTXTexture>);
+#endif
+
 #ifdef __ANDROID__
   this->RegisterOverride("vtkOutputWindow", "vtkF3DAndroidLogOutputWindow",
     "vtkOutputWindow override for F3D", 1, ::Factory<vtkF3DAndroidLogOutputWindow>);
@@ -1,25 +1,40 @@
 #include "vtkF3DPolyDataMapper.h"
 
 #include "F3DLog.h"
+#include "vtkF3DMemoryMesh.h"
+
+#if F3D_MODULE_KTX
+#include "vtkF3DKTXTexture.h"
+#endif
 
 #include <vtkActor.h>
+#include <vtkCellArray.h>
+#include <vtkCellData.h>
 #include <vtkDoubleArray.h>
+#include <vtkFieldData.h>
+#include <vtkFloatArray.h>
 #include <vtkMatrix4x4.h>
 #include <vtkObjectFactory.h>
+#include <vtkOpenGLBufferObject.h>
 #include <vtkOpenGLRenderWindow.h>
 #include <vtkOpenGLRenderer.h>
 #include <vtkOpenGLUniforms.h>
 #include <vtkOpenGLVertexBufferObject.h>
 #include <vtkOpenGLVertexBufferObjectGroup.h>
 #include <vtkPointData.h>
+#include <vtkPoints.h>
 #include <vtkPolyData.h>
 #include <vtkProperty.h>
+#include <vtkSMPTools.h>
 #include <vtkShaderProgram.h>
 #include <vtkShaderProperty.h>
 #include <vtkTexture.h>
 #include <vtkUniforms.h>
 #include <vtkVersion.h>
+#include <vtk_glad.h>
 
+#include <algorithm>
+#include <array>
 #include <regex>
 
 vtkStandardNewMacro(vtkF3DPolyDataMapper);
@@ -75,6 +90,54 @@ void vtkF3DPolyDataMapper::ReplaceShaderValues(
       }
     }
   }
+
+  const std::vector<std::string> upsideDown = this->GetUpsideDownTextures(actor);
+  if (!upsideDown.empty())
+  {
+    auto fragmentShader = shaders[vtkShader::Fragment];
+    auto FSSource = fragmentShader->GetSource();
+    for (const std::string& name : upsideDown)
+    {
+      std::regex regex("texture\\(\\s*" + name + "\\s*,\\s*tcoordVCVSOutput\\b");
+      FSSource = std::regex_replace(FSSource, regex,
+        "texture(" + name + ", vec2(tcoordVCVSOutput.x, 1.0 - tcoordVCVSOutput.y)");
+    }
+    fragmentShader->SetSource(FSSource);
+  }
+}
+
+//-----------------------------------------------------------------------------
+bool vtkF3DPolyDataMapper::GetNeedToRebuildShaders(
+  vtkOpenGLHelper& cellBO, vtkRenderer* ren, vtkActor* act)
+{
+  // textures are loaded before rendering the mapper, so their state is known here
+  std::vector<std::string> upsideDown = this->GetUpsideDownTextures(act);
+  if (upsideDown != this->UpsideDownTextures)
+  {
+    this->UpsideDownTextures = std::move(upsideDown);
+    this->UpsideDownTexturesTime.Modified();
+  }
+
+  return cellBO.ShaderSourceTime < this->UpsideDownTexturesTime ||
+    this->Superclass::GetNeedToRebuildShaders(cellBO, ren, act);
+}
+
+//-----------------------------------------------------------------------------
+std::vector<std::string> vtkF3DPolyDataMapper::GetUpsideDownTextures(
+  [[maybe_unused]] vtkActor* act)
+{
+  std::vector<std::string> names;
+#if F3D_MODULE_KTX
+  for (const auto& [texture, name] : this->GetTextures(act))
+  {
+    vtkF3DKTXTexture* ktxTexture = vtkF3DKTXTexture::SafeDownCast(texture);
+    if (ktxTexture && ktxTexture->IsUpsideDown())
+    {
+      names.emplace_back(name);
+    }
+  }
+#endif
+  return names;
 }
 
 //-----------------------------------------------------------------------------
@@ -92,6 +155,193 @@ void vtkF3DPolyDataMapper::SetCustomUniforms(vtkOpenGLHelper& cellBO, vtkActor*
     this->JointMatrices->Upload(buffer, vtkOpenGLBufferObject::ArrayBuffer);
     this->JointMatrices->BindShaderStorage(0);
   }
+
+  if (this->HasBlendShapeOffsets && cellBO.Program->IsUniformUsed("blendShapeOffsets"))
+  {
+    cellBO.Program->SetUniformi(
+      "blendShapeOffsets", this->BlendShapeOffsetsTexture->GetTextureUnit());
+  }
+  if (cellBO.Program->IsUniformUsed("useBlendShapeOffsets"))
+  {
+    cellBO.Program->SetUniformi("useBlendShapeOffsets", this->HasBlendShapeOffsets ? 1 : 0);
+  }
+}
+
+//-----------------------------------------------------------------------------
+bool vtkF3DPolyDataMapper::ActivateBlendShapeOffsets(vtkRenderer* ren)
+{
+  vtkPolyData* input = this->CurrentInput;
+  vtkFieldData* fieldData = input ? input->GetFieldData() : nullptr;
+  vtkDataArray* offsets = fieldData ? fieldData->GetArray("BlendShapeOffsets") : nullptr;
+  vtkDataArray* ranges = fieldData ? fieldData->GetArray("BlendShapeRanges") : nullptr;
+  vtkOpenGLRenderWindow* renWin = vtkOpenGLRenderWindow::SafeDownCast(ren->GetRenderWindow());
+  if (!offsets || !ranges || !renWin)
+  {
+    this->BlendShapesOnCPU = false;
+    return false;
+  }
+
+  // offsets are static, only upload them when the array changes
+  if (offsets != this->BlendShapeOffsetsArray ||
+    std::max(offsets->GetMTime(), ranges->GetMTime()) > this->BlendShapeOffsetsTime)
+  {
+    this->BlendShapeOffsetsArray = offsets;
+    this->BlendShapeOffsetsTime = std::max(offsets->GetMTime(), ranges->GetMTime());
+
+    const size_t nbRangeValues =
+      static_cast<size_t>(ranges->GetNumberOfTuples()) * ranges->GetNumberOfComponents();
+    const size_t nbValues = nbRangeValues +
+      static_cast<size_t>(offsets->GetNumberOfTuples()) * offsets->GetNumberOfComponents();
+
+    // offset indices are stored as floats, which are exact up to 2^24
+    GLint maxSize = 0;
+    glGetIntegerv(GL_MAX_TEXTURE_BUFFER_SIZE, &maxSize);
+    if (this->MaximumBlendShapeOffsetsSize > 0)
+    {
+      maxSize = static_cast<GLint>(
+        std::min<vtkIdType>(maxSize, this->MaximumBlendShapeOffsetsSize));
+    }
+    this->BlendShapesOnCPU =
+      nbValues > static_cast<size_t>(maxSize) || offsets->GetNumberOfTuples() > (1 << 24);
+    if (this->BlendShapesOnCPU)
+    {
+      std::string msg = "Blend shape offsets are too large for the GPU (" +
+        std::to_string(nbValues) + " values), blend shapes are applied on the CPU";
+      F3DLog::Print(F3DLog::Severity::Debug, msg);
+      this->BlendShapeOffsetsTexture->ReleaseGraphicsResources(renWin);
+      return false;
+    }
+
+    std::vector<float> buffer(nbValues);
+    for (vtkDataArray* array : { ranges, offsets })
+    {
+      const size_t start = array == ranges ? 0 : nbRangeValues;
+      const size_t size = array == ranges ? nbRangeValues : nbValues - nbRangeValues;
+      vtkFloatArray* floatArray = vtkFloatArray::FastDownCast(array);
+      if (floatArray)
+      {
+        std::copy_n(floatArray->GetPointer(0), size, buffer.begin() + start);
+      }
+      else
+      {
+        for (size_t i = 0; i < size; i++)
+        {
+          buffer[start + i] = static_cast<float>(array->GetVariantValue(i).ToDouble());
+        }
+      }
+    }
+
+    this->BlendShapeOffsetsTexture->SetContext(renWin);
+    this->BlendShapeOffsets->Upload(buffer, vtkOpenGLBufferObject::TextureBuffer);
+    this->BlendShapeOffsetsTexture->CreateTextureBuffer(
+      static_cast<unsigned int>(nbValues), 1, VTK_FLOAT, this->BlendShapeOffsets);
+  }
+  else if (this->BlendShapesOnCPU)
+  {
+    return false;
+  }
+
+  this->BlendShapeOffsetsTexture->Activate();
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+vtkPolyData* vtkF3DPolyDataMapper::DeformBlendShapes(vtkActor* act)
+{
+  vtkPolyData* input = this->CurrentInput;
+  vtkFloatArray* offsets =
+    vtkFloatArray::SafeDownCast(input->GetFieldData()->GetArray("BlendShapeOffsets"));
+  vtkFloatArray* ranges =
+    vtkFloatArray::SafeDownCast(input->GetFieldData()->GetArray("BlendShapeRanges"));
+  vtkUniforms* uniforms = act->GetShaderProperty()->GetVertexCustomUniforms();
+  std::vector<float> weights;
+  if (!offsets || !ranges || !input->GetPoints() ||
+    ranges->GetNumberOfTuples() != input->GetNumberOfPoints() ||
+    !uniforms->GetUniform4fv("blendShapeWeights", weights))
+  {
+    return input;
+  }
+
+  // only deform again when the input or the weights change
+  if (input == this->DeformedSource && input->GetMTime() <= this->DeformedInput->GetMTime() &&
+    weights == this->DeformedWeights)
+  {
+    return this->DeformedInput;
+  }
+
+  vtkPoints* bindPoints = input->GetPoints();
+  vtkNew<vtkPoints> points;
+  points->SetDataTypeToFloat();
+  points->SetNumberOfPoints(input->GetNumberOfPoints());
+
+  const float* range = ranges->GetPointer(0);
+  const float* offset = offsets->GetPointer(0);
+  const vtkIdType nbOffsets = offsets->GetNumberOfTuples();
+  vtkSMPTools::For(0, input->GetNumberOfPoints(),
+    [&](vtkIdType begin, vtkIdType end)
+    {
+      for (vtkIdType i = begin; i < end; i++)
+      {
+        double p[3];
+        bindPoints->GetPoint(i, p);
+        const vtkIdType first = static_cast<vtkIdType>(range[2 * i]);
+        const vtkIdType count = static_cast<vtkIdType>(range[2 * i + 1]);
+        const vtkIdType last = std::min(first + count, nbOffsets);
+        for (vtkIdType j = first; j < last; j++)
+        {
+          const float* value = offset + 4 * j;
+          const size_t sub = static_cast<size_t>(value[0]);
+          const double w = sub < weights.size() ? weights[sub] : 0.0;
+          p[0] += w * value[1];
+          p[1] += w * value[2];
+          p[2] += w * value[3];
+        }
+        points->SetPoint(i, p);
+      }
+    });
+
+  this->DeformedInput->ShallowCopy(input);
+  this->DeformedInput->SetPoints(points);
+  this->DeformedSource = input;
+  this->DeformedWeights = std::move(weights);
+  return this->DeformedInput;
+}
+
+//-----------------------------------------------------------------------------
+void vtkF3DPolyDataMapper::RenderPieceStart(vtkRenderer* ren, vtkActor* act)
+{
+  this->HasBlendShapeOffsets = this->ActivateBlendShapeOffsets(ren);
+  if (this->BlendShapesOnCPU)
+  {
+    // render a deformed copy of the input instead
+    this->CurrentInput = this->DeformBlendShapes(act);
+  }
+
+  this->Superclass::RenderPieceStart(ren, act);
+}
+
+//-----------------------------------------------------------------------------
+void vtkF3DPolyDataMapper::RenderPieceFinish(vtkRenderer* ren, vtkActor* act)
+{
+  if (this->HasBlendShapeOffsets)
+  {
+    this->BlendShapeOffsetsTexture->Deactivate();
+    this->HasBlendShapeOffsets = false;
+  }
+
+  this->Superclass::RenderPieceFinish(ren, act);
+}
+
+//-----------------------------------------------------------------------------
+void vtkF3DPolyDataMapper::ReleaseGraphicsResources(vtkWindow* win)
+{
+  this->BlendShapeOffsetsTexture->ReleaseGraphicsResources(win);
+  this->BlendShapeOffsets->ReleaseGraphicsResources();
+  this->BlendShapeOffsetsArray = nullptr;
+  this->BlendShapeOffsetsTime = 0;
+  this->BlendShapesOnCPU = false;
+
+  this->Superclass::ReleaseGraphicsResources(win);
 }
 
 //-----------------------------------------------------------------------------
@@ -145,3 +395,195 @@ void vtkF3DPolyDataMapper::ReplaceShaderLight(
 
   this->Superclass::ReplaceShaderLight(shaders, ren, actor);
 }
+
+//-----------------------------------------------------------------------------
+bool vtkF3DPolyDataMapper::GetNeedToRebuildBufferObjects(vtkRenderer* ren, vtkActor* act)
+{
+  if (this->UploadModifiedRanges(act))
+  {
+    // keep the superclass build state in sync with the modified input, without rebuilding
+    this->Superclass::GetNeedToRebuildBufferObjects(ren, act);
+    this->VBOBuildTime.Modified();
+    return false;
+  }
+
+  return this->Superclass::GetNeedToRebuildBufferObjects(ren, act);
+}
+
+//-----------------------------------------------------------------------------
+void vtkF3DPolyDataMapper::BuildBufferObjects(vtkRenderer* ren, vtkActor* act)
+{
+  this->Superclass::BuildBufferObjects(ren, act);
+
+  vtkPolyData* input = this->CurrentInput;
+  this->BuiltInput = input;
+  this->BuiltPoints = input && input->GetPoints() ? input->GetPoints()->GetData() : nullptr;
+  this->BuiltNormals = input ? input->GetPointData()->GetNormals() : nullptr;
+  this->BuiltTCoords = input ? input->GetPointData()->GetTCoords() : nullptr;
+  this->BuiltNumberOfPointArrays = input ? input->GetPointData()->GetNumberOfArrays() : 0;
+  this->BuiltNumberOfCellArrays = input ? input->GetCellData()->GetNumberOfArrays() : 0;
+  this->BuiltPropertyMTime = act->GetProperty()->GetMTime();
+  this->BuiltTextureMTime = act->GetTexture() ? act->GetTexture()->GetMTime() : 0;
+}
+
+//-----------------------------------------------------------------------------
+bool vtkF3DPolyDataMapper::UploadModifiedRanges(vtkActor* act)
+{
+  vtkPolyData* input = this->CurrentInput;
+  const vtkMTimeType buildTime = this->VBOBuildTime.GetMTime();
+  if (!input || buildTime == 0 || input != this->BuiltInput || this->GetMTime() > buildTime)
+  {
+    return false;
+  }
+
+  // anything else than the vertex attributes changing requires a full build
+  const vtkMTimeType textureMTime = act->GetTexture() ? act->GetTexture()->GetMTime() : 0;
+  if (act->GetProperty()->GetMTime() != this->BuiltPropertyMTime ||
+    textureMTime != this->BuiltTextureMTime)
+  {
+    return false;
+  }
+
+  for (vtkCellArray* cells : { input->GetVerts(), input->GetLines(), input->GetPolys(),
+         input->GetStrips() })
+  {
+    if (cells && cells->GetMTime() > buildTime)
+    {
+      return false;
+    }
+  }
+
+  vtkDataArray* points = input->GetPoints() ? input->GetPoints()->GetData() : nullptr;
+  vtkPointData* pointData = input->GetPointData();
+  vtkCellData* cellData = input->GetCellData();
+  if (points != this->BuiltPoints || pointData->GetNormals() != this->BuiltNormals ||
+    pointData->GetTCoords() != this->BuiltTCoords ||
+    pointData->GetNumberOfArrays() != this->BuiltNumberOfPointArrays ||
+    cellData->GetNumberOfArrays() != this->BuiltNumberOfCellArrays)
+  {
+    return false;
+  }
+
+  for (int i = 0; i < pointData->GetNumberOfArrays(); i++)
+  {
+    vtkAbstractArray* array = pointData->GetAbstractArray(i);
+    if (array != this->BuiltNormals && array != this->BuiltTCoords &&
+      array->GetMTime() > buildTime)
+    {
+      return false;
+    }
+  }
+
+  for (int i = 0; i < cellData->GetNumberOfArrays(); i++)
+  {
+    if (cellData->GetAbstractArray(i)->GetMTime() > buildTime)
+    {
+      return false;
+    }
+  }
+
+  struct upload_t
+  {
+    vtkDataArray* Array;
+    vtkOpenGLVertexBufferObject* VBO;
+    std::vector<std::pair<vtkIdType, vtkIdType>> Ranges;
+  };
+  std::vector<upload_t> uploads;
+
+  using attribute_t = std::pair<vtkDataArray*, const char*>;
+  const std::array<attribute_t, 3> attributes = { attribute_t{ points, "vertexMC" },
+    attribute_t{ this->BuiltNormals, "normalMC" }, attribute_t{ this->BuiltTCoords, "tcoord" } };
+  for (const auto& [array, vboName] : attributes)
+  {
+    if (!array || array->GetMTime() <= buildTime)
+    {
+      continue;
+    }
+
+    vtkOpenGLVertexBufferObject* vbo = this->VBOs->GetVBO(vboName);
+    if (!vbo)
+    {
+      // not uploaded, nothing to update
+      continue;
+    }
+
+    const int nbComps = array->GetNumberOfComponents();
+    if (vbo->GetDataType() != VTK_FLOAT || vbo->GetNumberOfComponents() != nbComps ||
+      vbo->GetNumberOfTuples() != array->GetNumberOfTuples() ||
+      vbo->GetStride() != static_cast<int>(nbComps * sizeof(float)))
+    {
+      return false;
+    }
+
+    std::vector<std::pair<vtkIdType, vtkIdType>> ranges;
+    if (!vtkF3DMemoryMesh::GetModifiedRanges(array, buildTime, ranges))
+    {
+      return false;
+    }
+
+    // merge overlapping ranges so each tuple is uploaded once
+    std::ranges::sort(ranges);
+    std::vector<std::pair<vtkIdType, vtkIdType>> merged;
+    vtkIdType modifiedCount = 0;
+    for (const auto& range : ranges)
+    {
+      if (!merged.empty() && range.first <= merged.back().second)
+      {
+        merged.back().second = std::max(merged.back().second, range.second);
+      }
+      else
+      {
+        merged.push_back(range);
+      }
+    }
+    for (const auto& [begin, end] : merged)
+    {
+      modifiedCount += end - begin;
+    }
+
+    // a full upload is as efficient when most of the array changed
+    if (2 * modifiedCount > array->GetNumberOfTuples())
+    {
+      return false;
+    }
+
+    uploads.push_back({ array, vbo, std::move(merged) });
+  }
+
+  if (uploads.empty())
+  {
+    return false;
+  }
+
+  std::vector<float> buffer;
+  for (const upload_t& upload : uploads)
+  {
+    const int nbComps = upload.Array->GetNumberOfComponents();
+    const bool shiftScale = upload.VBO->GetCoordShiftAndScaleEnabled();
+    const std::vector<double>& shift = upload.VBO->GetShift();
+    const std::vector<double>& scale = upload.VBO->GetScale();
+
+    upload.VBO->Bind();
+    for (const auto& [begin, end] : upload.Ranges)
+    {
+      buffer.resize(static_cast<size_t>(end - begin) * nbComps);
+      for (vtkIdType t = begin; t < end; t++)
+      {
+        for (int c = 0; c < nbComps; c++)
+        {
+          double value = upload.Array->GetComponent(t, c);
+          if (shiftScale)
+          {
+            value = (value - shift[c]) * scale[c];
+          }
+          buffer[static_cast<size_t>(t - begin) * nbComps + c] = static_cast<float>(value);
+        }
+      }
+
+      glBufferSubData(GL_ARRAY_BUFFER, static_cast<GLintptr>(begin * upload.VBO->GetStride()),
+        static_cast<GLsizeiptr>(buffer.size() * sizeof(float)), buffer.data());
+    }
+  }
+
+  return true;
+}
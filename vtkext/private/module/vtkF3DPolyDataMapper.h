@@ -2,7 +2,11 @@
  * @class   vtkF3DPolyDataMapper
  * @brief   Custom surface mapper used to include F3D features
  *
- * This mapper is used to add support for SSBO skinning and
+ * This mapper is used to add support for SSBO skinning,
+ * sparse blend shape offsets stored in a texture buffer (see "BlendShapeOffsets" and
+ * "BlendShapeRanges" field data arrays), applied on the CPU when too large for the GPU,
+ * partial upload of arrays modified in place (see vtkF3DMemoryMesh::MODIFIED_RANGES),
+ * flipped sampling of compressed textures stored from top to bottom (see vtkF3DKTXTexture) and
  * backward compatibility with old VTK versions for unlit materials.
  */
 
@@ -10,8 +14,15 @@
 #define vtkF3DPolyDataMapper_h
 
 #include <vtkOpenGLPolyDataMapper.h>
+#include <vtkPolyData.h>
+#include <vtkTextureObject.h>
 #include <vtkVersion.h>
 
+#include <string>
+#include <vector>
+
+class vtkDataArray;
+
 class vtkF3DPolyDataMapper : public vtkOpenGLPolyDataMapper
 {
 public:
@@ -19,7 +30,8 @@ public:
   vtkTypeMacro(vtkF3DPolyDataMapper, vtkOpenGLPolyDataMapper);
 
   /**
-   * Modify the shaders to include skinning and morphing capabilities
+   * Modify the shaders to include skinning and morphing capabilities,
+   * and flip the V texture coordinate of upside down textures
    */
   void ReplaceShaderValues(
     std::map<vtkShader::Type, vtkShader*> shaders, vtkRenderer* ren, vtkActor* actor) override;
@@ -35,17 +47,91 @@ public:
   ///@}
 
   /**
-   * Set the SSBO for skinning if needed
+   * Set the SSBO for skinning and the blend shape offsets texture buffer if needed
    */
   void SetCustomUniforms(vtkOpenGLHelper& cellBO, vtkActor* actor) override;
 
+  ///@{
+  /**
+   * Activate the blend shape offsets texture buffer if needed, uploading it on first use.
+   * When it does not fit in a texture buffer, the blend shapes are applied to a copy of the input
+   * which is rendered instead.
+   */
+  void RenderPieceStart(vtkRenderer* ren, vtkActor* act) override;
+  void RenderPieceFinish(vtkRenderer* ren, vtkActor* act) override;
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the maximum number of values of the blend shape offsets texture buffer.
+   * Larger blend shapes are applied on the CPU.
+   * Default is 0, which uses the GL_MAX_TEXTURE_BUFFER_SIZE of the GPU.
+   */
+  vtkSetMacro(MaximumBlendShapeOffsetsSize, vtkIdType);
+  vtkGetMacro(MaximumBlendShapeOffsetsSize, vtkIdType);
+  ///@}
+
+  /**
+   * Release the blend shape offsets texture buffer
+   */
+  void ReleaseGraphicsResources(vtkWindow* win) override;
+
 protected:
   vtkF3DPolyDataMapper() = default;
   ~vtkF3DPolyDataMapper() override = default;
 
+  /**
+   * Also rebuild the shaders when the upside down textures change
+   */
+  bool GetNeedToRebuildShaders(vtkOpenGLHelper& cellBO, vtkRenderer* ren, vtkActor* act) override;
+
+  /**
+   * Upload only the modified ranges of the point coordinates, normals and texture coordinates
+   * when they are the only changes since the last build, otherwise defer to the superclass
+   */
+  bool GetNeedToRebuildBufferObjects(vtkRenderer* ren, vtkActor* act) override;
+
+  /**
+   * Record the state used to check if a partial upload is possible on next render
+   */
+  void BuildBufferObjects(vtkRenderer* ren, vtkActor* act) override;
+
 private:
+  std::vector<std::string> GetUpsideDownTextures(vtkActor* act);
+  bool UploadModifiedRanges(vtkActor* act);
+  bool ActivateBlendShapeOffsets(vtkRenderer* ren);
+  vtkPolyData* DeformBlendShapes(vtkActor* act);
+
   vtkNew<vtkOpenGLBufferObject> JointMatrices;
   bool HasSSBOSkinning = false;
+
+  // Blend shape offsets are only uploaded when the field data array is modified
+  vtkNew<vtkOpenGLBufferObject> BlendShapeOffsets;
+  vtkNew<vtkTextureObject> BlendShapeOffsetsTexture;
+  vtkDataArray* BlendShapeOffsetsArray = nullptr;
+  vtkMTimeType BlendShapeOffsetsTime = 0;
+  bool HasBlendShapeOffsets = false;
+  bool BlendShapesOnCPU = false;
+  vtkIdType MaximumBlendShapeOffsetsSize = 0;
+
+  // Input deformed on the CPU with the weights it was computed with
+  vtkNew<vtkPolyData> DeformedInput;
+  vtkPolyData* DeformedSource = nullptr;
+  std::vector<float> DeformedWeights;
+
+  // Names of the textures sampled with a flipped V, changed at UpsideDownTexturesTime
+  std::vector<std::string> UpsideDownTextures;
+  vtkTimeStamp UpsideDownTexturesTime;
+
+  // State of the last full build, only used for comparison
+  vtkPolyData* BuiltInput = nullptr;
+  vtkDataArray* BuiltPoints = nullptr;
+  vtkDataArray* BuiltNormals = nullptr;
+  vtkDataArray* BuiltTCoords = nullptr;
+  int BuiltNumberOfPointArrays = 0;
+  int BuiltNumberOfCellArrays = 0;
+  vtkMTimeType BuiltPropertyMTime = 0;
+  vtkMTimeType BuiltTextureMTime = 0;
 };
 
 #endif
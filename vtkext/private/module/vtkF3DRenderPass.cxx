@@ -1,5 +1,6 @@
 #include "vtkF3DRenderPass.h"
 
+#include "vtkF3DCullingPass.h"
 #include "vtkF3DHexagonalBokehBlurPass.h"
 #include "vtkF3DImporter.h"
 #include "vtkF3DOpenGLGridMapper.h"
@@ -11,6 +12,7 @@
 #include <vtkCamera.h>
 #include <vtkCameraPass.h>
 #include <vtkDualDepthPeelingPass.h>
+#include <vtkFieldData.h>
 #include <vtkInformation.h>
 #include <vtkInformationIntegerKey.h>
 #include <vtkInteractorObserver.h>
@@ -23,6 +25,7 @@
 #include <vtkOpenGLShaderCache.h>
 #include <vtkOpenGLState.h>
 #include <vtkOpenGLVertexBufferObjectGroup.h>
+#include <vtkOrderIndependentTranslucentPass.h>
 #include <vtkOverlayPass.h>
 #include <vtkPointData.h>
 #include <vtkProp.h>
@@ -41,7 +44,9 @@
 #include <vtkTranslucentPass.h>
 #include <vtkUniforms.h>
 #include <vtkVersion.h>
+#include <vtkVolume.h>
 #include <vtkVolumetricPass.h>
+#include <vtk_glad.h>
 
 #if F3D_MODULE_RAYTRACING
 #include <vtkOSPRayPass.h>
@@ -61,6 +66,7 @@ void vtkF3DRenderPass::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "UseSSAOPass: " << this->UseSSAOPass << "\n";
   os << indent << "UseBlurBackground: " << this->UseBlurBackground << "\n";
   os << indent << "ForceOpaqueBackground: " << this->ForceOpaqueBackground << "\n";
+  os << indent << "UseCulling: " << this->UseCulling << "\n";
 }
 
 // ----------------------------------------------------------------------------
@@ -86,6 +92,14 @@ void vtkF3DRenderPass::ReleaseGraphicsResources(vtkWindow* w)
   {
     this->MainOnTopPass->ReleaseGraphicsResources(w);
   }
+#if !defined(__ANDROID__) && !defined(__EMSCRIPTEN__)
+  if (!this->TimestampQueries.empty())
+  {
+    glDeleteQueries(
+      static_cast<GLsizei>(this->TimestampQueries.size()), this->TimestampQueries.data());
+    this->TimestampQueries.clear();
+  }
+#endif
 }
 
 // ----------------------------------------------------------------------------
@@ -98,10 +112,12 @@ void vtkF3DRenderPass::Initialize(const vtkRenderState* s)
   this->ReflectionProps.clear();
 
   // assign props to the correct pass
+  bool hasVolume = false;
   vtkProp** props = s->GetPropArray();
   for (int i = 0; i < s->GetPropArrayCount(); i++)
   {
     vtkProp* prop = props[i];
+    hasVolume = hasVolume || vtkVolume::SafeDownCast(prop) != nullptr;
     if (vtkSkybox::SafeDownCast(prop))
     {
       this->BackgroundProps.push_back(prop);
@@ -190,16 +206,22 @@ void vtkF3DRenderPass::Initialize(const vtkRenderState* s)
     }
   }
 
-  if (this->InitializeTime == this->MTime)
+  // weighted blending falls back to dual depth peeling when a volume is visible
+  vtkOpenGLRenderer* glRenderer = vtkOpenGLRenderer::SafeDownCast(s->GetRenderer());
+  const vtkF3DRenderer* renderer = vtkF3DRenderer::SafeDownCast(glRenderer);
+  const bool weighted =
+    renderer && renderer->GetBlendingMode() == vtkF3DRenderer::BlendingMode::WEIGHTED;
+  if (this->InitializeTime == this->MTime &&
+    (!weighted || hasVolume == this->InitializedWithVolume))
   {
     // already initialized
     return;
   }
 
-  vtkOpenGLRenderer* glRenderer = vtkOpenGLRenderer::SafeDownCast(s->GetRenderer());
   this->LightComplexity = glRenderer->GetLightingComplexity();
 
   this->ReleaseGraphicsResources(glRenderer->GetRenderWindow());
+  this->CullingPass = nullptr;
 
   // background pass, setup framebuffer, clear and draw skybox
   vtkNew<vtkOpaquePass> bgP;
@@ -267,22 +289,48 @@ void vtkF3DRenderPass::Initialize(const vtkRenderState* s)
       collection->AddItem(opaqueP);
     }
 
+    // occlusion queries are tested against the opaque depth, before translucent props
+    if (this->UseCulling)
+    {
+      this->CullingPass = vtkSmartPointer<vtkF3DCullingPass>::New();
+      collection->AddItem(this->CullingPass);
+    }
+
     // translucent and volumic
-    const vtkF3DRenderer* renderer = vtkF3DRenderer::SafeDownCast(glRenderer);
-    if (renderer && renderer->GetBlendingMode() == vtkF3DRenderer::BlendingMode::DUAL_DEPTH_PEELING)
+    // weighted blended OIT cannot composite volumes with the translucent layers, dual depth
+    // peeling is used instead when a volume is visible
+    vtkF3DRenderer::BlendingMode blendingMode =
+      renderer ? renderer->GetBlendingMode() : vtkF3DRenderer::BlendingMode::NONE;
+    if (blendingMode == vtkF3DRenderer::BlendingMode::WEIGHTED && hasVolume)
+    {
+      blendingMode = vtkF3DRenderer::BlendingMode::DUAL_DEPTH_PEELING;
+    }
+
+    if (blendingMode == vtkF3DRenderer::BlendingMode::DUAL_DEPTH_PEELING)
     {
       vtkNew<vtkDualDepthPeelingPass> ddpP;
       ddpP->SetTranslucentPass(translucentP);
       ddpP->SetVolumetricPass(volumeP);
       collection->AddItem(ddpP);
     }
-    else if (renderer && renderer->GetBlendingMode() == vtkF3DRenderer::BlendingMode::STOCHASTIC)
+    else if (blendingMode == vtkF3DRenderer::BlendingMode::STOCHASTIC)
     {
       vtkNew<vtkF3DStochasticTransparentPass> stochasticP;
       stochasticP->SetTranslucentPass(translucentP);
       stochasticP->SetVolumetricPass(volumeP);
       collection->AddItem(stochasticP);
     }
+    else if (blendingMode == vtkF3DRenderer::BlendingMode::WEIGHTED)
+    {
+      // weighted blended OIT, single geometry pass followed by a resolve
+      vtkNew<vtkOrderIndependentTranslucentPass> oitP;
+      oitP->SetTranslucentPass(translucentP);
+      collection->AddItem(oitP);
+
+      // volumes are rendered after the resolve until the passes are initialized again without
+      // weighted blending, which happens as soon as a volume is visible
+      collection->AddItem(volumeP);
+    }
     else
     {
       collection->AddItem(translucentP);
@@ -368,6 +416,7 @@ void vtkF3DRenderPass::Initialize(const vtkRenderState* s)
   }
 
   this->InitializeTime = this->GetMTime();
+  this->InitializedWithVolume = hasVolume;
 }
 
 // ----------------------------------------------------------------------------
@@ -413,7 +462,15 @@ void vtkF3DRenderPass::ReplaceSkinningMorphing(
     bool hasSkinning =
       uniforms->GetUniformTupleType("jointMatrices") != vtkUniforms::TupleTypeInvalid;
 
-    if (hasMorphing || hasSkinning)
+    // blend shape offsets are stored in a texture buffer by vtkF3DPolyDataMapper
+    vtkFieldData* fieldData = polyData->GetFieldData();
+    vtkIdType nbPoints = polyData->GetNumberOfPoints();
+    bool hasBlendShapes =
+      uniforms->GetUniformTupleType("blendShapeWeights") != vtkUniforms::TupleTypeInvalid &&
+      fieldData->GetArray("BlendShapeOffsets") && fieldData->GetArray("BlendShapeRanges") &&
+      nbPoints > 0;
+
+    if (hasMorphing || hasSkinning || hasBlendShapes)
     {
       bool hasTangents =
         polyData->GetPointData()->GetTangents() && actor->GetProperty()->GetLighting();
@@ -479,6 +536,32 @@ void vtkF3DRenderPass::ReplaceSkinningMorphing(
         }
       }
 
+      // blend shapes, only weights are updated each frame
+      // the texture buffer contains the (first offset, number of offsets) of each point followed
+      // by the (sub-shape, x, y, z) offsets, it is not used when the mapper deforms on the CPU
+      if (hasBlendShapes)
+      {
+        std::string offsetsStart = std::to_string(2 * nbPoints);
+
+        customDecl += "uniform samplerBuffer blendShapeOffsets;\n"
+                      "uniform int useBlendShapeOffsets;\n";
+
+        posImpl += "  if (useBlendShapeOffsets != 0)\n"
+                   "  {\n"
+                   "    int first = int(texelFetch(blendShapeOffsets, 2 * gl_VertexID).r);\n"
+                   "    int count = int(texelFetch(blendShapeOffsets, 2 * gl_VertexID + 1).r);\n"
+                   "    for (int j = first; j < first + count; j++)\n"
+                   "    {\n"
+                   "      int id = " + offsetsStart + " + 4 * j;\n"
+                   "      int i = int(texelFetch(blendShapeOffsets, id).r);\n"
+                   "      posMC.xyz += blendShapeWeights[i / 4][i % 4] *\n"
+                   "        vec3(texelFetch(blendShapeOffsets, id + 1).r,\n"
+                   "          texelFetch(blendShapeOffsets, id + 2).r,\n"
+                   "          texelFetch(blendShapeOffsets, id + 3).r);\n"
+                   "    }\n"
+                   "  }\n";
+      }
+
       // skin
       if (hasSkinning)
       {
@@ -577,6 +660,8 @@ void vtkF3DRenderPass::Render(const vtkRenderState* s)
 
   r->GetBackground(bgColor);
 
+  this->StartPassTimings();
+
   // force background to full black when generating offscreen layers to avoid blending
   // problems when compositing layers in the Blend() function
   r->SetBackground(0.0, 0.0, 0.0);
@@ -589,6 +674,7 @@ void vtkF3DRenderPass::Render(const vtkRenderState* s)
     backgroundState.SetFrameBuffer(s->GetFrameBuffer());
 
     this->BackgroundPass->Render(&backgroundState);
+    this->EndPassTiming("background");
 
     // the reflection result is used in the main pass so it must be rendered before
     vtkF3DRenderer* renderer = vtkF3DRenderer::SafeDownCast(r);
@@ -614,18 +700,26 @@ void vtkF3DRenderPass::Render(const vtkRenderState* s)
         r->SetActiveCamera(reflectedCam);
 
         this->BakeReflectionPass->Render(&reflState);
+        this->EndPassTiming("reflection");
 
         // restore camera
         r->SetActiveCamera(originalCam);
       }
     }
 
+    // only the props surviving the culling are rendered
+    std::vector<vtkProp*>& mainProps = this->CullingPass ? this->VisibleMainProps : this->MainProps;
+    if (this->CullingPass)
+    {
+      this->CullingPass->Cull(r, this->MainProps, this->VisibleMainProps);
+    }
+
     vtkRenderState mainState(s->GetRenderer());
-    mainState.SetPropArrayAndCount(
-      this->MainProps.data(), static_cast<int>(this->MainProps.size()));
+    mainState.SetPropArrayAndCount(mainProps.data(), static_cast<int>(mainProps.size()));
     mainState.SetFrameBuffer(s->GetFrameBuffer());
 
     this->MainPass->Render(&mainState);
+    this->EndPassTiming("main");
 
     vtkRenderState mainOnTopState(s->GetRenderer());
     mainOnTopState.SetPropArrayAndCount(
@@ -633,18 +727,81 @@ void vtkF3DRenderPass::Render(const vtkRenderState* s)
     mainOnTopState.SetFrameBuffer(s->GetFrameBuffer());
 
     this->MainOnTopPass->Render(&mainOnTopState);
+    this->EndPassTiming("main on top");
   }
 
   // restore background color before compositing the layers
   r->SetBackground(bgColor);
 
   this->Blend(s);
+  this->EndPassTiming("blend");
+  this->ResolvePassTimings();
 
   this->NumberOfRenderedProps = this->MainPass->GetNumberOfRenderedProps();
 
   this->PostRender(s);
 }
 
+// ----------------------------------------------------------------------------
+vtkF3DCullingPass* vtkF3DRenderPass::GetCullingPass() const
+{
+  return this->CullingPass;
+}
+
+// ----------------------------------------------------------------------------
+void vtkF3DRenderPass::StartPassTimings()
+{
+  this->PassTimings.clear();
+  this->EndPassTiming("");
+}
+
+// ----------------------------------------------------------------------------
+void vtkF3DRenderPass::EndPassTiming([[maybe_unused]] const std::string& name)
+{
+#if !defined(__ANDROID__) && !defined(__EMSCRIPTEN__)
+  if (!this->CollectPassTimings)
+  {
+    return;
+  }
+
+  // The first timestamp is the start of the render and has no associated pass
+  const size_t index = name.empty() ? 0 : this->PassTimings.size() + 1;
+  if (!name.empty())
+  {
+    this->PassTimings.emplace_back(name, 0.0);
+  }
+
+  while (this->TimestampQueries.size() <= index)
+  {
+    GLuint query;
+    glGenQueries(1, &query);
+    this->TimestampQueries.emplace_back(query);
+  }
+  glQueryCounter(this->TimestampQueries[index], GL_TIMESTAMP);
+#endif
+}
+
+// ----------------------------------------------------------------------------
+void vtkF3DRenderPass::ResolvePassTimings()
+{
+#if !defined(__ANDROID__) && !defined(__EMSCRIPTEN__)
+  if (!this->CollectPassTimings || this->PassTimings.empty())
+  {
+    return;
+  }
+
+  GLuint64 previous = 0;
+  glGetQueryObjectui64v(this->TimestampQueries[0], GL_QUERY_RESULT, &previous);
+  for (size_t i = 0; i < this->PassTimings.size(); i++)
+  {
+    GLuint64 current = 0;
+    glGetQueryObjectui64v(this->TimestampQueries[i + 1], GL_QUERY_RESULT, &current);
+    this->PassTimings[i].second = (current - previous) * 1e-6;
+    previous = current;
+  }
+#endif
+}
+
 // ----------------------------------------------------------------------------
 void vtkF3DRenderPass::Blend(const vtkRenderState* s)
 {
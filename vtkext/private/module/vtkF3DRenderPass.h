@@ -22,10 +22,13 @@
 #include <vtkTimeStamp.h>
 
 #include <memory>
+#include <string>
+#include <utility>
 #include <vector>
 
 class vtkActor;
 class vtkCamera;
+class vtkF3DCullingPass;
 class vtkInformationIntegerKey;
 class vtkAbstractMapper;
 class vtkPolyData;
@@ -50,6 +53,35 @@ public:
   vtkSetMacro(CircleOfConfusionRadius, double);
   vtkSetMacro(RenderReflection, bool);
 
+  /**
+   * Cull the main props outside of the camera frustum or occluded during the previous frame
+   * before rendering them, see vtkF3DCullingPass.
+   * Not supported with raytracing.
+   */
+  vtkSetMacro(UseCulling, bool);
+
+  /**
+   * Get the culling pass used by the last render, nullptr when culling is not used
+   */
+  vtkF3DCullingPass* GetCullingPass() const;
+
+  /**
+   * Measure the GPU time of each sub pass using timestamp queries.
+   * Results are recovered with GetPassTimings after each render.
+   * Recovering the results waits for the GPU so this slows down rendering.
+   * Not supported on Android and Emscripten.
+   */
+  vtkSetMacro(CollectPassTimings, bool);
+
+  /**
+   * Get the GPU time, in milliseconds, of each sub pass of the last render
+   * when CollectPassTimings is enabled, in the order they were rendered.
+   */
+  const std::vector<std::pair<std::string, double>>& GetPassTimings() const
+  {
+    return this->PassTimings;
+  }
+
   /**
    * Modify shader code for jittering
    */
@@ -73,12 +105,24 @@ protected:
 
   void ReflectCamera(vtkCamera* originalCam, vtkMatrix4x4* actorMatrix, vtkCamera* reflectedCam);
 
+  ///@{
+  /**
+   * Record a GPU timestamp at the start of the render and after each timed sub pass,
+   * then convert them to sub pass durations once the render is complete
+   */
+  void StartPassTimings();
+  void EndPassTiming(const std::string& name);
+  void ResolvePassTimings();
+  ///@}
+
   bool ArmatureVisible = false;
   bool UseRaytracing = false;
   bool UseSSAOPass = false;
   bool UseBlurBackground = false;
   bool ForceOpaqueBackground = false;
   bool RenderReflection = false;
+  bool CollectPassTimings = false;
+  bool UseCulling = false;
 
   double CircleOfConfusionRadius = 20.0;
 
@@ -86,20 +130,28 @@ protected:
   vtkSmartPointer<vtkFramebufferPass> BakeReflectionPass;
   vtkSmartPointer<vtkFramebufferPass> MainPass;
   vtkSmartPointer<vtkFramebufferPass> MainOnTopPass;
+  vtkSmartPointer<vtkF3DCullingPass> CullingPass;
 
   double Bounds[6] = {};
 
   vtkMTimeType InitializeTime = 0;
 
+  // Weighted blending passes depend on the visibility of volumes, see Initialize
+  bool InitializedWithVolume = false;
+
   int LightComplexity = 0;
 
   std::vector<vtkProp*> BackgroundProps;
   std::vector<vtkProp*> MainOnTopProps;
   std::vector<vtkProp*> MainProps;
+  std::vector<vtkProp*> VisibleMainProps;
   std::vector<vtkProp*> ReflectionProps;
 
   std::shared_ptr<vtkOpenGLQuadHelper> BlendQuadHelper;
 
+  std::vector<unsigned int> TimestampQueries;
+  std::vector<std::pair<std::string, double>> PassTimings;
+
 private:
   void ReplaceMatCapShader(std::string& fragmentShader, vtkActor* actor, vtkPolyData* polyData);
   void ReplaceSkinningMorphing(std::string& vertexShader, vtkActor* actor, vtkPolyData* polyData);
@@ -4,9 +4,11 @@
 #include "F3DColoringInfoHandler.h"
 #include "F3DDefaultHDRI.h"
 #include "F3DLog.h"
+#include "F3DTextureCache.h"
 #include "F3DUtils.h"
 #include "vtkF3DCachedLUTTexture.h"
 #include "vtkF3DCachedSpecularTexture.h"
+#include "vtkF3DCullingPass.h"
 #include "vtkF3DDisplayDepthRenderPass.h"
 #include "vtkF3DInteractorStyle.h"
 #include "vtkF3DOpenGLGridMapper.h"
@@ -56,6 +58,7 @@
 #include <vtkPointData.h>
 #include <vtkPolyData.h>
 #include <vtkProperty.h>
+#include <vtkQuadricClustering.h>
 #include <vtkRenderWindow.h>
 #include <vtkRenderWindowInteractor.h>
 #include <vtkSSAAPass.h>
@@ -98,10 +101,22 @@
 #include <vtkOSPRayRendererNode.h>
 #endif
 
+#include <algorithm>
 #include <cctype>
 #include <chrono>
+#include <cmath>
+#include <future>
 #include <numbers>
 #include <sstream>
+#include <string_view>
+
+// GL_NVX_gpu_memory_info tokens, in KiB, not always provided by glad
+#ifndef GL_GPU_MEMORY_INFO_TOTAL_AVAILABLE_MEMORY_NVX
+#define GL_GPU_MEMORY_INFO_TOTAL_AVAILABLE_MEMORY_NVX 0x9048
+#endif
+#ifndef GL_GPU_MEMORY_INFO_CURRENT_AVAILABLE_VIDMEM_NVX
+#define GL_GPU_MEMORY_INFO_CURRENT_AVAILABLE_VIDMEM_NVX 0x9049
+#endif
 
 namespace
 {
@@ -246,6 +261,22 @@ void ExecFuncOnAllPolyDataUniforms(vtkActorCollection* actors, F&& func)
 }
 }
 
+//----------------------------------------------------------------------------
+struct vtkF3DRenderer::InteractiveProxy
+{
+  // Meshes with fewer cells are always rendered at full resolution
+  static constexpr vtkIdType MinimumNumberOfCells = 100000;
+
+  size_t ColoringIndex = 0;
+  vtkMTimeType InputMTime = 0;
+  vtkSmartPointer<vtkQuadricClustering> Clustering;
+  std::future<vtkSmartPointer<vtkPolyData>> Decimation;
+  bool Ready = false;
+  vtkActor* ReplacedActor = nullptr;
+  vtkNew<vtkActor> Actor;
+  vtkNew<vtkPolyDataMapper> Mapper;
+};
+
 //----------------------------------------------------------------------------
 vtkStandardNewMacro(vtkF3DRenderer);
 
@@ -291,6 +322,7 @@ void vtkF3DRenderer::ReleaseGraphicsResources(vtkWindow* w)
 void vtkF3DRenderer::Initialize()
 {
   this->OriginalLightIntensities.clear();
+  this->InteractiveProxies.clear();
   this->RemoveAllViewProps();
   this->RemoveAllLights();
 
@@ -475,16 +507,22 @@ void vtkF3DRenderer::ConfigureRenderPasses()
     pass->ReleaseGraphicsResources(this->RenderWindow);
   }
 
+  // expensive effects are skipped when interactive frames are too slow
+  const bool fullQuality = !this->InteractiveRendering || !this->InteractiveEffectsDisabled;
+
   vtkNew<vtkF3DRenderPass> newPass;
+  newPass->SetCollectPassTimings(this->CollectFrameStatistics);
+  this->F3DRenderPass = newPass;
 #if F3D_MODULE_RAYTRACING
   newPass->SetUseRaytracing(this->UseRaytracing);
 #endif
-  newPass->SetUseSSAOPass(this->UseSSAOPass);
-  newPass->SetUseBlurBackground(this->UseBlurBackground);
+  newPass->SetUseSSAOPass(this->UseSSAOPass && fullQuality);
+  newPass->SetUseBlurBackground(this->UseBlurBackground && fullQuality);
   newPass->SetCircleOfConfusionRadius(this->CircleOfConfusionRadius);
   newPass->SetForceOpaqueBackground(this->HDRISkyboxVisible);
   newPass->SetArmatureVisible(this->ArmatureVisible);
-  newPass->SetRenderReflection(this->GridVisible && this->GridReflection > 0.0);
+  newPass->SetUseCulling(this->UseCulling);
+  newPass->SetRenderReflection(this->GridVisible && this->GridReflection > 0.0 && fullQuality);
 
   double bounds[6];
   this->ComputeVisiblePropBounds(bounds);
@@ -507,9 +545,10 @@ void vtkF3DRenderer::ConfigureRenderPasses()
       depthP->SetColorMap(this->ColorTransferFunction);
     }
     renderingPass = depthP;
+    this->F3DRenderPass = nullptr;
   }
 
-  if (this->AntiAliasingModeEnabled == vtkF3DRenderer::AntiAliasingMode::SSAA)
+  if (this->AntiAliasingModeEnabled == vtkF3DRenderer::AntiAliasingMode::SSAA && fullQuality)
   {
     vtkNew<vtkSSAAPass> ssaaP;
 #if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 4, 20250329)
@@ -1703,6 +1742,16 @@ void vtkF3DRenderer::SetUseBlurBackground(bool use)
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkF3DRenderer::SetUseCulling(bool use)
+{
+  if (this->UseCulling != use)
+  {
+    this->UseCulling = use;
+    this->RenderPassesConfigured = false;
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkF3DRenderer::SetBackfaceType(const std::optional<std::string>& backfaceType)
 {
@@ -2074,6 +2123,197 @@ void vtkF3DRenderer::SetInteractionStyle(const std::string& style)
   this->CheatSheetConfigured = false;
 }
 
+//----------------------------------------------------------------------------
+void vtkF3DRenderer::SetInteractiveTargetFrameTime(const std::optional<double>& frameTime)
+{
+  if (this->InteractiveTargetFrameTime != frameTime)
+  {
+    this->SetInteractiveRendering(false);
+    this->RemoveInteractiveProxies();
+    this->InteractiveTargetFrameTime = frameTime;
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DRenderer::SetInteractiveRendering(bool interactive)
+{
+  if (!this->InteractiveTargetFrameTime.has_value() || this->InteractiveRendering == interactive)
+  {
+    return;
+  }
+
+  this->InteractiveRendering = interactive;
+  this->SlowInteractiveFrames = 0;
+
+  if (interactive && this->LastFrameTime > this->InteractiveTargetFrameTime.value())
+  {
+    // Skip the expensive effects only if they are used, to avoid reconfiguring passes for nothing
+    const bool ssaa = this->AntiAliasingModeEnabled == vtkF3DRenderer::AntiAliasingMode::SSAA;
+    const bool reflection = this->GridVisible && this->GridReflection > 0.0;
+    if (this->UseSSAOPass || this->UseBlurBackground || ssaa || reflection)
+    {
+      this->InteractiveEffectsDisabled = true;
+      this->RenderPassesConfigured = false;
+    }
+  }
+  else if (!interactive && this->InteractiveEffectsDisabled)
+  {
+    this->InteractiveEffectsDisabled = false;
+    this->RenderPassesConfigured = false;
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DRenderer::RequestInteractiveProxies(double frameTime)
+{
+  if (!this->Importer || !this->InteractiveProxies.empty())
+  {
+    return;
+  }
+
+  // Aim for a number of cells rendered in the target frame time
+  const double ratio = std::clamp(this->InteractiveTargetFrameTime.value() / frameTime, 0.01, 1.0);
+
+  const auto& colorings = this->Importer->GetColoringActorsAndMappers();
+  for (size_t i = 0; i < colorings.size(); i++)
+  {
+    vtkPolyData* input = colorings[i].Mapper->GetInput();
+    if (!input || input->GetNumberOfCells() < InteractiveProxy::MinimumNumberOfCells)
+    {
+      continue;
+    }
+
+    // A surface crosses about two times the square of the divisions in the clustering grid
+    const double targetCells = ratio * static_cast<double>(input->GetNumberOfCells());
+    const int divisions = std::clamp(static_cast<int>(std::sqrt(targetCells / 2.0)), 8, 1024);
+
+    // the decimation works on a deep copy, as the arrays of the input can be modified in place
+    // while it runs, by an animation or a mesh view
+    vtkSmartPointer<vtkPolyData> copy = vtkSmartPointer<vtkPolyData>::New();
+    copy->DeepCopy(input);
+
+    auto& proxy = this->InteractiveProxies.emplace_back(std::make_unique<InteractiveProxy>());
+    proxy->ColoringIndex = i;
+    proxy->InputMTime = input->GetMTime();
+    proxy->Actor->VisibilityOff();
+    proxy->Clustering = vtkSmartPointer<vtkQuadricClustering>::New();
+    proxy->Clustering->SetInputData(copy);
+    proxy->Clustering->SetNumberOfDivisions(divisions, divisions, divisions);
+    proxy->Clustering->UseInputPointsOn();
+    proxy->Clustering->CopyCellDataOn();
+
+    // the decimation runs on the background workers, which are joined at exit,
+    // and is skipped when the proxy is removed before it starts
+    auto promise = std::make_shared<std::promise<vtkSmartPointer<vtkPolyData>>>();
+    proxy->Decimation = promise->get_future();
+    F3DTextureCache::Run(
+      [clustering = proxy->Clustering, promise]()
+      {
+        if (!clustering->GetAbortExecute())
+        {
+          clustering->Update();
+        }
+        promise->set_value(clustering->GetOutput());
+      });
+    this->AddActor(proxy->Actor);
+  }
+
+  this->InteractiveProxiesTimeStamp = this->Importer->GetUpdateMTime();
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DRenderer::ConfigureInteractiveProxies()
+{
+  if (this->InteractiveProxies.empty())
+  {
+    return;
+  }
+
+  // Proxies are outdated when the geometry changes, on load or on animation
+  if (!this->Importer || this->Importer->GetUpdateMTime() > this->InteractiveProxiesTimeStamp)
+  {
+    this->RemoveInteractiveProxies();
+    return;
+  }
+
+  // or when an input is modified in place
+  const auto& colorings = this->Importer->GetColoringActorsAndMappers();
+  for (const auto& proxy : this->InteractiveProxies)
+  {
+    vtkPolyData* input = proxy->ColoringIndex < colorings.size()
+      ? colorings[proxy->ColoringIndex].Mapper->GetInput()
+      : nullptr;
+    if (!input || input->GetMTime() != proxy->InputMTime)
+    {
+      this->RemoveInteractiveProxies();
+      return;
+    }
+  }
+
+  for (const auto& proxy : this->InteractiveProxies)
+  {
+    if (!proxy->Ready && proxy->Decimation.valid() &&
+      proxy->Decimation.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+    {
+      proxy->Mapper->SetInputData(proxy->Decimation.get());
+      proxy->Clustering = nullptr;
+      proxy->Ready = true;
+    }
+
+    if (this->InteractiveRendering && proxy->Ready && !proxy->ReplacedActor)
+    {
+      // replace the actor currently displaying the geometry, with or without coloring
+      const auto& coloring = colorings[proxy->ColoringIndex];
+      vtkActor* replaced = nullptr;
+      if (coloring.Actor->GetVisibility())
+      {
+        replaced = coloring.Actor;
+      }
+      else if (coloring.OriginalActor->GetVisibility())
+      {
+        replaced = coloring.OriginalActor;
+      }
+
+      if (replaced)
+      {
+        vtkPolyData* decimated = proxy->Mapper->GetInput();
+        proxy->Mapper->ShallowCopy(replaced->GetMapper());
+        proxy->Mapper->SetInputData(decimated);
+        proxy->Actor->ShallowCopy(replaced);
+        proxy->Actor->SetMapper(proxy->Mapper);
+        replaced->VisibilityOff();
+        proxy->ReplacedActor = replaced;
+      }
+    }
+    else if (!this->InteractiveRendering && proxy->ReplacedActor)
+    {
+      proxy->ReplacedActor->VisibilityOn();
+      proxy->Actor->VisibilityOff();
+      proxy->ReplacedActor = nullptr;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DRenderer::RemoveInteractiveProxies()
+{
+  for (const auto& proxy : this->InteractiveProxies)
+  {
+    if (proxy->ReplacedActor)
+    {
+      proxy->ReplacedActor->VisibilityOn();
+    }
+    this->RemoveActor(proxy->Actor);
+
+    // the decimations still running are aborted and their results dropped without waiting
+    if (!proxy->Ready)
+    {
+      proxy->Clustering->AbortExecuteOn();
+    }
+  }
+  this->InteractiveProxies.clear();
+}
+
 //----------------------------------------------------------------------------
 void vtkF3DRenderer::UpdateActors()
 {
@@ -2205,9 +2445,18 @@ void vtkF3DRenderer::Render()
     this->UpdateNormalGlyphsScale();
   }
 
-  if (!this->TimerVisible)
+  vtkInformation* info = this->GetInformation();
+  bool uiOnly = info->Get(vtkF3DRenderPass::RENDER_UI_ONLY());
+
+  if (this->InteractiveTargetFrameTime.has_value() && !uiOnly)
+  {
+    this->ConfigureInteractiveProxies();
+  }
+
+  if (!this->TimerVisible && !this->CollectFrameStatistics)
   {
     this->Superclass::Render();
+    this->UpdateInteractiveFrameTime(uiOnly);
     return;
   }
 
@@ -2217,9 +2466,6 @@ void vtkF3DRenderer::Render()
     glGenQueries(1, &this->Timer);
   }
 
-  vtkInformation* info = this->GetInformation();
-  bool uiOnly = info->Get(vtkF3DRenderPass::RENDER_UI_ONLY());
-
 #if !defined(__ANDROID__) && !defined(__EMSCRIPTEN__)
   if (!uiOnly)
   {
@@ -2234,20 +2480,146 @@ void vtkF3DRenderer::Render()
   if (!uiOnly)
   {
     // Get CPU frame time
-    double elapsedTime =
+    const double cpuTime =
       std::chrono::duration_cast<std::chrono::microseconds>(cpuElapsed).count() * 1e-6;
+    double elapsedTime = cpuTime;
+    double gpuTime = -1.0;
 
 #if !defined(__ANDROID__) && !defined(__EMSCRIPTEN__)
     glEndQuery(GL_TIME_ELAPSED);
     GLint elapsed;
     glGetQueryObjectiv(this->Timer, GL_QUERY_RESULT, &elapsed);
+    gpuTime = elapsed * 1e-9;
 
     // Get min between CPU frame time and GPU frame time
-    elapsedTime = std::min(elapsedTime, elapsed * 1e-9);
+    elapsedTime = std::min(elapsedTime, gpuTime);
 #endif
 
-    this->UIActor->UpdateFpsValue(elapsedTime);
+    vtkF3DCullingPass* cullingPass =
+      this->F3DRenderPass ? this->F3DRenderPass->GetCullingPass() : nullptr;
+
+    if (this->TimerVisible)
+    {
+      this->UIActor->UpdateFpsValue(elapsedTime);
+
+      // the number of culled props is displayed next to the fps when culling is used
+      int culledProps = -1;
+      if (cullingPass)
+      {
+        culledProps = cullingPass->GetNumberOfFrustumCulledProps() +
+          cullingPass->GetNumberOfOcclusionCulledProps();
+      }
+      this->UIActor->UpdateCulledPropsValue(culledProps);
+    }
+
+    if (this->CollectFrameStatistics)
+    {
+      FrameStatistics& stats = this->CollectedFrameStatistics.emplace_back();
+      stats.CPUTime = cpuTime * 1e3;
+      stats.GPUTime = gpuTime < 0 ? gpuTime : gpuTime * 1e3;
+      if (this->F3DRenderPass)
+      {
+        stats.PassTimes = this->F3DRenderPass->GetPassTimings();
+      }
+      if (cullingPass)
+      {
+        stats.FrustumCulledProps = cullingPass->GetNumberOfFrustumCulledProps();
+        stats.OcclusionCulledProps = cullingPass->GetNumberOfOcclusionCulledProps();
+      }
+      stats.GPUMemory = this->GetGPUMemoryUsage();
+      stats.InteractiveEffectsDisabled =
+        this->InteractiveRendering && this->InteractiveEffectsDisabled;
+      stats.InteractiveProxyProps = static_cast<int>(std::ranges::count_if(this->InteractiveProxies,
+        [](const auto& proxy) { return proxy->ReplacedActor != nullptr; }));
+    }
   }
+
+  this->UpdateInteractiveFrameTime(uiOnly);
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DRenderer::UpdateInteractiveFrameTime(bool uiOnly)
+{
+  if (!this->InteractiveTargetFrameTime.has_value() || uiOnly)
+  {
+    return;
+  }
+
+  this->LastFrameTime = this->GetLastRenderTimeInSeconds() * 1e3;
+
+  // Frames still too slow once the effects are disabled need proxy geometry.
+  // The first interactive frame is not reliable as it may reconfigure the render passes.
+  if (this->InteractiveRendering && this->LastFrameTime > this->InteractiveTargetFrameTime.value())
+  {
+    if (++this->SlowInteractiveFrames > 1)
+    {
+      this->RequestInteractiveProxies(this->LastFrameTime);
+    }
+  }
+  else
+  {
+    this->SlowInteractiveFrames = 0;
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DRenderer::SetCollectFrameStatistics(bool collect)
+{
+  this->CollectFrameStatistics = collect;
+  this->CollectedFrameStatistics.clear();
+  if (this->F3DRenderPass)
+  {
+    this->F3DRenderPass->SetCollectPassTimings(collect);
+  }
+}
+
+//----------------------------------------------------------------------------
+const std::vector<vtkF3DRenderer::FrameStatistics>& vtkF3DRenderer::GetFrameStatistics() const
+{
+  return this->CollectedFrameStatistics;
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DRenderer::HasDisoccludedProps(bool wait)
+{
+  vtkF3DCullingPass* cullingPass =
+    this->F3DRenderPass ? this->F3DRenderPass->GetCullingPass() : nullptr;
+  if (!cullingPass || !this->RenderWindow)
+  {
+    return false;
+  }
+
+  this->RenderWindow->MakeCurrent();
+  return cullingPass->HasDisoccludedProps(wait);
+}
+
+//----------------------------------------------------------------------------
+double vtkF3DRenderer::GetGPUMemoryUsage()
+{
+#if !defined(__ANDROID__) && !defined(__EMSCRIPTEN__)
+  if (!this->GPUMemoryInfoSupported.has_value())
+  {
+    GLint count = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    bool supported = false;
+    for (GLint i = 0; i < count && !supported; i++)
+    {
+      const char* extension = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i));
+      supported = extension && std::string_view(extension) == "GL_NVX_gpu_memory_info";
+    }
+    this->GPUMemoryInfoSupported = supported;
+  }
+
+  if (this->GPUMemoryInfoSupported.value())
+  {
+    GLint total = 0;
+    GLint available = 0;
+    glGetIntegerv(GL_GPU_MEMORY_INFO_TOTAL_AVAILABLE_MEMORY_NVX, &total);
+    glGetIntegerv(GL_GPU_MEMORY_INFO_CURRENT_AVAILABLE_VIDMEM_NVX, &available);
+    return (total - available) / 1024.0;
+  }
+#endif
+  return -1.0;
 }
 
 //----------------------------------------------------------------------------
@@ -2988,6 +3360,7 @@ void vtkF3DRenderer::SetUseVolume(bool use)
     this->UseVolume = use;
     this->CheatSheetConfigured = false;
     this->ColoringConfigured = false;
+    this->RenderPassesConfigured = false;
   }
 }
 
@@ -3276,6 +3649,14 @@ void vtkF3DRenderer::ConfigureColoringAndVisibilities()
       F3DLog::Print(F3DLog::Severity::Error, "Cannot use volume with this data");
     }
     this->VolumePropsAndMappersConfigured = true;
+
+    if (this->BlendingModeEnabled == BlendingMode::WEIGHTED &&
+      std::ranges::any_of(
+        volPropsAndMappers, [](const auto& volume) { return volume.Prop->GetVisibility(); }))
+    {
+      F3DLog::Print(F3DLog::Severity::Warning,
+        "Weighted blending does not support volumes, using dual depth peeling instead");
+    }
   }
 
   // Handle scalar bar
@@ -24,7 +24,11 @@
 #include <array>
 #include <filesystem>
 #include <map>
+#include <memory>
 #include <optional>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace fs = std::filesystem;
 
@@ -34,6 +38,7 @@ class vtkColorTransferFunction;
 class vtkCornerAnnotation;
 class vtkDiscretizableColorTransferFunction;
 class vtkF3DOpenGLGridMapper;
+class vtkF3DRenderPass;
 class vtkGridAxesActor3D;
 class vtkImageReader2;
 class vtkPNGReader;
@@ -68,7 +73,8 @@ public:
     DUAL_DEPTH_PEELING,
     SORT,
     SORT_CPU,
-    STOCHASTIC
+    STOCHASTIC,
+    WEIGHTED
   };
 
   /**
@@ -164,6 +170,7 @@ public:
   void SetRaytracingSamples(int samples);
   void SetBackfaceType(const std::optional<std::string>& backfaceType);
   void SetFinalShader(const std::optional<std::string>& finalShader);
+  void SetUseCulling(bool use);
   ///@}
 
   /**
@@ -185,6 +192,27 @@ public:
    */
   void SetInteractionStyle(const std::string& style);
 
+  /**
+   * Set the target frame time, in milliseconds, of the frames rendered while interacting.
+   * When set and the last frame took longer than the target, the interactive frames
+   * are rendered without the expensive effects (ambient occlusion, blur, SSAA, reflections).
+   * If they are still too slow, decimated proxies of the large meshes are built in the background
+   * and displayed instead of the full geometry while interacting.
+   * When not set, interactive frames are rendered at full quality.
+   */
+  void SetInteractiveTargetFrameTime(const std::optional<double>& frameTime);
+  const std::optional<double>& GetInteractiveTargetFrameTime() const
+  {
+    return this->InteractiveTargetFrameTime;
+  }
+
+  /**
+   * Switch between interactive rendering, used while the camera moves, and full quality
+   * rendering. Has no effect when no interactive target frame time is set.
+   */
+  void SetInteractiveRendering(bool interactive);
+  vtkGetMacro(InteractiveRendering, bool);
+
   /**
    * Reimplemented to configure:
    *  - ActorsProperties
@@ -253,10 +281,26 @@ public:
    */
   vtkGetVector3Macro(RightDirection, double);
 
+  ///@{
   /**
-   * Set cache path, only used by the HDRI logic
+   * Set/Get cache path, used by the HDRI logic and the texture cache
    */
   void SetCachePath(const std::string& cachePath);
+  const std::string& GetCachePath() const
+  {
+    return this->CachePath;
+  }
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get if textures are encoded to GPU compressed formats in the cache path,
+   * see vtkF3DKTXTexture. Only used when F3D is built with the KTX module.
+   * Default is false.
+   */
+  vtkSetMacro(UseTextureCache, bool);
+  vtkGetMacro(UseTextureCache, bool);
+  ///@}
 
   /**
    * Set the roughness on all actors
@@ -595,12 +639,58 @@ public:
    */
   void UpdateAnimationTime(double currentTime);
 
+  /**
+   * Statistics of a rendered frame, times are in milliseconds.
+   * GPUTime is negative and PassTimes is empty when GPU timer queries are not supported.
+   * GPUMemory is the device memory in use in MiB, negative when the driver does not expose
+   * GL_NVX_gpu_memory_info.
+   * FrustumCulledProps and OcclusionCulledProps are the number of props skipped by the culling,
+   * 0 when culling is not used.
+   * InteractiveEffectsDisabled is true when the expensive effects were skipped by the interactive
+   * rendering and InteractiveProxyProps is the number of props replaced by decimated proxies.
+   */
+  struct FrameStatistics
+  {
+    double CPUTime = 0.0;
+    double GPUTime = -1.0;
+    std::vector<std::pair<std::string, double>> PassTimes;
+    double GPUMemory = -1.0;
+    int FrustumCulledProps = 0;
+    int OcclusionCulledProps = 0;
+    bool InteractiveEffectsDisabled = false;
+    int InteractiveProxyProps = 0;
+  };
+
+  /**
+   * Enable or disable the collection of statistics for each rendered frame.
+   * Enabling it clears the previously collected statistics.
+   * Collecting statistics waits for the GPU after each render pass, which slows down rendering.
+   */
+  void SetCollectFrameStatistics(bool collect);
+
+  /**
+   * Get the statistics of the frames rendered since their collection was enabled
+   */
+  const std::vector<FrameStatistics>& GetFrameStatistics() const;
+
+  /**
+   * Return true if a prop occlusion culled by the last frame is actually visible,
+   * so another frame must be rendered to display it.
+   * When wait is false, only the occlusion queries already completed by the GPU are used.
+   */
+  bool HasDisoccludedProps(bool wait);
+
 private:
   vtkF3DRenderer();
   ~vtkF3DRenderer() override;
 
   void ReleaseGraphicsResources(vtkWindow* w) override;
 
+  /**
+   * Get the device memory in use in MiB, or a negative value if it cannot be recovered
+   */
+  double GetGPUMemoryUsage();
+
   /**
    * Configure meta data actor visibility and content
    */
@@ -659,6 +749,22 @@ private:
    */
   void ConfigureRenderPasses();
 
+  ///@{
+  /**
+   * Build decimated proxies of the large meshes in the background, then show them instead of
+   * the full geometry while interacting once they are ready
+   */
+  void RequestInteractiveProxies(double frameTime);
+  void ConfigureInteractiveProxies();
+  void RemoveInteractiveProxies();
+  ///@}
+
+  /**
+   * Record the duration of the last frame and request interactive proxies when
+   * interactive frames are slower than the target frame time
+   */
+  void UpdateInteractiveFrameTime(bool uiOnly);
+
   /**
    * Rotate camera and apply up direction to scene.
    * Called from UpdateActors when UpDirectionConfigured is false.
@@ -756,6 +862,20 @@ private:
 
   unsigned int Timer = 0; // Timer OpenGL query
 
+  vtkSmartPointer<vtkF3DRenderPass> F3DRenderPass;
+  bool CollectFrameStatistics = false;
+  std::vector<FrameStatistics> CollectedFrameStatistics;
+  std::optional<bool> GPUMemoryInfoSupported;
+
+  struct InteractiveProxy;
+  std::optional<double> InteractiveTargetFrameTime;
+  bool InteractiveRendering = false;
+  bool InteractiveEffectsDisabled = false;
+  double LastFrameTime = 0.0;
+  int SlowInteractiveFrames = 0;
+  std::vector<std::unique_ptr<InteractiveProxy>> InteractiveProxies;
+  vtkMTimeType InteractiveProxiesTimeStamp = 0;
+
   bool CheatSheetConfigured = false;
   bool ActorsPropertiesConfigured = false;
   bool UpDirectionConfigured = false;
@@ -802,6 +922,7 @@ private:
   bool UseToneMappingPass = false;
   bool DisplayDepth = false;
   bool UseBlurBackground = false;
+  bool UseCulling = false;
   std::optional<bool> UseOrthographicProjection = false;
   bool InvertZoom = false;
 
@@ -845,6 +966,7 @@ private:
   std::string GridInfo;
 
   std::string CachePath;
+  bool UseTextureCache = false;
 
   std::optional<std::string> BackfaceType;
   std::optional<std::string> FinalShader;
@@ -183,6 +183,12 @@ void vtkF3DUIActor::UpdateFpsValue(const double elapsedFrameTime)
   this->FpsValue = static_cast<int>(std::round(1.0 / averageFrameTime));
 }
 
+//----------------------------------------------------------------------------
+void vtkF3DUIActor::UpdateCulledPropsValue(int culledProps)
+{
+  this->CulledPropsValue = culledProps;
+}
+
 //----------------------------------------------------------------------------
 void vtkF3DUIActor::SetFontFile(const std::string& font)
 {
@@ -189,6 +189,12 @@ public:
    */
   void UpdateFpsValue(const double elapsedFrameTime);
 
+  /**
+   * Updates the number of culled props displayed with the fps counter
+   * -1 by default, not displayed when negative
+   */
+  void UpdateCulledPropsValue(int culledProps);
+
   /**
    * Set the font file path
    * Use Inter font by default if empty
@@ -404,6 +410,7 @@ protected:
 
   double TotalFrameTimes = 0.0;
   int FpsValue = 0;
+  int CulledPropsValue = -1;
 
   std::string FontFile = "";
   double FontScale = 1.0;
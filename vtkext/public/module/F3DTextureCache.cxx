@@ -0,0 +1,268 @@
+#include "F3DTextureCache.h"
+
+#include <vtkImageReader2.h>
+#include <vtkImageReader2Factory.h>
+#include <vtkNew.h>
+#include <vtkObject.h>
+#include <vtkSetGet.h>
+#include <vtkVersion.h>
+#include <vtksys/FStream.hxx>
+#include <vtksys/SystemTools.hxx>
+
+#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 5, 20251016)
+#include <vtkMemoryResourceStream.h>
+#endif
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+// Size and hash of the encoded content, only used to find the candidates to compare
+using CacheKey = std::pair<size_t, size_t>;
+
+// Encoded content kept to be compared byte per byte with the candidates
+struct CacheEntry
+{
+  std::shared_ptr<const std::vector<char>> Content;
+  F3DTextureCache::Image Image;
+};
+
+//----------------------------------------------------------------------------
+std::mutex& GetCacheMutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+//----------------------------------------------------------------------------
+std::multimap<CacheKey, CacheEntry>& GetCache()
+{
+  static std::multimap<CacheKey, CacheEntry> cache;
+  return cache;
+}
+
+//----------------------------------------------------------------------------
+// Fixed pool of workers, one per core, decoding the submitted images in submission order
+class DecodingQueue
+{
+public:
+  DecodingQueue()
+  {
+    const unsigned int nbWorkers = std::max(std::thread::hardware_concurrency(), 1u);
+    for (unsigned int i = 0; i < nbWorkers; i++)
+    {
+      this->Workers.emplace_back([this]() { this->Work(); });
+    }
+  }
+
+  ~DecodingQueue()
+  {
+    {
+      const std::lock_guard<std::mutex> lock(this->Mutex);
+      this->Stopping = true;
+      this->Jobs.clear();
+    }
+    this->Condition.notify_all();
+    for (std::thread& worker : this->Workers)
+    {
+      worker.join();
+    }
+  }
+
+  DecodingQueue(const DecodingQueue&) = delete;
+  DecodingQueue& operator=(const DecodingQueue&) = delete;
+
+  void Push(std::function<void()> job)
+  {
+    {
+      const std::lock_guard<std::mutex> lock(this->Mutex);
+      this->Jobs.push_back(std::move(job));
+    }
+    this->Condition.notify_one();
+  }
+
+private:
+  void Work()
+  {
+    while (true)
+    {
+      std::function<void()> job;
+      {
+        std::unique_lock<std::mutex> lock(this->Mutex);
+        this->Condition.wait(lock, [this]() { return this->Stopping || !this->Jobs.empty(); });
+        if (this->Stopping)
+        {
+          return;
+        }
+        job = std::move(this->Jobs.front());
+        this->Jobs.pop_front();
+      }
+      job();
+    }
+  }
+
+  std::mutex Mutex;
+  std::condition_variable Condition;
+  std::deque<std::function<void()>> Jobs;
+  std::vector<std::thread> Workers;
+  bool Stopping = false;
+};
+
+//----------------------------------------------------------------------------
+DecodingQueue& GetDecodingQueue()
+{
+  // The queue is destroyed before the cache it uses, which are constructed first.
+  // Its destructor drops the pending jobs and joins the workers once their current job is done.
+  ::GetCacheMutex();
+  ::GetCache();
+  static DecodingQueue queue;
+  return queue;
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkImageData> DecodeData(vtkImageReader2* reader, const std::vector<char>& data)
+{
+  if (data.empty())
+  {
+    return nullptr;
+  }
+
+#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 5, 20251016)
+  vtkNew<vtkMemoryResourceStream> stream;
+  stream->SetBuffer(data.data(), data.size());
+  reader->SetStream(stream);
+#else
+  reader->SetMemoryBuffer(data.data());
+  reader->SetMemoryBufferLength(data.size());
+#endif
+  reader->Update();
+
+  vtkImageData* output = reader->GetOutput();
+  if (!output || output->GetNumberOfPoints() == 0)
+  {
+    return nullptr;
+  }
+
+  // detach the image from the reader pipeline so the reader can be released
+  vtkSmartPointer<vtkImageData> image = vtkSmartPointer<vtkImageData>::New();
+  image->ShallowCopy(output);
+  return image;
+}
+
+//----------------------------------------------------------------------------
+F3DTextureCache::Image Submit(
+  vtkSmartPointer<vtkImageReader2> reader, std::function<std::vector<char>()> load)
+{
+  auto task = std::make_shared<std::packaged_task<vtkSmartPointer<vtkImageData>()>>(
+    [reader, load = std::move(load)]() -> vtkSmartPointer<vtkImageData>
+    {
+      const auto data = std::make_shared<const std::vector<char>>(load());
+      const CacheKey key(
+        data->size(), std::hash<std::string_view>()(std::string_view(data->data(), data->size())));
+
+      std::promise<vtkSmartPointer<vtkImageData>> promise;
+      F3DTextureCache::Image cached;
+      {
+        const std::lock_guard<std::mutex> lock(::GetCacheMutex());
+        auto& cache = ::GetCache();
+        auto [first, last] = cache.equal_range(key);
+        auto it = std::find_if(
+          first, last, [&](const auto& entry) { return *entry.second.Content == *data; });
+        if (it != last)
+        {
+          cached = it->second.Image;
+        }
+        else
+        {
+          cache.emplace(key, CacheEntry{ data, promise.get_future().share() });
+        }
+      }
+
+      if (cached.valid())
+      {
+        // identical content already decoded, or being decoded by another worker
+        return cached.get();
+      }
+
+      vtkSmartPointer<vtkImageData> image = ::DecodeData(reader, *data);
+      promise.set_value(image);
+      return image;
+    });
+
+  F3DTextureCache::Image image = task->get_future().share();
+  ::GetDecodingQueue().Push([task]() { (*task)(); });
+  return image;
+}
+
+//----------------------------------------------------------------------------
+F3DTextureCache::Image MakeReady(vtkSmartPointer<vtkImageData> image)
+{
+  std::promise<vtkSmartPointer<vtkImageData>> promise;
+  promise.set_value(image);
+  return promise.get_future().share();
+}
+}
+
+//----------------------------------------------------------------------------
+F3DTextureCache::Image F3DTextureCache::DecodeBuffer(
+  const void* buffer, size_t size, const std::string& extension)
+{
+  // The factory is not thread safe, create the reader in the calling thread
+  vtkSmartPointer<vtkImageReader2> reader;
+  reader.TakeReference(vtkImageReader2Factory::CreateImageReader2FromExtension(extension.c_str()));
+  if (!reader)
+  {
+    vtkWarningWithObjectMacro(nullptr, "Cannot create reader for image type: " << extension);
+    return ::MakeReady(nullptr);
+  }
+
+  const char* begin = static_cast<const char*>(buffer);
+  return ::Submit(reader,
+    [data = std::vector<char>(begin, begin + size)]() mutable { return std::move(data); });
+}
+
+//----------------------------------------------------------------------------
+F3DTextureCache::Image F3DTextureCache::DecodeFile(const std::string& path)
+{
+  const std::string extension = vtksys::SystemTools::GetFilenameLastExtension(path);
+
+  vtkSmartPointer<vtkImageReader2> reader;
+  reader.TakeReference(vtkImageReader2Factory::CreateImageReader2FromExtension(extension.c_str()));
+  if (!reader)
+  {
+    vtkWarningWithObjectMacro(nullptr, "Cannot create reader for image: " << path);
+    return ::MakeReady(nullptr);
+  }
+
+  return ::Submit(reader,
+    [path]()
+    {
+      vtksys::ifstream file(path.c_str(), std::ios::binary);
+      return std::vector<char>(
+        std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    });
+}
+
+//----------------------------------------------------------------------------
+void F3DTextureCache::Run(std::function<void()> job)
+{
+  ::GetDecodingQueue().Push(std::move(job));
+}
+
+//----------------------------------------------------------------------------
+void F3DTextureCache::Clear()
+{
+  const std::lock_guard<std::mutex> lock(::GetCacheMutex());
+  ::GetCache().clear();
+}
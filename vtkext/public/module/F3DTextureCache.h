@@ -0,0 +1,61 @@
+/**
+ * @class   F3DTextureCache
+ * @brief   Namespace decoding texture images in parallel for importers
+ *
+ * Texture images are decoded by a fixed pool of background workers, one per core, so importers
+ * can submit them before converting their geometry and only wait for them when creating materials.
+ * Decoded images are shared in a process wide cache keyed by their encoded content, which is kept
+ * and compared byte per byte, so an identical texture referenced by several files, or several
+ * times by a file, is decoded only once until the cache is cleared.
+ * The workers are joined at exit, after finishing their current image, pending ones are dropped.
+ * Returned images are shared, they must be shallow copied before being modified.
+ */
+
+#ifndef F3DTextureCache_h
+#define F3DTextureCache_h
+
+#include "vtkextModule.h"
+
+/// @cond
+#include <vtkImageData.h>
+#include <vtkSmartPointer.h>
+
+#include <functional>
+#include <future>
+#include <string>
+/// @endcond
+
+namespace F3DTextureCache
+{
+/**
+ * A decoded image available once its decoding is complete, nullptr if it failed
+ */
+using Image = std::shared_future<vtkSmartPointer<vtkImageData>>;
+
+/**
+ * Decode an encoded image stored in memory in the background.
+ * The extension, with or without the leading dot, selects the image reader.
+ * The buffer is copied so it can be released as soon as this returns.
+ */
+VTKEXT_EXPORT Image DecodeBuffer(const void* buffer, size_t size, const std::string& extension);
+
+/**
+ * Read and decode an image file in the background.
+ * The file extension selects the image reader.
+ */
+VTKEXT_EXPORT Image DecodeFile(const std::string& path);
+
+/**
+ * Run a job on the decoding workers, after the images already submitted.
+ * Pending jobs are dropped at exit.
+ */
+VTKEXT_EXPORT void Run(std::function<void()> job);
+
+/**
+ * Release the cached images, usually when the scene is cleared.
+ * Images still used by importers stay alive until they release them.
+ */
+VTKEXT_EXPORT void Clear();
+}
+
+#endif
@@ -34,10 +34,13 @@ double F3DUtils::ParseToDouble(const std::string& str, double def, const std::st
   return value;
 }
 
+namespace
+{
 //----------------------------------------------------------------------------
-int F3DUtils::ParseToInt(const std::string& str, int def, const std::string& nameError)
+template<typename T>
+T ParseToInteger(const std::string& str, T def, const std::string& nameError)
 {
-  int value = def;
+  T value = def;
   if (!str.empty())
   {
     auto result = std::from_chars(str.data(), str.data() + str.size(), value);
@@ -57,6 +60,20 @@ int F3DUtils::ParseToInt(const std::string& str, int def, const std::string& nam
   }
   return value;
 }
+}
+
+//----------------------------------------------------------------------------
+int F3DUtils::ParseToInt(const std::string& str, int def, const std::string& nameError)
+{
+  return ::ParseToInteger(str, def, nameError);
+}
+
+//----------------------------------------------------------------------------
+std::int64_t F3DUtils::ParseToInt64(
+  const std::string& str, std::int64_t def, const std::string& nameError)
+{
+  return ::ParseToInteger(str, def, nameError);
+}
 
 //----------------------------------------------------------------------------
 double F3DUtils::getDPIScale()
@@ -11,6 +11,7 @@
 #include "vtkextModule.h"
 
 /// @cond
+#include <cstdint>
 #include <string>
 /// @endcond
 
@@ -31,6 +32,15 @@ VTKEXT_EXPORT double ParseToDouble(
  */
 VTKEXT_EXPORT int ParseToInt(const std::string& str, int def, const std::string& nameError);
 
+/*
+ * Convert provided std into a 64 bits int and returns it, for values such as budgets
+ * which can exceed the int range.
+ * Catch conversion error, log them if any and returns the provided def value.
+ * Use nameError in the log for easier debugging.
+ */
+VTKEXT_EXPORT std::int64_t ParseToInt64(
+  const std::string& str, std::int64_t def, const std::string& nameError);
+
 /*
  * Calculate the primary monitor system zoom scale base on DPI.
  * Only supported on Windows platform.
@@ -0,0 +1,149 @@
+#include <vtkActor.h>
+#include <vtkActorCollection.h>
+#include <vtkDataArray.h>
+#include <vtkDataSet.h>
+#include <vtkGlyph3DMapper.h>
+#include <vtkMapper.h>
+#include <vtkNew.h>
+#include <vtkPointData.h>
+#include <vtkRenderWindow.h>
+#include <vtkRenderer.h>
+
+#include "vtkF3DGLTFDocumentLoader.h"
+#include "vtkF3DGLTFImporter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+//----------------------------------------------------------------------------
+// Import a file with a single actor, return nullptr otherwise
+vtkActor* ImportActor(vtkF3DGLTFImporter* importer, const std::string& path)
+{
+  vtkNew<vtkRenderWindow> renWin;
+  renWin->OffScreenRenderingOn();
+  vtkNew<vtkRenderer> renderer;
+  renWin->AddRenderer(renderer);
+
+  importer->SetFileName(path.c_str());
+  importer->SetRenderWindow(renWin);
+  if (!importer->Update())
+  {
+    std::cerr << "Unexpected Update failure with " << path << "\n";
+    return nullptr;
+  }
+
+  vtkActorCollection* actors = importer->GetImportedActors();
+  if (actors->GetNumberOfItems() != 1)
+  {
+    std::cerr << "Unexpected number of actors with " << path << "\n";
+    return nullptr;
+  }
+  return vtkActor::SafeDownCast(actors->GetItemAsObject(0));
+}
+}
+
+int TestF3DGLTFDocumentLoader(int vtkNotUsed(argc), char* argv[])
+{
+  vtkNew<vtkF3DGLTFDocumentLoader> loader;
+  std::vector<std::string> extensions = loader->GetSupportedExtensions();
+  auto supports = [&](const std::string& extension)
+  { return std::find(extensions.begin(), extensions.end(), extension) != extensions.end(); };
+
+  if (!supports("KHR_mesh_quantization"))
+  {
+    std::cerr << "KHR_mesh_quantization is not supported\n";
+    return EXIT_FAILURE;
+  }
+
+  // A triangle drawn three times along X with EXT_mesh_gpu_instancing
+  const std::string instancedPath = std::string(argv[1]) + "data/InstancedTriangle.gltf";
+  vtkNew<vtkF3DGLTFImporter> instancedImporter;
+  vtkActor* instancedActor = ::ImportActor(instancedImporter, instancedPath);
+  vtkGlyph3DMapper* glyphMapper =
+    instancedActor ? vtkGlyph3DMapper::SafeDownCast(instancedActor->GetMapper()) : nullptr;
+  if (!glyphMapper || glyphMapper->GetInputAsDataSet()->GetNumberOfPoints() != 3)
+  {
+    std::cerr << "Instances are not rendered with a glyph mapper\n";
+    return EXIT_FAILURE;
+  }
+
+  // The bounds include all the instances
+  const double* bounds = glyphMapper->GetBounds();
+  if (std::abs(bounds[0]) > 1e-6 || std::abs(bounds[1] - 5.0) > 1e-6 ||
+    std::abs(bounds[3] - 1.0) > 1e-6)
+  {
+    std::cerr << "Unexpected instanced bounds\n";
+    return EXIT_FAILURE;
+  }
+
+#if F3D_MODULE_MESHOPT
+  if (!supports("EXT_meshopt_compression"))
+  {
+    std::cerr << "EXT_meshopt_compression is not supported\n";
+    return EXIT_FAILURE;
+  }
+
+  // A triangle with meshopt compressed positions and indices.
+  // The fallback buffer is filled with zeros so the positions are only valid if decoded.
+  const std::string path = std::string(argv[1]) + "data/MeshoptTriangle.gltf";
+  vtkNew<vtkF3DGLTFImporter> importer;
+  vtkActor* actor = ::ImportActor(importer, path);
+  vtkDataSet* mesh = actor ? actor->GetMapper()->GetInput() : nullptr;
+  if (!mesh || mesh->GetNumberOfPoints() != 3 || mesh->GetNumberOfCells() != 1)
+  {
+    std::cerr << "Unexpected imported triangle\n";
+    return EXIT_FAILURE;
+  }
+
+  const double expected[3][3] = { { 0, 0, 0 }, { 1, 0, 0 }, { 0, 1, 0 } };
+  for (vtkIdType i = 0; i < 3; i++)
+  {
+    double point[3];
+    mesh->GetPoint(i, point);
+    for (int j = 0; j < 3; j++)
+    {
+      if (std::abs(point[j] - expected[i][j]) > 1e-6)
+      {
+        std::cerr << "Unexpected decoded position for point " << i << "\n";
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  // A quad laid out as gltfpack does: quantized attributes dequantized by the node scale,
+  // and a fallback buffer without uri
+  const std::string quantizedPath = std::string(argv[1]) + "data/QuantizedMeshopt.glb";
+  vtkNew<vtkF3DGLTFImporter> quantizedImporter;
+  vtkActor* quantizedActor = ::ImportActor(quantizedImporter, quantizedPath);
+  vtkDataSet* quad = quantizedActor ? quantizedActor->GetMapper()->GetInput() : nullptr;
+  if (!quad || quad->GetNumberOfPoints() != 4 || quad->GetNumberOfCells() != 2)
+  {
+    std::cerr << "Unexpected imported quad\n";
+    return EXIT_FAILURE;
+  }
+
+  const double* quadBounds = quantizedActor->GetBounds();
+  if (std::abs(quadBounds[0]) > 1e-6 || std::abs(quadBounds[1] - 1.0) > 1e-6 ||
+    std::abs(quadBounds[2]) > 1e-6 || std::abs(quadBounds[3] - 1.0) > 1e-6)
+  {
+    std::cerr << "Unexpected dequantized bounds\n";
+    return EXIT_FAILURE;
+  }
+
+  vtkDataArray* normals = quad->GetPointData()->GetNormals();
+  vtkDataArray* tcoords = quad->GetPointData()->GetTCoords();
+  if (!normals || std::abs(normals->GetComponent(0, 2) - 1.0) > 1e-6 || !tcoords ||
+    std::abs(tcoords->GetComponent(1, 0) - 1.0) > 1e-6)
+  {
+    std::cerr << "Unexpected normalized attributes\n";
+    return EXIT_FAILURE;
+  }
+#endif
+
+  return EXIT_SUCCESS;
+}
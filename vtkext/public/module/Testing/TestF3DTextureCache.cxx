@@ -0,0 +1,62 @@
+#include <vtkObject.h>
+#include <vtksys/FStream.hxx>
+
+#include "F3DTextureCache.h"
+
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+int TestF3DTextureCache(int argc, char* argv[])
+{
+  // Turn off VTK warning reporting to avoid unwanted failure detection by ctest
+  vtkObject::GlobalWarningDisplayOff();
+
+  if (argc < 2)
+  {
+    std::cerr << "Missing testing data directory argument\n";
+    return EXIT_FAILURE;
+  }
+
+  const std::string path = std::string(argv[1]) + "data/albedo.png";
+
+  F3DTextureCache::Image first = F3DTextureCache::DecodeFile(path);
+  F3DTextureCache::Image second = F3DTextureCache::DecodeFile(path);
+
+  vtkImageData* image = first.get();
+  if (!image || image->GetNumberOfPoints() == 0)
+  {
+    std::cerr << "Failed to decode " << path << "\n";
+    return EXIT_FAILURE;
+  }
+
+  if (second.get() != image)
+  {
+    std::cerr << "Decoding the same file twice did not share the image\n";
+    return EXIT_FAILURE;
+  }
+
+  vtksys::ifstream file(path.c_str(), std::ios::binary);
+  const std::vector<char> buffer(
+    std::istreambuf_iterator<char>(file), (std::istreambuf_iterator<char>()));
+  if (F3DTextureCache::DecodeBuffer(buffer.data(), buffer.size(), ".png").get() != image)
+  {
+    std::cerr << "Decoding the same content from memory did not share the image\n";
+    return EXIT_FAILURE;
+  }
+
+  if (F3DTextureCache::DecodeBuffer(buffer.data(), buffer.size(), ".invalid").get())
+  {
+    std::cerr << "Decoding with an invalid extension did not fail\n";
+    return EXIT_FAILURE;
+  }
+
+  F3DTextureCache::Clear();
+  if (!F3DTextureCache::DecodeFile(path).get())
+  {
+    std::cerr << "Failed to decode " << path << " after clearing the cache\n";
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
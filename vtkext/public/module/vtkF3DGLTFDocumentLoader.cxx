@@ -0,0 +1,542 @@
+#include "vtkF3DGLTFDocumentLoader.h"
+
+#include <vtkFileResourceStream.h>
+#include <vtkFloatArray.h>
+#include <vtkObjectFactory.h>
+#include <vtkPointData.h>
+#include <vtkPoints.h>
+#include <vtkResourceStream.h>
+
+#if F3D_MODULE_MESHOPT
+#include <vtkSMPTools.h>
+
+#include <meshoptimizer.h>
+#endif
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+namespace
+{
+constexpr const char* QUANTIZATION_EXTENSION = "KHR_mesh_quantization";
+constexpr const char* INSTANCING_EXTENSION = "EXT_mesh_gpu_instancing";
+#if F3D_MODULE_KTX
+constexpr const char* BASISU_EXTENSION = "KHR_texture_basisu";
+#endif
+
+//----------------------------------------------------------------------------
+// VTK does not expose buffer views and nodes extensions, so the JSON is read again,
+// either from the whole glTF stream or from the first chunk of a GLB stream
+std::string ReadJSON(vtkResourceStream* stream)
+{
+  stream->Seek(0, vtkResourceStream::SeekDirection::Begin);
+
+  // GLB header (magic, version, length) followed by the JSON chunk header (length, type)
+  char header[20];
+  size_t headerSize = stream->Read(header, sizeof(header));
+  if (headerSize == sizeof(header) && std::memcmp(header, "glTF", 4) == 0)
+  {
+    uint32_t length = 0;
+    std::memcpy(&length, header + 12, sizeof(length));
+    std::string json(length, '\0');
+    return stream->Read(json.data(), length) == length ? json : std::string();
+  }
+
+  std::string json(header, headerSize);
+  char chunk[65536];
+  size_t count = 0;
+  while ((count = stream->Read(chunk, sizeof(chunk))) > 0)
+  {
+    json.append(chunk, count);
+  }
+  return json;
+}
+
+//----------------------------------------------------------------------------
+template<typename T>
+float ReadComponent(const char* data, bool normalized)
+{
+  T value;
+  std::memcpy(&value, data, sizeof(T));
+  if constexpr (std::is_integral_v<T>)
+  {
+    if (normalized)
+    {
+      return std::max(static_cast<float>(value) / std::numeric_limits<T>::max(), -1.f);
+    }
+  }
+  return static_cast<float>(value);
+}
+
+//----------------------------------------------------------------------------
+// Read a float or a (normalized) small integer accessor into a float array
+bool ReadAccessor(const vtkGLTFDocumentLoader::Model& model, int index, int nbComponents,
+  vtkFloatArray* array)
+{
+  using ComponentType = vtkGLTFDocumentLoader::ComponentType;
+
+  if (index < 0 || index >= static_cast<int>(model.Accessors.size()))
+  {
+    return false;
+  }
+  const vtkGLTFDocumentLoader::Accessor& accessor = model.Accessors[index];
+  if (accessor.NumberOfComponents != nbComponents || accessor.BufferView < 0 ||
+    accessor.BufferView >= static_cast<int>(model.BufferViews.size()))
+  {
+    return false;
+  }
+  const vtkGLTFDocumentLoader::BufferView& view = model.BufferViews[accessor.BufferView];
+  if (view.Buffer < 0 || view.Buffer >= static_cast<int>(model.Buffers.size()))
+  {
+    return false;
+  }
+  const std::vector<char>& buffer = model.Buffers[view.Buffer];
+
+  size_t componentSize = 0;
+  switch (accessor.ComponentTypeValue)
+  {
+    case ComponentType::BYTE:
+    case ComponentType::UNSIGNED_BYTE:
+      componentSize = 1;
+      break;
+    case ComponentType::SHORT:
+    case ComponentType::UNSIGNED_SHORT:
+      componentSize = 2;
+      break;
+    case ComponentType::FLOAT:
+      componentSize = 4;
+      break;
+    default:
+      return false;
+  }
+
+  const size_t count = static_cast<size_t>(accessor.Count);
+  const size_t stride =
+    view.ByteStride > 0 ? static_cast<size_t>(view.ByteStride) : componentSize * nbComponents;
+  const size_t offset = static_cast<size_t>(view.ByteOffset + accessor.ByteOffset);
+  if (count > 0 && offset + stride * (count - 1) + componentSize * nbComponents > buffer.size())
+  {
+    return false;
+  }
+
+  array->SetNumberOfComponents(nbComponents);
+  array->SetNumberOfTuples(static_cast<vtkIdType>(count));
+  for (size_t i = 0; i < count; i++)
+  {
+    for (int c = 0; c < nbComponents; c++)
+    {
+      const char* data = buffer.data() + offset + i * stride + c * componentSize;
+      float value = 0.f;
+      switch (accessor.ComponentTypeValue)
+      {
+        case ComponentType::BYTE:
+          value = ::ReadComponent<int8_t>(data, accessor.Normalized);
+          break;
+        case ComponentType::UNSIGNED_BYTE:
+          value = ::ReadComponent<uint8_t>(data, accessor.Normalized);
+          break;
+        case ComponentType::SHORT:
+          value = ::ReadComponent<int16_t>(data, accessor.Normalized);
+          break;
+        case ComponentType::UNSIGNED_SHORT:
+          value = ::ReadComponent<uint16_t>(data, accessor.Normalized);
+          break;
+        default:
+          value = ::ReadComponent<float>(data, false);
+          break;
+      }
+      array->SetTypedComponent(static_cast<vtkIdType>(i), c, value);
+    }
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+// Read the TRS attributes of EXT_mesh_gpu_instancing, missing attributes use identity values
+vtkSmartPointer<vtkPolyData> ReadInstances(
+  const vtkGLTFDocumentLoader::Model& model, const nlohmann::json& attributes)
+{
+  vtkNew<vtkFloatArray> translations;
+  vtkNew<vtkFloatArray> rotations;
+  rotations->SetName("Rotation");
+  vtkNew<vtkFloatArray> scales;
+  scales->SetName("Scale");
+
+  vtkIdType count = -1;
+  auto read = [&](const char* name, int nbComponents, vtkFloatArray* array)
+  {
+    if (!attributes.contains(name))
+    {
+      return true;
+    }
+    if (!::ReadAccessor(model, attributes[name].get<int>(), nbComponents, array) ||
+      (count >= 0 && array->GetNumberOfTuples() != count))
+    {
+      return false;
+    }
+    count = array->GetNumberOfTuples();
+    return true;
+  };
+
+  if (!read("TRANSLATION", 3, translations) || !read("ROTATION", 4, rotations) ||
+    !read("SCALE", 3, scales) || count < 0)
+  {
+    return nullptr;
+  }
+
+  auto fill = [&](vtkFloatArray* array, int nbComponents, const float* values)
+  {
+    if (array->GetNumberOfTuples() == 0)
+    {
+      array->SetNumberOfComponents(nbComponents);
+      array->SetNumberOfTuples(count);
+      for (vtkIdType i = 0; i < count; i++)
+      {
+        array->SetTypedTuple(i, values);
+      }
+    }
+  };
+  const float zero[3] = { 0.f, 0.f, 0.f };
+  const float identity[4] = { 0.f, 0.f, 0.f, 1.f };
+  const float one[3] = { 1.f, 1.f, 1.f };
+  fill(translations, 3, zero);
+  fill(rotations, 4, identity);
+  fill(scales, 3, one);
+
+  // glTF quaternions are (x, y, z, w) while VTK expects (w, x, y, z)
+  for (vtkIdType i = 0; i < count; i++)
+  {
+    float q[4];
+    rotations->GetTypedTuple(i, q);
+    const float wxyz[4] = { q[3], q[0], q[1], q[2] };
+    rotations->SetTypedTuple(i, wxyz);
+  }
+
+  vtkNew<vtkPoints> points;
+  points->SetData(translations);
+
+  vtkNew<vtkPolyData> instances;
+  instances->SetPoints(points);
+  instances->GetPointData()->AddArray(rotations);
+  instances->GetPointData()->AddArray(scales);
+  return instances;
+}
+
+#if F3D_MODULE_MESHOPT
+constexpr const char* MESHOPT_EXTENSION = "EXT_meshopt_compression";
+
+//----------------------------------------------------------------------------
+struct MeshoptView
+{
+  int View = -1;
+  int Buffer = -1;
+  size_t ByteOffset = 0;
+  size_t ByteLength = 0;
+  size_t ByteStride = 0;
+  size_t Count = 0;
+  std::string Mode;
+  std::string Filter;
+};
+
+//----------------------------------------------------------------------------
+std::vector<MeshoptView> ParseViews(const nlohmann::json& root)
+{
+  std::vector<MeshoptView> views;
+  const nlohmann::json& bufferViews = root.value("bufferViews", nlohmann::json::array());
+  for (size_t i = 0; i < bufferViews.size(); i++)
+  {
+    const nlohmann::json& extensions = bufferViews[i].value("extensions", nlohmann::json::object());
+    if (!extensions.contains(MESHOPT_EXTENSION))
+    {
+      continue;
+    }
+
+    const nlohmann::json& meshopt = extensions[MESHOPT_EXTENSION];
+    MeshoptView view;
+    view.View = static_cast<int>(i);
+    view.Buffer = meshopt.at("buffer").get<int>();
+    view.ByteOffset = meshopt.value("byteOffset", size_t(0));
+    view.ByteLength = meshopt.at("byteLength").get<size_t>();
+    view.ByteStride = meshopt.at("byteStride").get<size_t>();
+    view.Count = meshopt.at("count").get<size_t>();
+    view.Mode = meshopt.at("mode").get<std::string>();
+    view.Filter = meshopt.value("filter", std::string("NONE"));
+    views.emplace_back(std::move(view));
+  }
+  return views;
+}
+
+//----------------------------------------------------------------------------
+// Check the untrusted sizes of a view before decoding it, return an error message if invalid
+std::string ValidateView(
+  const MeshoptView& view, const std::vector<char>& source, size_t decodedLength)
+{
+  if (view.ByteOffset > source.size() || view.ByteLength > source.size() - view.ByteOffset)
+  {
+    return "compressed data is out of the buffer";
+  }
+
+  // Constraints of the meshopt decoders on the element size
+  const bool validStride = view.Mode == "ATTRIBUTES"
+    ? view.ByteStride > 0 && view.ByteStride <= 256 && view.ByteStride % 4 == 0
+    : view.ByteStride == 2 || view.ByteStride == 4;
+  if (!validStride)
+  {
+    return "invalid byteStride " + std::to_string(view.ByteStride);
+  }
+  if ((view.Mode == "TRIANGLES" && view.Count % 3 != 0) ||
+    (view.Mode != "ATTRIBUTES" && view.Mode != "TRIANGLES" && view.Mode != "INDICES"))
+  {
+    return "invalid mode " + view.Mode + " for " + std::to_string(view.Count) + " elements";
+  }
+
+  if (view.Count > std::numeric_limits<size_t>::max() / view.ByteStride ||
+    view.Count * view.ByteStride != decodedLength)
+  {
+    return "count and byteStride do not match the buffer view byteLength";
+  }
+  return {};
+}
+
+//----------------------------------------------------------------------------
+bool DecodeView(const MeshoptView& view, const std::vector<char>& source, std::vector<char>& out)
+{
+  out.resize(view.Count * view.ByteStride);
+  const unsigned char* data = reinterpret_cast<const unsigned char*>(source.data());
+  data += view.ByteOffset;
+
+  int result = -1;
+  if (view.Mode == "ATTRIBUTES")
+  {
+    result =
+      meshopt_decodeVertexBuffer(out.data(), view.Count, view.ByteStride, data, view.ByteLength);
+  }
+  else if (view.Mode == "TRIANGLES")
+  {
+    result =
+      meshopt_decodeIndexBuffer(out.data(), view.Count, view.ByteStride, data, view.ByteLength);
+  }
+  else if (view.Mode == "INDICES")
+  {
+    result =
+      meshopt_decodeIndexSequence(out.data(), view.Count, view.ByteStride, data, view.ByteLength);
+  }
+  if (result != 0)
+  {
+    return false;
+  }
+
+  if (view.Filter == "OCTAHEDRAL")
+  {
+    meshopt_decodeFilterOct(out.data(), view.Count, view.ByteStride);
+  }
+  else if (view.Filter == "QUATERNION")
+  {
+    meshopt_decodeFilterQuat(out.data(), view.Count, view.ByteStride);
+  }
+  else if (view.Filter == "EXPONENTIAL")
+  {
+    meshopt_decodeFilterExp(out.data(), view.Count, view.ByteStride);
+  }
+  else if (view.Filter != "NONE")
+  {
+    return false;
+  }
+  return true;
+}
+#endif
+}
+
+//----------------------------------------------------------------------------
+vtkStandardNewMacro(vtkF3DGLTFDocumentLoader);
+
+//----------------------------------------------------------------------------
+std::vector<std::string> vtkF3DGLTFDocumentLoader::GetSupportedExtensions()
+{
+  std::vector<std::string> extensions = this->Superclass::GetSupportedExtensions();
+  if (std::find(extensions.begin(), extensions.end(), QUANTIZATION_EXTENSION) == extensions.end())
+  {
+    extensions.emplace_back(QUANTIZATION_EXTENSION);
+  }
+  extensions.emplace_back(INSTANCING_EXTENSION);
+#if F3D_MODULE_MESHOPT
+  extensions.emplace_back(MESHOPT_EXTENSION);
+#endif
+#if F3D_MODULE_KTX
+  extensions.emplace_back(BASISU_EXTENSION);
+#endif
+  return extensions;
+}
+
+//----------------------------------------------------------------------------
+void vtkF3DGLTFDocumentLoader::PrepareData()
+{
+  this->MeshInstances.clear();
+
+  const std::vector<std::string>& used = this->GetUsedExtensions();
+  auto isUsed = [&](const char* extension)
+  { return std::find(used.begin(), used.end(), extension) != used.end(); };
+#if F3D_MODULE_MESHOPT
+  const bool meshopt = isUsed(MESHOPT_EXTENSION);
+#else
+  const bool meshopt = false;
+#endif
+  const bool instancing = isUsed(INSTANCING_EXTENSION);
+#if F3D_MODULE_KTX
+  const bool basisu = isUsed(BASISU_EXTENSION);
+#else
+  const bool basisu = false;
+#endif
+  if (!meshopt && !instancing && !basisu)
+  {
+    return;
+  }
+
+  std::shared_ptr<Model> model = this->GetInternalModel();
+
+  vtkSmartPointer<vtkResourceStream> stream = model->Stream;
+  if (!stream)
+  {
+    vtkNew<vtkFileResourceStream> fileStream;
+    if (!fileStream->Open(model->FileName.c_str()))
+    {
+      vtkErrorMacro("Cannot open " << model->FileName << " to read extensions metadata");
+      return;
+    }
+    stream = fileStream;
+  }
+
+  nlohmann::json root = nlohmann::json::parse(::ReadJSON(stream), nullptr, false);
+  if (root.is_discarded())
+  {
+    vtkErrorMacro("Cannot parse extensions metadata");
+    return;
+  }
+
+  try
+  {
+#if F3D_MODULE_MESHOPT
+    if (meshopt)
+    {
+      std::vector<MeshoptView> views = ::ParseViews(root);
+
+      // Sizes are checked before decoding so corrupted files do not allocate or overflow
+      std::vector<char> checked(views.size(), 0);
+      for (size_t i = 0; i < views.size(); i++)
+      {
+        const MeshoptView& view = views[i];
+        std::string error = "invalid buffer";
+        if (view.View < static_cast<int>(model->BufferViews.size()) && view.Buffer >= 0 &&
+          view.Buffer < static_cast<int>(model->Buffers.size()))
+        {
+          error = ::ValidateView(view, model->Buffers[view.Buffer],
+            static_cast<size_t>(std::max(model->BufferViews[view.View].ByteLength, 0)));
+        }
+        if (!error.empty())
+        {
+          vtkErrorMacro("Invalid meshopt compressed buffer view " << view.View << ": " << error);
+          continue;
+        }
+        checked[i] = 1;
+      }
+
+      // Buffer views are independent so they are decoded in parallel
+      std::vector<std::vector<char>> decoded(views.size());
+      std::vector<char> valid(views.size(), 0);
+      vtkSMPTools::For(0, views.size(),
+        [&](size_t first, size_t last)
+        {
+          for (size_t i = first; i < last; i++)
+          {
+            if (checked[i])
+            {
+              valid[i] = ::DecodeView(views[i], model->Buffers[views[i].Buffer], decoded[i]);
+            }
+          }
+        });
+
+      for (size_t i = 0; i < views.size(); i++)
+      {
+        if (!checked[i])
+        {
+          continue;
+        }
+        if (!valid[i])
+        {
+          vtkErrorMacro("Cannot decode meshopt compressed buffer view " << views[i].View);
+          continue;
+        }
+
+        // Point the buffer view to its decoded buffer, accessors using it are unchanged
+        model->Buffers.emplace_back(std::move(decoded[i]));
+        BufferView& bufferView = model->BufferViews[views[i].View];
+        bufferView.Buffer = static_cast<int>(model->Buffers.size() - 1);
+        bufferView.ByteOffset = 0;
+        bufferView.ByteLength = static_cast<int>(model->Buffers.back().size());
+        if (views[i].Mode == "ATTRIBUTES")
+        {
+          bufferView.ByteStride = static_cast<int>(views[i].ByteStride);
+        }
+      }
+    }
+#endif
+
+    if (instancing)
+    {
+      const nlohmann::json& nodes = root.value("nodes", nlohmann::json::array());
+      for (size_t i = 0; i < nodes.size() && i < model->Nodes.size(); i++)
+      {
+        const nlohmann::json& extensions = nodes[i].value("extensions", nlohmann::json::object());
+        Node& node = model->Nodes[i];
+        if (!extensions.contains(INSTANCING_EXTENSION) || node.Mesh < 0 ||
+          node.Mesh >= static_cast<int>(model->Meshes.size()))
+        {
+          continue;
+        }
+
+        vtkSmartPointer<vtkPolyData> instances =
+          ::ReadInstances(*model, extensions[INSTANCING_EXTENSION].at("attributes"));
+        if (!instances)
+        {
+          vtkErrorMacro("Cannot read instances of node " << i);
+          continue;
+        }
+
+        // Give the node its own mesh so its geometry identifies the actors to instantiate
+        Mesh mesh = model->Meshes[node.Mesh];
+        model->Meshes.emplace_back(std::move(mesh));
+        node.Mesh = static_cast<int>(model->Meshes.size() - 1);
+        this->MeshInstances[node.Mesh] = instances;
+      }
+    }
+
+    if (basisu)
+    {
+      // Use the KTX2 image instead of the fallback one, if any
+      const nlohmann::json& textures = root.value("textures", nlohmann::json::array());
+      for (size_t i = 0; i < textures.size() && i < model->Textures.size(); i++)
+      {
+        const nlohmann::json& extensions =
+          textures[i].value("extensions", nlohmann::json::object());
+        if (extensions.contains(BASISU_EXTENSION))
+        {
+          const int source = extensions[BASISU_EXTENSION].at("source").get<int>();
+          if (source >= 0 && source < static_cast<int>(model->Images.size()))
+          {
+            model->Textures[i].Source = source;
+          }
+        }
+      }
+    }
+  }
+  catch (const nlohmann::json::exception& ex)
+  {
+    vtkErrorMacro("Invalid extensions metadata: " << ex.what());
+  }
+}
@@ -0,0 +1,73 @@
+/**
+ * @class   vtkF3DGLTFDocumentLoader
+ * @brief   VTK GLTF document loader customization
+ *
+ * Subclasses the native loader to support the extensions produced by gltfpack:
+ * KHR_mesh_quantization attributes are read by VTK as any other accessor, and, when F3D is built
+ * with the meshoptimizer module, EXT_meshopt_compression buffer views are decoded in parallel
+ * into new buffers before the model data is used.
+ * EXT_mesh_gpu_instancing node instances are read into a point cloud per instanced mesh,
+ * so the importer can render them with instanced draws.
+ * When F3D is built with the KTX module, KHR_texture_basisu textures use their KTX2 image,
+ * which must be referenced by an uri, instead of their fallback image.
+ * Loaders supporting other extensions should subclass this one and call its PrepareData.
+ */
+
+#ifndef vtkF3DGLTFDocumentLoader_h
+#define vtkF3DGLTFDocumentLoader_h
+
+#include "vtkextModule.h"
+
+/// @cond
+#include <vtkGLTFDocumentLoader.h>
+#include <vtkPolyData.h>
+#include <vtkSmartPointer.h>
+
+#include <map>
+/// @endcond
+
+class VTKEXT_EXPORT vtkF3DGLTFDocumentLoader : public vtkGLTFDocumentLoader
+{
+public:
+  static vtkF3DGLTFDocumentLoader* New();
+  vtkTypeMacro(vtkF3DGLTFDocumentLoader, vtkGLTFDocumentLoader);
+
+  /**
+   * Overridden to add KHR_mesh_quantization and EXT_mesh_gpu_instancing support,
+   * and EXT_meshopt_compression and KHR_texture_basisu support if available.
+   */
+  std::vector<std::string> GetSupportedExtensions() override;
+
+  /**
+   * Overridden to decode EXT_meshopt_compression buffer views, read node instances and
+   * select KHR_texture_basisu images.
+   * Each compressed buffer view is decoded into a new buffer and pointed to it,
+   * so accessors using it are left untouched.
+   */
+  void PrepareData() override;
+
+  /**
+   * Get the instances of the meshes used by EXT_mesh_gpu_instancing nodes, indexed by mesh.
+   * Each instanced node is given its own copy of its mesh, so the primitives geometry of these
+   * meshes are only used by a single node.
+   * Instances are stored as points at their translation, with a "Rotation" point data array
+   * containing (w, x, y, z) quaternions and a "Scale" point data array.
+   * Valid after the model data has been loaded.
+   */
+  const std::map<int, vtkSmartPointer<vtkPolyData>>& GetMeshInstances() const
+  {
+    return this->MeshInstances;
+  }
+
+protected:
+  vtkF3DGLTFDocumentLoader() = default;
+  ~vtkF3DGLTFDocumentLoader() override = default;
+
+private:
+  std::map<int, vtkSmartPointer<vtkPolyData>> MeshInstances;
+
+  vtkF3DGLTFDocumentLoader(const vtkF3DGLTFDocumentLoader&) = delete;
+  void operator=(const vtkF3DGLTFDocumentLoader&) = delete;
+};
+
+#endif
@@ -1,20 +1,26 @@
 #include "vtkF3DGLTFImporter.h"
 
+#include "vtkF3DGLTFDocumentLoader.h"
 #include "vtkF3DImporter.h"
 
 #include <vtkActor.h>
+#include <vtkActorCollection.h>
+#include <vtkGlyph3DMapper.h>
 #include <vtkInformation.h>
 #include <vtkObjectFactory.h>
+#include <vtkPolyDataMapper.h>
+#include <vtkResourceStream.h>
 
 // need https://gitlab.kitware.com/vtk/vtk/-/merge_requests/13116
 // which is backported in 9.6.2 in https://gitlab.kitware.com/vtk/vtk/-/merge_requests/13185
 #if VTK_VERSION_NUMBER < VTK_VERSION_CHECK(9, 6, 2)
-#include <vtkActorCollection.h>
 #include <vtkProperty.h>
 
 #include <cmath>
 #endif
 
+#include <map>
+
 //----------------------------------------------------------------------------
 vtkStandardNewMacro(vtkF3DGLTFImporter);
 
@@ -28,6 +34,30 @@ vtkF3DGLTFImporter::vtkF3DGLTFImporter()
 vtkF3DGLTFImporter::vtkF3DGLTFImporter() = default;
 #endif
 
+//----------------------------------------------------------------------------
+void vtkF3DGLTFImporter::InitializeLoader()
+{
+  this->Loader = vtkSmartPointer<vtkF3DGLTFDocumentLoader>::New();
+}
+
+//----------------------------------------------------------------------------
+bool vtkF3DGLTFImporter::CanReadFile(vtkResourceStream* stream)
+{
+  if (!stream)
+  {
+    return false;
+  }
+
+  stream->Seek(0, vtkResourceStream::SeekDirection::Begin);
+  vtkNew<vtkF3DGLTFDocumentLoader> loader;
+
+#if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 6, 20260212)
+  return loader->LoadModelMetaDataFromStream(stream, nullptr, true);
+#else
+  return loader->LoadModelMetaDataFromStream(stream);
+#endif
+}
+
 //----------------------------------------------------------------------------
 #if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 4, 20241219)
 void vtkF3DGLTFImporter::ApplyArmatureProperties(vtkActor* actor)
@@ -40,19 +70,51 @@ void vtkF3DGLTFImporter::ApplyArmatureProperties(vtkActor* actor)
 }
 #endif
 
-// need https://gitlab.kitware.com/vtk/vtk/-/merge_requests/13116
-// which is backported in 9.6.2 in https://gitlab.kitware.com/vtk/vtk/-/merge_requests/13185
-#if VTK_VERSION_NUMBER < VTK_VERSION_CHECK(9, 6, 2)
 //----------------------------------------------------------------------------
 void vtkF3DGLTFImporter::ImportActors(vtkRenderer* renderer)
 {
   this->Superclass::ImportActors(renderer);
 
+  // Instanced meshes are only used by their node, so their geometry identifies their actors
+  std::map<vtkPolyData*, vtkPolyData*> instancedGeometries;
+  vtkF3DGLTFDocumentLoader* loader = vtkF3DGLTFDocumentLoader::SafeDownCast(this->Loader);
+  if (loader)
+  {
+    std::shared_ptr<vtkGLTFDocumentLoader::Model> model = loader->GetInternalModel();
+    for (const auto& [meshIndex, instances] : loader->GetMeshInstances())
+    {
+      for (const auto& primitive : model->Meshes[meshIndex].Primitives)
+      {
+        instancedGeometries[primitive.Geometry] = instances;
+      }
+    }
+  }
+
   // loop on actors
   vtkCollectionSimpleIterator ait;
   this->ActorCollection->InitTraversal(ait);
   while (vtkActor* actor = this->ActorCollection->GetNextActor(ait))
   {
+    vtkPolyDataMapper* pdMapper = vtkPolyDataMapper::SafeDownCast(actor->GetMapper());
+    auto instancedIt =
+      pdMapper ? instancedGeometries.find(pdMapper->GetInput()) : instancedGeometries.end();
+    if (instancedIt != instancedGeometries.end())
+    {
+      // One instanced draw per primitive, with the instance transforms stored on the GPU.
+      // The node transform is kept in the actor and applied after the instance transforms.
+      vtkNew<vtkGlyph3DMapper> glyphMapper;
+      glyphMapper->SetInputData(instancedIt->second);
+      glyphMapper->SetSourceData(instancedIt->first);
+      glyphMapper->SetOrientationModeToQuaternion();
+      glyphMapper->SetOrientationArray("Rotation");
+      glyphMapper->SetScaleModeToScaleByVectorComponents();
+      glyphMapper->SetScaleArray("Scale");
+      glyphMapper->ScalingOn();
+      glyphMapper->SetScalarVisibility(false);
+      actor->SetMapper(glyphMapper);
+    }
+
+#if VTK_VERSION_NUMBER < VTK_VERSION_CHECK(9, 6, 2)
     vtkProperty* prop = actor->GetProperty();
     if (prop->GetLighting() == false)
     {
@@ -66,6 +128,6 @@ void vtkF3DGLTFImporter::ImportActors(vtkRenderer* renderer)
       color[2] = toLinear(color[2]);
       prop->SetColor(color);
     }
+#endif
   }
 }
-#endif
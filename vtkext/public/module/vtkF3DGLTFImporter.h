@@ -2,7 +2,9 @@
  * @class   vtkF3DGLTFImporter
  * @brief   VTK GLTF importer customization
  *
- * Subclasses the native importer to modify the armature shader.
+ * Subclasses the native importer to modify the armature shader,
+ * to use our own document loader and to render its mesh instances.
+ * @sa vtkF3DGLTFDocumentLoader
  */
 
 #ifndef vtkF3DGLTFImporter_h
@@ -16,6 +18,7 @@
 /// @endcond
 
 class vtkInformationIntegerKey;
+class vtkResourceStream;
 
 class VTKEXT_EXPORT vtkF3DGLTFImporter : public vtkGLTFImporter
 {
@@ -23,10 +26,24 @@ public:
   static vtkF3DGLTFImporter* New();
   vtkTypeMacro(vtkF3DGLTFImporter, vtkGLTFImporter);
 
+  /**
+   * Return true if, after a quick check of file header, it looks like the provided stream
+   * can be read. Return false if it is sure it cannot be read.
+   *
+   * This only checks that the metadata of the file can be loaded using our document loader,
+   * so files requiring the extensions it adds are accepted.
+   */
+  static bool CanReadFile(vtkResourceStream* stream);
+
 protected:
   vtkF3DGLTFImporter();
   ~vtkF3DGLTFImporter() override = default;
 
+  /**
+   * Overridden to instantiate our own document loader
+   */
+  void InitializeLoader() override;
+
   // need https://gitlab.kitware.com/vtk/vtk/-/merge_requests/11774
 #if VTK_VERSION_NUMBER >= VTK_VERSION_CHECK(9, 4, 20241219)
   /**
@@ -36,14 +53,12 @@ protected:
   void ApplyArmatureProperties(vtkActor* actor) override;
 #endif
 
-  // need https://gitlab.kitware.com/vtk/vtk/-/merge_requests/13116
-  // which is backported in 9.6.2 in https://gitlab.kitware.com/vtk/vtk/-/merge_requests/13185
-#if VTK_VERSION_NUMBER < VTK_VERSION_CHECK(9, 6, 2)
   /**
-   * This method is reimplemented to add a workaround needed before the fix linked above.
+   * This method is reimplemented to render the actors of EXT_mesh_gpu_instancing nodes
+   * with a vtkGlyph3DMapper, which uses instanced draws, and to add a workaround needed
+   * before https://gitlab.kitware.com/vtk/vtk/-/merge_requests/13116
    */
   void ImportActors(vtkRenderer* renderer) override;
-#endif
 
 private:
   vtkF3DGLTFImporter(const vtkF3DGLTFImporter&) = delete;